@@ -45,7 +45,7 @@ FHoloMeshIndexBuffer::~FHoloMeshIndexBuffer()
     IndexBuffer.ReleaseRHI();
 }
 
-void FHoloMeshIndexBuffer::Create(uint32 InNumIndices, bool bInUse32Bit, bool bInNeedsUAV)
+void FHoloMeshIndexBuffer::Create(uint32 InNumIndices, bool bInUse32Bit, bool bInNeedsUAV, uint32 InCapacity)
 {
     FScopeLock Lock(&CriticalSection);
 
@@ -54,15 +54,24 @@ void FHoloMeshIndexBuffer::Create(uint32 InNumIndices, bool bInUse32Bit, bool bI
     bNeedsUAV = bInNeedsUAV;
     IndexData->Empty();
 
+    Capacity = FMath::Max(InNumIndices, InCapacity);
     if (bUse32Bit)
     {
-        IndexData->SetNumZeroed(InNumIndices);
-        SizeBytes = InNumIndices * 4;
+        IndexData->SetNumZeroed(Capacity);
+        SizeBytes = Capacity * 4;
     }
     else {
-        IndexData->SetNumZeroed(InNumIndices / 2);
-        SizeBytes = (InNumIndices / 2) * 4;
+        // 16 bit indices are packed two per element.
+        Capacity = Align(Capacity, 2);
+        IndexData->SetNumZeroed(Capacity / 2);
+        SizeBytes = (Capacity / 2) * 4;
     }
+    UsedIndices = InNumIndices;
+}
+
+uint32 FHoloMeshIndexBuffer::GetBucketCapacity(uint32 InNumIndices)
+{
+    return FMath::Max(1u, FMath::DivideAndRoundUp(InNumIndices, (uint32)HOLOMESH_INDEX_CAPACITY_BUCKET)) * HOLOMESH_INDEX_CAPACITY_BUCKET;
 }
 
 void FHoloMeshIndexBuffer::SwapData(FHoloMeshIndexBuffer* srcIndexBuffer)
@@ -75,23 +84,30 @@ void FHoloMeshIndexBuffer::SwapData(FHoloMeshIndexBuffer* srcIndexBuffer)
     }
 
     IndexData = srcIndexBuffer->TakeData();
+
+    // Our GPU buffer is kept, only the used count follows the source.
+    UsedIndices = FMath::Min(srcIndexBuffer->UsedIndices, Capacity);
+    DirtyRange.Reset();
 }
 
-uint32 FHoloMeshIndexBuffer::GetNumIndices() const
+void FHoloMeshIndexBuffer::MarkDirty(uint32 FirstIndex, uint32 NumIndices)
 {
-    if (bUse32Bit)
-    {
-        return IndexData->Num();
-    }
-    else
-    {
-        return IndexData->Num() * 2;
-    }
+    FScopeLock Lock(&CriticalSection);
+    DirtyRange.Add(FirstIndex, NumIndices);
+}
+
+bool FHoloMeshIndexBuffer::CanSwapData(FHoloMeshIndexBuffer* srcIndexBuffer) const
+{
+    return srcIndexBuffer->bUse32Bit == bUse32Bit
+        && srcIndexBuffer->bNeedsUAV == bNeedsUAV
+        && srcIndexBuffer->UsedIndices <= Capacity;
 }
 
 void FHoloMeshIndexBuffer::Clear(uint32 startingIndex)
 {
-    if ((int)startingIndex >= GetNumIndices())
+    // Bounded by the CPU data which may be smaller than capacity after a swap.
+    uint32 dataIndices = bUse32Bit ? IndexData->Num() : IndexData->Num() * 2;
+    if (startingIndex >= dataIndices)
     {
         return;
     }
@@ -99,11 +115,11 @@ void FHoloMeshIndexBuffer::Clear(uint32 startingIndex)
     if (bUse32Bit)
     {
         uint32* data = IndexData->GetData();
-        memset(&data[startingIndex], 0, sizeof(uint32) * (GetNumIndices() - startingIndex));
+        memset(&data[startingIndex], 0, sizeof(uint32) * (dataIndices - startingIndex));
     }
     else {
         uint16* data = (uint16*)IndexData->GetData();
-        memset(&data[startingIndex], 0, sizeof(uint16) * (GetNumIndices() - startingIndex));
+        memset(&data[startingIndex], 0, sizeof(uint16) * (dataIndices - startingIndex));
     }
 }
 
@@ -128,19 +144,12 @@ void FHoloMeshIndexBuffer::InitRHI(FRHICommandListBase& RHICmdList)
     uint32 stride = bUse32Bit ? sizeof(uint32) : sizeof(uint16);
     uint8 format  = bUse32Bit ? PF_R32_UINT    : PF_R16_UINT;
 
-    IndexBuffer.IndexBufferRHI = RHICreateIndexBuffer(stride, GetNumIndices() * stride, GetBufferUsage(bNeedsUAV), CreateInfo);
+    IndexBuffer.IndexBufferRHI = RHICreateIndexBuffer(stride, Capacity * stride, GetBufferUsage(bNeedsUAV), CreateInfo);
 
     // Initial upload to ensure unused buffer is filled with zeros.
     if (IndexData != nullptr)
     {
-        if (bUse32Bit)
-        {
-            HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), GetNumIndices() * sizeof(uint32));
-        }
-        else
-        {
-            HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), GetNumIndices() * sizeof(uint16));
-        }
+        HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), FMath::Min<uint32>(IndexData->Num() * sizeof(uint32), Capacity * stride));
     }
 
     if (bNeedsUAV)
@@ -166,19 +175,12 @@ void FHoloMeshIndexBuffer::InitRHI()
     uint32 stride = bUse32Bit ? sizeof(uint32) : sizeof(uint16);
     uint8 format = bUse32Bit ? PF_R32_UINT : PF_R16_UINT;
 
-    IndexBuffer.IndexBufferRHI = RHICreateIndexBuffer(stride, GetNumIndices() * stride, GetBufferUsage(bNeedsUAV), CreateInfo);
+    IndexBuffer.IndexBufferRHI = RHICreateIndexBuffer(stride, Capacity * stride, GetBufferUsage(bNeedsUAV), CreateInfo);
 
     // Initial upload to ensure unused buffer is filled with zeros.
     if (IndexData != nullptr)
     {
-        if (bUse32Bit)
-        {
-            HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), GetNumIndices() * sizeof(uint32));
-        }
-        else
-        {
-            HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), GetNumIndices() * sizeof(uint16));
-        }
+        HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), FMath::Min<uint32>(IndexData->Num() * sizeof(uint32), Capacity * stride));
     }
 
     if (bNeedsUAV)
@@ -214,22 +216,33 @@ void FHoloMeshIndexBuffer::UpdateData_RenderThread(FRHICommandListImmediate& RHI
 {
     FScopeLock Lock(&CriticalSection);
 
-    // Copy the index data into the index buffer.
+    // Copy the dirty, or else used, index data into the index buffer. The rest of capacity is never drawn.
     double start = FPlatformTime::Seconds();
 
-    if (bUse32Bit)
+    uint32 first = 0;
+    uint32 end = UsedIndices;
+    if (!DirtyRange.IsEmpty())
     {
-        HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), GetNumIndices() * sizeof(uint32), &RHICmdList);
+        first = DirtyRange.First;
+        end = FMath::Min(DirtyRange.End, UsedIndices);
     }
-    else 
+    DirtyRange.Reset();
+
+    // Byte range is widened to whole uint32 elements of the CPU data.
+    uint32 stride = bUse32Bit ? sizeof(uint32) : sizeof(uint16);
+    uint32 uploadStart = AlignDown(first * stride, sizeof(uint32));
+    uint32 uploadEnd = FMath::Min<uint32>(Align(end * stride, sizeof(uint32)), IndexData->Num() * sizeof(uint32));
+    uint32 uploadBytes = uploadEnd > uploadStart ? uploadEnd - uploadStart : 0;
+    if (uploadBytes > 0)
     {
-        HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, IndexData->GetData(), GetNumIndices() * sizeof(uint16), &RHICmdList);
+        HoloMeshUtilities::UploadIndexBuffer(IndexBuffer.IndexBufferRHI, (uint8*)IndexData->GetData() + uploadStart, uploadBytes, &RHICmdList, uploadStart);
+        GHoloMeshManager.AddUploadBytes(uploadBytes, EHoloMeshUploadStream::Indices);
     }
 
     double end = FPlatformTime::Seconds();
 
 #if HOLOMESH_BUFFER_DEBUG
-    UE_LOG(LogHoloMesh, Warning, TEXT("Index Upload Time: %f Size: %d"), ((end - start) * 1000.0f), (GetNumIndices() * sizeof(uint32)));
+    UE_LOG(LogHoloMesh, Warning, TEXT("Index Upload Time: %f Size: %d"), ((end - start) * 1000.0f), uploadBytes);
 #endif
 }
 
@@ -242,6 +255,17 @@ void FHoloMeshIndexBuffer::UpdateData()
         });
 }
 
+void FHoloMeshIndexBuffer::CopyFrom(FRDGBuilder& GraphBuilder, FHoloMeshIndexBuffer* SourceIndexBuffer)
+{
+    FHoloMeshBufferRHIRef SourceRHI = SourceIndexBuffer->GetIndexBufferRef()->IndexBufferRHI;
+    FHoloMeshBufferRHIRef DestRHI = IndexBuffer.IndexBufferRHI;
+
+    if (SourceRHI.IsValid() && DestRHI.IsValid())
+    {
+        HoloMeshUtilities::CopyBuffer(GraphBuilder, SourceRHI, DestRHI, FMath::Min(SourceRHI->GetSize(), DestRHI->GetSize()));
+    }
+}
+
 // --- Vertex Buffer ---
 
 static inline void InitOrUpdateResource(FRenderResource* Resource)
@@ -259,6 +283,7 @@ static inline void InitOrUpdateResource(FRenderResource* Resource)
 FHoloMeshVertexBuffers::FHoloMeshVertexBuffers() :
     NumVertices(0),
     NumTexCoords(0),
+    Capacity(0),
     PositionData(NULL),
     PrevPositionData(NULL),
     ColorData(NULL),
@@ -306,7 +331,7 @@ void FHoloMeshVertexBuffers::CleanUp()
     }
 }
 
-void FHoloMeshVertexBuffers::Create(uint32 InNumVertices, uint32 InNumTexCoords, bool bInNeedsUAV, bool bInUseHighPrecision, bool bInNeedsCPUAccess)
+void FHoloMeshVertexBuffers::Create(uint32 InNumVertices, uint32 InNumTexCoords, bool bInNeedsUAV, bool bInUseHighPrecision, bool bInNeedsCPUAccess, uint32 InCapacity)
 {
     check(InNumTexCoords < MAX_STATIC_TEXCOORDS&& InNumTexCoords > 0);
 
@@ -317,6 +342,7 @@ void FHoloMeshVertexBuffers::Create(uint32 InNumVertices, uint32 InNumTexCoords,
 
 	NumVertices         = InNumVertices;
     NumTexCoords        = InNumTexCoords;
+    Capacity            = FMath::Max(InNumVertices, InCapacity);
     bUseHighPrecision   = bInUseHighPrecision;
     bNeedsUAV           = bInNeedsUAV;
     bNeedsCPUAccess     = true;
@@ -324,20 +350,20 @@ void FHoloMeshVertexBuffers::Create(uint32 InNumVertices, uint32 InNumTexCoords,
 
     // Positions
     PositionData = new FPositionVertexData(bNeedsCPUAccess);
-    PositionData->ResizeBuffer(NumVertices);
+    PositionData->ResizeBuffer(Capacity);
 
     // Positions
     PrevPositionData = new FPositionVertexData(bNeedsCPUAccess);
-    PrevPositionData->ResizeBuffer(NumVertices);
+    PrevPositionData->ResizeBuffer(Capacity);
 
     // Colors
     ColorData = new FColorVertexData(bNeedsCPUAccess);
-    ColorData->ResizeBuffer(NumVertices);
+    ColorData->ResizeBuffer(Capacity);
 
     // Tangents (Normals)
     typedef TStaticMeshVertexTangentDatum<typename TStaticMeshVertexTangentTypeSelector<EStaticMeshVertexTangentBasisType::Default>::TangentTypeT> TangentType;
     TangentsData = new TStaticMeshVertexData<TangentType>(bNeedsCPUAccess);
-    TangentsData->ResizeBuffer(NumVertices);
+    TangentsData->ResizeBuffer(Capacity);
 
     // UVs
     uint32 UVTypeSize = 0;
@@ -345,14 +371,14 @@ void FHoloMeshVertexBuffers::Create(uint32 InNumVertices, uint32 InNumTexCoords,
     {
         typedef TStaticMeshVertexUVsDatum<typename TStaticMeshVertexUVsTypeSelector<EStaticMeshVertexUVType::HighPrecision>::UVsTypeT> UVType;
         TexCoordData = new TStaticMeshVertexData<UVType>(bNeedsCPUAccess);
-        TexCoordData->ResizeBuffer(NumVertices * GetNumTexCoords());
+        TexCoordData->ResizeBuffer(Capacity * GetNumTexCoords());
         UVTypeSize = sizeof(UVType);
     }
     else 
     {
         typedef TStaticMeshVertexUVsDatum<typename TStaticMeshVertexUVsTypeSelector<EStaticMeshVertexUVType::Default>::UVsTypeT> UVType;
         TexCoordData = new TStaticMeshVertexData<UVType>(bNeedsCPUAccess);
-        TexCoordData->ResizeBuffer(NumVertices * GetNumTexCoords());
+        TexCoordData->ResizeBuffer(Capacity * GetNumTexCoords());
         UVTypeSize = sizeof(UVType);
     }
 
@@ -376,6 +402,40 @@ void FHoloMeshVertexBuffers::SwapData(FHoloMeshVertexBuffers* srcVertexBuffers)
     ColorData = srcVertexBuffers->TakeColorData();
     TangentsData = srcVertexBuffers->TakeTangentsData();
     TexCoordData = srcVertexBuffers->TakeTexCoordData();
+
+    // Our GPU buffers are kept, only the used count follows the source.
+    NumVertices = FMath::Min(srcVertexBuffers->NumVertices, Capacity);
+    for (FHoloMeshDirtyRange& DirtyRange : DirtyRanges)
+    {
+        DirtyRange.Reset();
+    }
+}
+
+void FHoloMeshVertexBuffers::MarkDirty(EHoloMeshUpdateFlags Flags, uint32 FirstVertex, uint32 InNumVertices)
+{
+    FScopeLock Lock(&CriticalSection);
+
+    const EHoloMeshUpdateFlags Streams[] = { EHoloMeshUpdateFlags::Positions, EHoloMeshUpdateFlags::Normals, EHoloMeshUpdateFlags::Colors, EHoloMeshUpdateFlags::UVs };
+    for (int i = 0; i < UE_ARRAY_COUNT(Streams); ++i)
+    {
+        if ((Flags & Streams[i]) != EHoloMeshUpdateFlags::None)
+        {
+            DirtyRanges[i].Add(FirstVertex, InNumVertices);
+        }
+    }
+}
+
+bool FHoloMeshVertexBuffers::CanSwapData(FHoloMeshVertexBuffers* srcVertexBuffers) const
+{
+    return srcVertexBuffers->NumTexCoords == NumTexCoords
+        && srcVertexBuffers->bUseHighPrecision == bUseHighPrecision
+        && srcVertexBuffers->bNeedsUAV == bNeedsUAV
+        && srcVertexBuffers->NumVertices <= Capacity;
+}
+
+uint32 FHoloMeshVertexBuffers::GetBucketCapacity(uint32 InNumVertices)
+{
+    return FMath::Max(1u, FMath::DivideAndRoundUp(InNumVertices, (uint32)HOLOMESH_VERTEX_CAPACITY_BUCKET)) * HOLOMESH_VERTEX_CAPACITY_BUCKET;
 }
 
 void FHoloMeshVertexBuffers::InitOrUpdate(FHoloMeshVertexFactory* InVertexFactory, uint32 InLightMapIndex)
@@ -410,7 +470,7 @@ void FHoloMeshVertexBuffers::InitOrUpdate(FHoloMeshVertexFactory* InVertexFactor
 
 FHoloMeshBufferRHIRef FHoloMeshVertexBuffers::CreatePositionRHIBuffer()
 {
-	if (GetNumVertices())
+	if (GetCapacity())
 	{
 		FResourceArrayInterface* RESTRICT ResourceArray = PositionData ? PositionData->GetResourceArray() : nullptr;
 		const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
@@ -429,7 +489,7 @@ FHoloMeshBufferRHIRef FHoloMeshVertexBuffers::CreatePositionRHIBuffer()
 
 FHoloMeshBufferRHIRef FHoloMeshVertexBuffers::CreatePrevPositionRHIBuffer()
 {
-    if (GetNumVertices())
+    if (GetCapacity())
     {
         FResourceArrayInterface* RESTRICT ResourceArray = PrevPositionData ? PrevPositionData->GetResourceArray() : nullptr;
         const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
@@ -450,7 +510,7 @@ FHoloMeshBufferRHIRef FHoloMeshVertexBuffers::CreateColorRHIBuffer()
 {
     // Note: Color buffer always uses UAV for now.
 
-    if (GetNumVertices())
+    if (GetCapacity())
     {
         FResourceArrayInterface* RESTRICT ResourceArray = ColorData ? ColorData->GetResourceArray() : nullptr;
         const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
@@ -469,7 +529,7 @@ FHoloMeshBufferRHIRef FHoloMeshVertexBuffers::CreateColorRHIBuffer()
 
 FHoloMeshBufferRHIRef FHoloMeshVertexBuffers::CreateTangentsRHIBuffer()
 {
-    if (GetNumVertices())
+    if (GetCapacity())
     {
         FResourceArrayInterface* RESTRICT ResourceArray = TangentsData ? TangentsData->GetResourceArray() : nullptr;
         const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
@@ -906,43 +966,62 @@ void FHoloMeshVertexBuffers::UpdateData_RenderThread(FRHICommandListImmediate& R
 {
     double update_start = FPlatformTime::Seconds();
 
+    FScopeLock Lock(&CriticalSection);
+
+    // Only the dirty, or else used, vertices are uploaded. The rest of capacity is never drawn.
+    auto UploadRange = [this, &RHICmdList](FHoloMeshBuffer& Buffer, FStaticMeshVertexDataInterface* Data, FHoloMeshDirtyRange& DirtyRange, uint32 ElementsPerVertex, EHoloMeshUploadStream Stream)
+    {
+        uint32 First = 0;
+        uint32 End = GetNumVertices();
+        if (!DirtyRange.IsEmpty())
+        {
+            First = DirtyRange.First;
+            End = FMath::Min(DirtyRange.End, GetNumVertices());
+        }
+        DirtyRange.Reset();
+
+        FResourceArrayInterface* RESTRICT ResourceArray = Data ? Data->GetResourceArray() : nullptr;
+        if (ResourceArray == nullptr || End <= First)
+        {
+            return;
+        }
+
+        const uint32 ElementStride = Data->GetStride() * ElementsPerVertex;
+        const uint32 OffsetInBytes = First * ElementStride;
+        const uint32 EndInBytes = FMath::Min(End * ElementStride, ResourceArray->GetResourceDataSize());
+        if (EndInBytes > OffsetInBytes)
+        {
+            const uint32 SizeInBytes = EndInBytes - OffsetInBytes;
+            HoloMeshUtilities::UploadVertexBuffer(Buffer.VertexBufferRHI, (const uint8*)ResourceArray->GetResourceData() + OffsetInBytes, SizeInBytes, &RHICmdList, OffsetInBytes);
+            GHoloMeshManager.AddUploadBytes(SizeInBytes, Stream);
+        }
+    };
+
     if (GetNumVertices())
     {
         // Positions
         if ((Flags & EHoloMeshUpdateFlags::Positions) != EHoloMeshUpdateFlags::None)
         {
-            FResourceArrayInterface* RESTRICT ResourceArray = PositionData ? PositionData->GetResourceArray() : nullptr;
-            const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
-
-            HoloMeshUtilities::UploadVertexBuffer(PositionVertexBuffer.VertexBufferRHI, ResourceArray->GetResourceData(), SizeInBytes, &RHICmdList);
+            UploadRange(PositionVertexBuffer, PositionData.Get(), DirtyRanges[0], 1, EHoloMeshUploadStream::Positions);
         }
 
         // Normals/Tangents
         if ((Flags & EHoloMeshUpdateFlags::Normals) != EHoloMeshUpdateFlags::None)
         {
-            FResourceArrayInterface* RESTRICT ResourceArray = TangentsData ? TangentsData->GetResourceArray() : nullptr;
-            const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
-
-            HoloMeshUtilities::UploadVertexBuffer(TangentsVertexBuffer.VertexBufferRHI, ResourceArray->GetResourceData(), SizeInBytes, &RHICmdList);
+            UploadRange(TangentsVertexBuffer, TangentsData, DirtyRanges[1], 1, EHoloMeshUploadStream::Normals);
         }
 
         // Colors
         if ((Flags & EHoloMeshUpdateFlags::Colors) != EHoloMeshUpdateFlags::None)
         {
-            FResourceArrayInterface* RESTRICT ResourceArray = ColorData ? ColorData->GetResourceArray() : nullptr;
-            const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
-
-            HoloMeshUtilities::UploadVertexBuffer(ColorVertexBuffer.VertexBufferRHI, ResourceArray->GetResourceData(), SizeInBytes, &RHICmdList);
+            UploadRange(ColorVertexBuffer, ColorData, DirtyRanges[2], 1, EHoloMeshUploadStream::Colors);
         }
     }
 
     // UVs
     if (GetNumTexCoords() && ((Flags & EHoloMeshUpdateFlags::UVs) != EHoloMeshUpdateFlags::None))
     {
-        FResourceArrayInterface* RESTRICT ResourceArray = TexCoordData ? TexCoordData->GetResourceArray() : nullptr;
-        const uint32 SizeInBytes = ResourceArray ? ResourceArray->GetResourceDataSize() : 0;
-
-        HoloMeshUtilities::UploadVertexBuffer(TexCoordVertexBuffer.VertexBufferRHI, ResourceArray->GetResourceData(), SizeInBytes, &RHICmdList);
+        UploadRange(TexCoordVertexBuffer, TexCoordData, DirtyRanges[3], GetNumTexCoords(), EHoloMeshUploadStream::UVs);
     }
 
 #if HOLOMESH_BUFFER_DEBUG
@@ -951,6 +1030,23 @@ void FHoloMeshVertexBuffers::UpdateData_RenderThread(FRHICommandListImmediate& R
 #endif
 }
 
+void FHoloMeshVertexBuffers::CopyFrom(FRDGBuilder& GraphBuilder, const FHoloMeshVertexBuffers* SourceVertexBuffers)
+{
+    auto CopyVertexBuffer = [&GraphBuilder](const FHoloMeshBuffer& Source, FHoloMeshBuffer& Dest)
+    {
+        if (Source.VertexBufferRHI.IsValid() && Dest.VertexBufferRHI.IsValid())
+        {
+            HoloMeshUtilities::CopyBuffer(GraphBuilder, Source.VertexBufferRHI, Dest.VertexBufferRHI, FMath::Min(Source.VertexBufferRHI->GetSize(), Dest.VertexBufferRHI->GetSize()));
+        }
+    };
+
+    CopyVertexBuffer(SourceVertexBuffers->PositionVertexBuffer, PositionVertexBuffer);
+    CopyVertexBuffer(SourceVertexBuffers->PrevPositionVertexBuffer, PrevPositionVertexBuffer);
+    CopyVertexBuffer(SourceVertexBuffers->ColorVertexBuffer, ColorVertexBuffer);
+    CopyVertexBuffer(SourceVertexBuffers->TangentsVertexBuffer, TangentsVertexBuffer);
+    CopyVertexBuffer(SourceVertexBuffers->TexCoordVertexBuffer, TexCoordVertexBuffer);
+}
+
 // --- Texture ---
 
 FHoloMeshTexture::FHoloMeshTexture()
@@ -1033,7 +1129,7 @@ void FHoloMeshTexture::Release()
 int FHoloMeshTexture::GetTextureSizeBytes()
 {
     double bytesPerPixel = 4.0;
-    if (Format == EPixelFormat::PF_R8)
+    if (Format == EPixelFormat::PF_R8 || Format == EPixelFormat::PF_G8)
     {
         bytesPerPixel = 1.0;
     }
@@ -1041,7 +1137,7 @@ int FHoloMeshTexture::GetTextureSizeBytes()
     {
         bytesPerPixel = 2.0;
     }
-    if (Format == EPixelFormat::PF_BC4)
+    if (Format == EPixelFormat::PF_BC4 || Format == EPixelFormat::PF_ETC2_R11_EAC)
     {
         bytesPerPixel = 0.5;
     }
@@ -1134,6 +1230,7 @@ void FHoloMeshDataTexture::Release()
     if (TextureData != nullptr)
     {
         delete[] TextureData;
+        TextureData = nullptr;
     }
 }
 
@@ -1149,8 +1246,12 @@ void FHoloMeshDataTexture::SetData(size_t destX, size_t width, float* data)
 
 void FHoloMeshDataTexture::Update()
 {
+    // The region is read on the render thread and freed once the upload is done.
     FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, SrcWidth, 1);
-    Texture->UpdateTextureRegions(0, 1, Region, SrcPitch, 32, (uint8_t*)TextureData);
+    Texture->UpdateTextureRegions(0, 1, Region, SrcPitch, 32, (uint8_t*)TextureData, [](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+    {
+        delete Regions;
+    });
 }
 
 void FHoloMeshDataTexture::SetToIdentity(int index)
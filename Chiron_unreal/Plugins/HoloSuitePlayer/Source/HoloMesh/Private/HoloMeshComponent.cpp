@@ -81,10 +81,7 @@ void FHoloMesh::UpdateUniforms(float PreviousPositionWeight)
 	ENQUEUE_RENDER_COMMAND(HoloMeshUpdateUniformBuffer)(
 		[HoloMeshVertexFactory, PreviousPositionWeight](FRHICommandListImmediate& RHICmdList)
 		{
-			FHoloMeshVertexFactoryParameters Parameters;
-			Parameters.PreviousPositionBuffer = HoloMeshVertexFactory->GetPreSkinPositionSRV();
-			Parameters.PreviousPositionWeight = PreviousPositionWeight;
-			HoloMeshVertexFactory->HoloMeshUniformBuffer.UpdateUniformBufferImmediate(Parameters);
+			HoloMeshVertexFactory->UpdateUniforms(PreviousPositionWeight);
 		});
 }
 
@@ -100,13 +97,62 @@ void FHoloMesh::UpdateUniforms(FRDGBuilder& GraphBuilder, float PreviousPosition
 	GraphBuilder.AddPass(RDG_EVENT_NAME("UpdateHoloMeshUniforms"), ERDGPassFlags::None | ERDGPassFlags::NeverCull,
 		[this, HoloMeshVertexFactory, PreviousPositionWeight](FRHICommandListImmediate& RHICmdList)
 		{
-			FHoloMeshVertexFactoryParameters Parameters;
-			Parameters.PreviousPositionBuffer = HoloMeshVertexFactory->GetPreSkinPositionSRV();
-			Parameters.PreviousPositionWeight = PreviousPositionWeight;
-			HoloMeshVertexFactory->HoloMeshUniformBuffer.UpdateUniformBufferImmediate(Parameters);
+			HoloMeshVertexFactory->UpdateUniforms(PreviousPositionWeight);
 		});
 }
 
+bool FHoloMesh::SupportsInterpolation() const
+{
+	return VertexFactory != nullptr && VertexFactory->GetType() == &FHoloMeshVertexFactory::StaticType
+		&& VertexFactory->SupportsManualVertexFetch(VertexFactory->GetFeatureLevel());
+}
+
+void FHoloMesh::SetPresentedFrame(float Frame, bool bMotionVectors)
+{
+	if (!VertexFactory || VertexFactory->GetType() != &FHoloMeshVertexFactory::StaticType)
+	{
+		return;
+	}
+
+	FHoloMeshVertexFactory* HoloMeshVertexFactory = static_cast<FHoloMeshVertexFactory*>(VertexFactory);
+
+	ENQUEUE_RENDER_COMMAND(HoloMeshSetPresentedFrame)(
+		[HoloMeshVertexFactory, Frame, bMotionVectors](FRHICommandListImmediate& RHICmdList)
+		{
+			float PreviousWeight = HoloMeshVertexFactory->GetInterpolationWeight(HoloMeshVertexFactory->PresentedFrame);
+			HoloMeshVertexFactory->PresentedFrame = Frame;
+			float Weight = HoloMeshVertexFactory->GetInterpolationWeight(Frame);
+			float PreviousPositionWeight = bMotionVectors ? FMath::Max(Weight - PreviousWeight, 0.0f) : 0.0f;
+
+			// Nothing changes while decoded frames are presented as they are.
+			if (Weight != HoloMeshVertexFactory->PublishedInterpolationWeight
+				|| PreviousPositionWeight != HoloMeshVertexFactory->PublishedPreviousPositionWeight)
+			{
+				HoloMeshVertexFactory->UpdateUniforms(PreviousPositionWeight);
+			}
+		});
+}
+
+void FHoloMesh::SetDecodedFrame(FRDGBuilder& GraphBuilder, int FrameNumber, bool bContinuous)
+{
+	if (!VertexFactory || VertexFactory->GetType() != &FHoloMeshVertexFactory::StaticType)
+	{
+		return;
+	}
+
+	FHoloMeshVertexFactory* HoloMeshVertexFactory = static_cast<FHoloMeshVertexFactory*>(VertexFactory);
+
+	int PreviousFrame = HoloMeshVertexFactory->InterpolationToFrame;
+	HoloMeshVertexFactory->InterpolationFromFrame = (bContinuous && PreviousFrame > -1 && PreviousFrame < FrameNumber) ? PreviousFrame : -1;
+	HoloMeshVertexFactory->InterpolationToFrame = FrameNumber;
+
+	// The presented frame may have been interpolated towards this one before it was decoded.
+	if (HoloMeshVertexFactory->GetInterpolationWeight(HoloMeshVertexFactory->PresentedFrame) != HoloMeshVertexFactory->PublishedInterpolationWeight)
+	{
+		UpdateUniforms(GraphBuilder, 0.0f);
+	}
+}
+
 void FHoloMesh::UpdateFromSource(FHoloMesh* SourceHoloMesh)
 {
 	FHoloMeshVertexBuffers* oldVertexBuffers = nullptr;
@@ -114,9 +160,9 @@ void FHoloMesh::UpdateFromSource(FHoloMesh* SourceHoloMesh)
 
 	if (VertexBuffers != nullptr)
 	{
-		// If the number of vertices match then we can just swap the data structures
+		// If the source fits in our capacity we can just swap the data structures
 		// and run an update instead of allocating new GPU resources.
-		if (SourceHoloMesh->VertexBuffers->GetNumVertices() == VertexBuffers->GetNumVertices())
+		if (VertexBuffers->CanSwapData(SourceHoloMesh->VertexBuffers))
 		{
 			VertexBuffers->SwapData(SourceHoloMesh->VertexBuffers);
 			VertexBuffers->UpdateData();
@@ -136,9 +182,9 @@ void FHoloMesh::UpdateFromSource(FHoloMesh* SourceHoloMesh)
 
 	if (IndexBuffer != nullptr)
 	{
-		// If the number of indices match then we can just swap the data structures
+		// If the source fits in our capacity we can just swap the data structures
 		// and run an update instead of allocating new GPU resources.
-		if (SourceHoloMesh->IndexBuffer->GetNumIndices() == IndexBuffer->GetNumIndices())
+		if (IndexBuffer->CanSwapData(SourceHoloMesh->IndexBuffer))
 		{
 			IndexBuffer->SwapData(SourceHoloMesh->IndexBuffer);
 			IndexBuffer->UpdateData();
@@ -231,7 +277,7 @@ public:
 
 	void PopulateMeshBatch(FMeshBatch& MeshBatch) const
 	{
-		int numTriangles = numTriangles = HoloMesh->IndexBuffer->GetNumIndices() / 3; 
+		int numTriangles = HoloMesh->IndexBuffer->GetNumIndices() / 3;
 
 		FMeshBatchElement& BatchElement = MeshBatch.Elements[0];
 		BatchElement.IndexBuffer = HoloMesh->IndexBuffer->GetIndexBufferRef();
@@ -488,6 +534,7 @@ UHoloMeshComponent::UHoloMeshComponent(const FObjectInitializer& ObjectInitializ
 : Super(ObjectInitializer)
 {
 	bUseComplexAsSimpleCollision = true;
+	CollisionMode = EHoloMeshCollisionMode::None;
 
 	HoloMeshLODScreenSizes = { 1.0f, 0.5f, 0.1f };
 	HoloMeshForceLOD = -1;
@@ -549,11 +596,35 @@ int32 UHoloMeshComponent::GetNumMaterials() const
 
 UMaterialInterface* UHoloMeshComponent::GetMaterial(int32 ElementIndex) const
 {
+	UHoloMeshComponent* Source = InstanceSource.Get();
+	if (Source != nullptr)
+	{
+		return InstanceFrameMesh != nullptr ? (UMaterialInterface*)InstanceFrameMesh->Material : Source->GetMaterial(ElementIndex);
+	}
+
+	if (DecodedFrameMesh != nullptr)
+	{
+		return (UMaterialInterface*)DecodedFrameMesh->Material;
+	}
+
 	return (UMaterialInterface*)HoloMesh[ReadIndex].Material;
 }
 
 FHoloMesh* UHoloMeshComponent::GetHoloMesh(bool write)
 {
+	// Instances draw their source's mesh, or a frame ring entry when offset.
+	UHoloMeshComponent* Source = InstanceSource.Get();
+	if (Source != nullptr && !write)
+	{
+		return InstanceFrameMesh != nullptr ? InstanceFrameMesh : Source->GetHoloMesh(false);
+	}
+
+	// Looping clips may be drawn from the decoded frame cache.
+	if (DecodedFrameMesh != nullptr && !write)
+	{
+		return DecodedFrameMesh;
+	}
+
 	return &HoloMesh[write ? WriteIndex : ReadIndex];
 }
 
@@ -579,6 +650,15 @@ void UHoloMeshComponent::DirtyHoloMesh()
 	// Mark render state dirty so the HoloMesh proxy will be recreated
 	// with the new ReadIndex texture.
 	MarkRenderStateDirty();
+
+	// Instances hold a proxy to our mesh as well.
+	for (auto& Instance : HoloMeshInstances)
+	{
+		if (Instance.IsValid())
+		{
+			Instance->DirtyHoloMesh();
+		}
+	}
 }
 
 void UHoloMeshComponent::SetLODOptions(std::array<float, HOLOMESH_MAX_LODS> lodScreenSizes, int minimumLOD, int forceLOD)
@@ -658,6 +738,12 @@ void UHoloMeshComponent::OnPostOpaqueRender(FPostOpaqueRenderParameters& Paramet
 	if (SceneView != nullptr)
 	{
 		int computedLOD = ComputeHoloMeshLOD(SceneView);
+
+		// The quality governor biases every mesh that isn't forced to a LOD.
+		if (HoloMeshForceLOD < 0)
+		{
+			computedLOD = FMath::Min(computedLOD + GHoloMeshManager.GetLODBias(), HOLOMESH_MAX_LODS - 1);
+		}
 		SetHoloMeshLOD(computedLOD);
 	}
 
@@ -672,6 +758,19 @@ void UHoloMeshComponent::OnPostOpaqueRender(FPostOpaqueRenderParameters& Paramet
 
 void UHoloMeshComponent::UpdateHoloMesh()
 {
+	// Meshes still enabling collision through the old per mesh flag get the per triangle collision it used to cook.
+	if (CollisionMode == EHoloMeshCollisionMode::None)
+	{
+		for (int i = 0; i < HOLOMESH_BUFFER_COUNT; ++i)
+		{
+			if (HoloMesh[i].bEnableCollision)
+			{
+				CollisionMode = EHoloMeshCollisionMode::Full;
+				break;
+			}
+		}
+	}
+
 	UpdateLocalBounds(); // Update overall bounds
 	UpdateCollision(); // Mark collision as dirty
 	MarkRenderStateDirty(); // New section requires recreating scene proxy
@@ -689,8 +788,508 @@ void UHoloMeshComponent::RequestCulled_RenderThread(FHoloMeshUpdateRequest reque
 {
 }
 
-void UHoloMeshComponent::DoThreadedWork(int sequenceIndex, int frameIndex)
+void UHoloMeshComponent::DoThreadedWork(int sequenceIndex, int frameIndex, EHoloMeshWorkType workType)
+{
+}
+
+void UHoloMeshComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	// Release instances first so none of their proxies outlive our meshes.
+	TArray<TWeakObjectPtr<UHoloMeshComponent>> Instances = HoloMeshInstances;
+	for (auto& Instance : Instances)
+	{
+		if (Instance.IsValid())
+		{
+			Instance->SetInstanceSource(nullptr);
+		}
+	}
+
+	if (IsHoloMeshInstance())
+	{
+		SetInstanceSource(nullptr);
+	}
+
+	FreeDecodedFrameCache();
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+// -- Instancing --
+
+void UHoloMeshComponent::SetInstanceSource(UHoloMeshComponent* Source, int FrameOffset)
+{
+	// Always bind to the component that actually decodes.
+	while (Source != nullptr && Source->IsHoloMeshInstance())
+	{
+		Source = Source->GetInstanceSource();
+	}
+
+	if (Source == this)
+	{
+		return;
+	}
+
+	if (UHoloMeshComponent* OldSource = InstanceSource.Get())
+	{
+		OldSource->RemoveHoloMeshInstance(this);
+	}
+
+	InstanceSource = Source;
+	InstanceFrameOffset = FMath::Max(FrameOffset, 0);
+	InstanceFrameMesh = nullptr;
+
+	if (Source != nullptr)
+	{
+		Source->AddHoloMeshInstance(this);
+
+		// Instances are registered so the manager computes their LOD and visibility,
+		// they never submit update requests of their own.
+		if (!RegisteredGUID.IsValid())
+		{
+			GHoloMeshManager.Register(this, GetOwner());
+		}
+	}
+	else if (RegisteredGUID.IsValid())
+	{
+		GHoloMeshManager.Unregister(RegisteredGUID);
+		RegisteredGUID.Invalidate();
+	}
+
+	DirtyHoloMesh();
+}
+
+void UHoloMeshComponent::AddHoloMeshInstance(UHoloMeshComponent* Instance)
+{
+	{
+		FScopeLock Lock(&CriticalSection);
+		HoloMeshInstances.AddUnique(Instance);
+	}
+
+	UpdateInstanceFrameRing();
+}
+
+void UHoloMeshComponent::RemoveHoloMeshInstance(UHoloMeshComponent* Instance)
+{
+	FScopeLock Lock(&CriticalSection);
+	HoloMeshInstances.RemoveAll([Instance](const TWeakObjectPtr<UHoloMeshComponent>& Item)
+	{
+		return !Item.IsValid() || Item.Get() == Instance;
+	});
+}
+
+int UHoloMeshComponent::GetDecodeLOD()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	int DecodeLOD = HoloMeshLOD;
+	for (auto& Instance : HoloMeshInstances)
+	{
+		if (Instance.IsValid())
+		{
+			DecodeLOD = FMath::Min(DecodeLOD, Instance->GetHoloMeshLOD());
+		}
+	}
+
+	return DecodeLOD;
+}
+
+void UHoloMeshComponent::UpdateInstances(int FrameNumber, int FrameCount)
+{
+	if (HoloMeshInstances.Num() == 0)
+	{
+		return;
+	}
+
+	UpdateInstanceFrameRing();
+
+	for (auto& InstancePtr : HoloMeshInstances)
+	{
+		UHoloMeshComponent* Instance = InstancePtr.Get();
+		if (Instance == nullptr || Instance->InstanceFrameOffset <= 0)
+		{
+			continue;
+		}
+
+		int InstanceFrame = FrameNumber - Instance->InstanceFrameOffset;
+		if (InstanceFrame < 0 && FrameCount > 0)
+		{
+			InstanceFrame = ((InstanceFrame % FrameCount) + FrameCount) % FrameCount;
+		}
+
+		// Until the ring has caught up with the offset the live mesh is drawn instead. A complete
+		// decoded frame cache has every frame, the ring only the ones decoded recently.
+		FHoloMesh* FrameMesh = GetDecodedFrame(InstanceFrame);
+		if (FrameMesh == nullptr)
+		{
+			FrameMesh = GetInstanceFrame(InstanceFrame);
+		}
+		if (FrameMesh != Instance->InstanceFrameMesh)
+		{
+			Instance->InstanceFrameMesh = FrameMesh;
+			Instance->DirtyHoloMesh();
+		}
+	}
+}
+
+void UHoloMeshComponent::UpdateInstanceFrameRing()
+{
+	int MaxFrameOffset = 0;
+	for (auto& Instance : HoloMeshInstances)
+	{
+		if (Instance.IsValid())
+		{
+			MaxFrameOffset = FMath::Max(MaxFrameOffset, Instance->InstanceFrameOffset);
+		}
+	}
+
+	if (MaxFrameOffset == 0)
+	{
+		return;
+	}
+
+	FHoloMesh* SourceMesh = GetHoloMesh();
+	if (SourceMesh->VertexBuffers->GetNumVertices() == 0 || SourceMesh->IndexBuffer->GetNumIndices() == 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&CriticalSection);
+
+	// A few extra entries so a frame isn't overwritten while the render thread
+	// is still behind the game thread.
+	int RingSize = MaxFrameOffset + HOLOMESH_BUFFER_COUNT + 1;
+	while (InstanceFrameRing.Num() < RingSize)
+	{
+		TUniquePtr<FHoloMeshInstanceFrame> Frame = MakeUnique<FHoloMeshInstanceFrame>();
+		Frame->Mesh = CreateFrameCopy(SourceMesh);
+		InstanceFrameRing.Add(MoveTemp(Frame));
+	}
+
+	for (auto& Frame : InstanceFrameRing)
+	{
+		UpdateFrameCopyTextures(SourceMesh, Frame->Mesh.Get(), InstanceFrameMaterials);
+	}
+}
+
+FHoloMesh* UHoloMeshComponent::GetInstanceFrame(int FrameNumber)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (FrameNumber < 0 || InstanceFrameRing.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	FHoloMeshInstanceFrame& Frame = *InstanceFrameRing[FrameNumber % InstanceFrameRing.Num()];
+	return (Frame.FrameNumber == FrameNumber) ? Frame.Mesh.Get() : nullptr;
+}
+
+void UHoloMeshComponent::CaptureInstanceFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMesh* SourceMesh, int FrameNumber)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (SourceMesh == nullptr || FrameNumber < 0 || InstanceFrameRing.Num() == 0)
+	{
+		return;
+	}
+
+	FHoloMeshInstanceFrame& Frame = *InstanceFrameRing[FrameNumber % InstanceFrameRing.Num()];
+	Frame.FrameNumber = CopyFrame_RenderThread(GraphBuilder, SourceMesh, Frame.Mesh.Get()) ? FrameNumber : -1;
+}
+
+// -- Decoded Frame Cache --
+
+void UHoloMeshComponent::UpdateDecodedFrameCache(int FrameNumber, int FrameCount)
+{
+	// Skeletons are driven by the decoded frame data so they can't be replayed from copies.
+	if (!GHoloMeshManager.IsDecodedFrameCacheEnabled() || HoloMeshSkeleton != nullptr || IsHoloMeshInstance() || !RegisteredGUID.IsValid()
+		|| FrameNumber < 0 || FrameNumber >= FrameCount || FPlatformTime::Seconds() < DecodedFrameCacheRetryTime)
+	{
+		return;
+	}
+
+	FHoloMesh* SourceMesh = GetHoloMesh(true);
+	if (SourceMesh->VertexBuffers->GetNumVertices() == 0 || SourceMesh->IndexBuffer->GetNumIndices() == 0)
+	{
+		return;
+	}
+
+	if (DecodedFrameCache.Num() != FrameCount)
+	{
+		FreeDecodedFrameCache();
+	}
+
+	size_t RequiredBytes = 0;
+	{
+		FScopeLock Lock(&CriticalSection);
+		DecodedFrameCache.SetNum(FrameCount);
+
+		TUniquePtr<FHoloMeshInstanceFrame>& Frame = DecodedFrameCache[FrameNumber];
+		if (!Frame.IsValid())
+		{
+			Frame = MakeUnique<FHoloMeshInstanceFrame>();
+			Frame->Mesh = CreateFrameCopy(SourceMesh);
+		}
+		UpdateFrameCopyTextures(SourceMesh, Frame->Mesh.Get(), DecodedFrameMaterials);
+
+		// Every frame ends up the size of this one, textures included once the decoder created them.
+		RequiredBytes = GetFrameCopySizeBytes(Frame->Mesh.Get()) * FrameCount;
+	}
+
+	// Reserved with the manager lock, which may evict other caches, so not under ours.
+	if (RequiredBytes > DecodedFrameCacheBytes)
+	{
+		if (!GHoloMeshManager.ReserveDecodedFrameCache(RegisteredGUID, RequiredBytes))
+		{
+			// Try again later, the caches in the way may have gone idle by then.
+			FreeDecodedFrameCache();
+			DecodedFrameCacheRetryTime = FPlatformTime::Seconds() + 5.0;
+			return;
+		}
+		DecodedFrameCacheBytes = RequiredBytes;
+	}
+	else
+	{
+		GHoloMeshManager.TouchDecodedFrameCache(RegisteredGUID);
+	}
+}
+
+void UHoloMeshComponent::CaptureDecodedFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMesh* SourceMesh, int FrameNumber)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (SourceMesh == nullptr || !DecodedFrameCache.IsValidIndex(FrameNumber) || !DecodedFrameCache[FrameNumber].IsValid())
+	{
+		return;
+	}
+
+	FHoloMeshInstanceFrame& Frame = *DecodedFrameCache[FrameNumber];
+	Frame.FrameNumber = CopyFrame_RenderThread(GraphBuilder, SourceMesh, Frame.Mesh.Get()) ? FrameNumber : -1;
+}
+
+FHoloMesh* UHoloMeshComponent::GetDecodedFrame(int FrameNumber)
+{
+	if (!DecodedFrameCache.IsValidIndex(FrameNumber))
+	{
+		return nullptr;
+	}
+
+	if (!bDecodedFrameCacheComplete)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		for (int i = 0; i < DecodedFrameCache.Num(); ++i)
+		{
+			if (!DecodedFrameCache[i].IsValid() || DecodedFrameCache[i]->FrameNumber != i)
+			{
+				return nullptr;
+			}
+		}
+		bDecodedFrameCacheComplete = true;
+	}
+
+	GHoloMeshManager.TouchDecodedFrameCache(RegisteredGUID);
+	return DecodedFrameCache[FrameNumber]->Mesh.Get();
+}
+
+void UHoloMeshComponent::BindDecodedFrame(FHoloMesh* FrameMesh)
+{
+	if (FrameMesh == DecodedFrameMesh)
+	{
+		return;
+	}
+
+	DecodedFrameMesh = FrameMesh;
+	DirtyHoloMesh();
+}
+
+void UHoloMeshComponent::FreeDecodedFrameCache()
+{
+	BindDecodedFrame(nullptr);
+
+	if (DecodedFrameCacheBytes > 0)
+	{
+		GHoloMeshManager.ReleaseDecodedFrameCache(RegisteredGUID);
+		DecodedFrameCacheBytes = 0;
+	}
+
+	bDecodedFrameCacheComplete = false;
+
+	TArray<FHoloMeshInstanceFrame*> Frames;
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		for (auto& Frame : DecodedFrameCache)
+		{
+			if (Frame.IsValid())
+			{
+				// UObjects are let go of here, the render resources on the render thread.
+				Frame->Mesh->BC4Texture.Release();
+				Frame->Mesh->Material = nullptr;
+				Frames.Add(Frame.Release());
+			}
+		}
+		DecodedFrameCache.Empty();
+		DecodedFrameMaterials.Empty();
+	}
+
+	if (Frames.Num() == 0)
+	{
+		return;
+	}
+
+	for (auto& InstancePtr : HoloMeshInstances)
+	{
+		UHoloMeshComponent* Instance = InstancePtr.Get();
+		if (Instance != nullptr && Frames.ContainsByPredicate([Instance](FHoloMeshInstanceFrame* Frame) { return Frame->Mesh.Get() == Instance->InstanceFrameMesh; }))
+		{
+			Instance->InstanceFrameMesh = nullptr;
+			Instance->DirtyHoloMesh();
+		}
+	}
+
+	// Proxies still drawing a cached frame are replaced before the render thread gets to this.
+	ENQUEUE_RENDER_COMMAND(FHoloMeshFreeDecodedFrames)(
+		[Frames](FRHICommandListImmediate& RHICmdList)
+		{
+			for (FHoloMeshInstanceFrame* Frame : Frames)
+			{
+				delete Frame;
+			}
+		});
+}
+
+// -- Frame Copies --
+
+TUniquePtr<FHoloMesh> UHoloMeshComponent::CreateFrameCopy(FHoloMesh* SourceMesh)
 {
+	ERHIFeatureLevel::Type FeatureLevel = ERHIFeatureLevel::ES3_1;
+	if (GetWorld() && GetWorld()->Scene)
+	{
+		FeatureLevel = GetWorld()->Scene->GetFeatureLevel();
+	}
+
+	TUniquePtr<FHoloMesh> FrameMesh = MakeUnique<FHoloMesh>();
+	FrameMesh->VertexBuffers->Create(SourceMesh->VertexBuffers->GetNumVertices(), SourceMesh->VertexBuffers->GetNumTexCoords(), true, false, true, SourceMesh->VertexBuffers->GetCapacity());
+	FrameMesh->IndexBuffer->Create(SourceMesh->IndexBuffer->GetNumIndices(), SourceMesh->IndexBuffer->Use32Bit(), true, SourceMesh->IndexBuffer->GetCapacity());
+	FrameMesh->LocalBox = SourceMesh->LocalBox;
+	FrameMesh->bFrameBounds = SourceMesh->bFrameBounds;
+	FrameMesh->InitOrUpdate(FeatureLevel);
+	return FrameMesh;
+}
+
+void UHoloMeshComponent::UpdateFrameCopyTextures(FHoloMesh* SourceMesh, FHoloMesh* FrameMesh, TArray<UMaterialInstanceDynamic*>& FrameMaterials)
+{
+	// Textures are created by the decoder once the first segment arrives so
+	// copies pick them up lazily, each with its own material.
+	bool bTexturesChanged = false;
+
+	if (SourceMesh->LumaTexture.IsValid() && !FrameMesh->LumaTexture.IsValid())
+	{
+		UTextureRenderTarget2D* SourceTarget = SourceMesh->LumaTexture.GetRenderTarget();
+		FrameMesh->LumaTexture.Create(SourceTarget->SizeX, SourceTarget->SizeY, SourceTarget->RenderTargetFormat, SourceTarget->Filter, SourceTarget->bAutoGenerateMips);
+		bTexturesChanged = true;
+	}
+
+	if (SourceMesh->MaskTexture.IsValid() && !FrameMesh->MaskTexture.IsValid())
+	{
+		UTextureRenderTarget2D* SourceTarget = SourceMesh->MaskTexture.GetRenderTarget();
+		FrameMesh->MaskTexture.Create(SourceTarget->SizeX, SourceTarget->SizeY, SourceTarget->RenderTargetFormat, SourceTarget->Filter, SourceTarget->bAutoGenerateMips);
+		bTexturesChanged = true;
+	}
+
+	if (SourceMesh->BC4Texture.IsValid() && !FrameMesh->BC4Texture.IsValid())
+	{
+		UTexture2D* SourceTexture = SourceMesh->BC4Texture.GetTexture();
+		FrameMesh->BC4Texture.Create(SourceTexture->GetSizeX(), SourceTexture->GetSizeY(), SourceTexture->GetPixelFormat(), SourceTexture->GetNumMips(), SourceTexture->Filter);
+		bTexturesChanged = true;
+	}
+
+	UMaterialInstanceDynamic* SourceMaterial = SourceMesh->Material;
+	if (SourceMaterial == nullptr || (FrameMesh->Material != nullptr && !bTexturesChanged))
+	{
+		return;
+	}
+
+	if (FrameMesh->Material == nullptr)
+	{
+		FrameMesh->Material = UMaterialInstanceDynamic::Create(SourceMaterial->Parent, this);
+		FrameMaterials.Add(FrameMesh->Material);
+	}
+	FrameMesh->Material->CopyParameterOverrides(SourceMaterial);
+
+	// Point any texture parameter bound to the source's textures at our copies.
+	for (const FTextureParameterValue& Parameter : SourceMaterial->TextureParameterValues)
+	{
+		UTexture* FrameTexture = nullptr;
+		if (SourceMesh->LumaTexture.IsValid() && Parameter.ParameterValue == SourceMesh->LumaTexture.GetRenderTarget())
+		{
+			FrameTexture = FrameMesh->LumaTexture.GetRenderTarget();
+		}
+		else if (SourceMesh->MaskTexture.IsValid() && Parameter.ParameterValue == SourceMesh->MaskTexture.GetRenderTarget())
+		{
+			FrameTexture = FrameMesh->MaskTexture.GetRenderTarget();
+		}
+		else if (SourceMesh->BC4Texture.IsValid() && Parameter.ParameterValue == SourceMesh->BC4Texture.GetTexture())
+		{
+			FrameTexture = FrameMesh->BC4Texture.GetTexture();
+		}
+
+		if (FrameTexture != nullptr)
+		{
+			FrameMesh->Material->SetTextureParameterValueByInfo(Parameter.ParameterInfo, FrameTexture);
+		}
+	}
+}
+
+bool UHoloMeshComponent::CopyFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMesh* SourceMesh, FHoloMesh* FrameMesh)
+{
+	if (!FrameMesh->IsInitialized())
+	{
+		return false;
+	}
+
+	FrameMesh->VertexBuffers->CopyFrom(GraphBuilder, SourceMesh->VertexBuffers);
+	FrameMesh->IndexBuffer->CopyFrom(GraphBuilder, SourceMesh->IndexBuffer);
+	FrameMesh->VertexBuffers->SetNumVertices(SourceMesh->VertexBuffers->GetNumVertices());
+	FrameMesh->IndexBuffer->SetUsedIndices(SourceMesh->IndexBuffer->GetNumIndices());
+
+	if (SourceMesh->LumaTexture.IsValid() && FrameMesh->LumaTexture.IsValid())
+	{
+		HoloMeshUtilities::CopyTexture(GraphBuilder, SourceMesh->LumaTexture.GetRenderTargetRHI(), FrameMesh->LumaTexture.GetRenderTargetRHI());
+	}
+
+	if (SourceMesh->MaskTexture.IsValid() && FrameMesh->MaskTexture.IsValid())
+	{
+		HoloMeshUtilities::CopyTexture(GraphBuilder, SourceMesh->MaskTexture.GetRenderTargetRHI(), FrameMesh->MaskTexture.GetRenderTargetRHI());
+	}
+
+	if (SourceMesh->BC4Texture.IsValid() && FrameMesh->BC4Texture.IsValid())
+	{
+		HoloMeshUtilities::CopyTexture(GraphBuilder, SourceMesh->BC4Texture.GetTextureRHI(), FrameMesh->BC4Texture.GetTextureRHI());
+	}
+
+	FrameMesh->LocalBox = SourceMesh->LocalBox;
+	FrameMesh->bFrameBounds = SourceMesh->bFrameBounds;
+	return true;
+}
+
+size_t UHoloMeshComponent::GetFrameCopySizeBytes(FHoloMesh* FrameMesh)
+{
+	size_t SizeBytes = FrameMesh->VertexBuffers->GetSizeBytes() + FrameMesh->IndexBuffer->GetSizeBytes();
+	if (FrameMesh->LumaTexture.IsValid())
+	{
+		SizeBytes += FrameMesh->LumaTexture.GetTextureSizeBytes();
+	}
+	if (FrameMesh->MaskTexture.IsValid())
+	{
+		SizeBytes += FrameMesh->MaskTexture.GetTextureSizeBytes();
+	}
+	if (FrameMesh->BC4Texture.IsValid())
+	{
+		SizeBytes += FrameMesh->BC4Texture.GetTextureSizeBytes();
+	}
+	return SizeBytes;
 }
 
 // -- Bounds --
@@ -700,13 +1299,15 @@ void UHoloMeshComponent::UpdateLocalBounds()
 	FBox LocalBox(ForceInit);
 
 	bool validBounds = false;
+	bool frameBounds = false;
 
 	// Read Mesh
-	LocalBox = HoloMesh[ReadIndex].LocalBox;
+	LocalBox = GetHoloMesh()->LocalBox;
 	if (LocalBox.IsValid && LocalBox.GetVolume() > 0.0f)
 	{
 		LocalBounds = FBoxSphereBounds(LocalBox);
 		validBounds = true;
+		frameBounds = GetHoloMesh()->bFrameBounds;
 	}
 
 	// Write Mesh
@@ -717,6 +1318,7 @@ void UHoloMeshComponent::UpdateLocalBounds()
 		{
 			LocalBounds = FBoxSphereBounds(LocalBox);
 			validBounds = true;
+			frameBounds = HoloMesh[WriteIndex].bFrameBounds;
 		}
 	}
 
@@ -726,8 +1328,11 @@ void UHoloMeshComponent::UpdateLocalBounds()
 		LocalBounds = FBoxSphereBounds(FVector(0.0f, 0.0f, 0.0f), FVector(12.5f, 12.5f, 100.0f), 25.0f);
 	}
 
-	// HACK: Bounding boxes are only for the keyframe.
-	LocalBounds = LocalBounds.ExpandBy(25.0f);
+	// Segment bounding boxes only cover the keyframe, pad them for the frames animated from it.
+	if (!frameBounds)
+	{
+		LocalBounds = LocalBounds.ExpandBy(25.0f);
+	}
 
 	// Update global bounds
 	UpdateBounds();
@@ -749,59 +1354,74 @@ FBoxSphereBounds UHoloMeshComponent::CalcBounds(const FTransform& LocalToWorld)
 
 bool UHoloMeshComponent::GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData)
 {
-	int32 VertexBase = 0; // Base vertex index for current section
-
-	// See if we should copy UVs
-	bool bCopyUVs = UPhysicsSettings::Get()->bSupportUVFromHitResults; 
-	if (bCopyUVs)
+	if (CollisionMode != EHoloMeshCollisionMode::Full)
 	{
-		CollisionData->UVs.AddZeroed(1); // only one UV channel
+		return false;
 	}
 
 	FHoloMesh* Mesh = &HoloMesh[ReadIndex];
+	if (Mesh->VertexBuffers == nullptr || Mesh->IndexBuffer == nullptr || Mesh->IndexBuffer->GetData() == nullptr)
+	{
+		return false;
+	}
 
 	auto PositionData = Mesh->VertexBuffers->GetPositionData();
-	FPositionVertex* Positions = (FPositionVertex*)PositionData->GetDataPointer();
+	if (!PositionData.IsValid() || PositionData->GetDataPointer() == nullptr)
+	{
+		return false;
+	}
 
-	auto TexCoordData = Mesh->VertexBuffers->GetTexCoordData();
-	FVector2DHalf* TexCoords = (FVector2DHalf*)(TexCoordData->GetDataPointer());
+	const FPositionVertex* Positions = (const FPositionVertex*)PositionData->GetDataPointer();
+	const int32 NumVertices = (int32)Mesh->VertexBuffers->GetNumVertices();
+	const int32 NumTriangles = (int32)Mesh->IndexBuffer->GetNumIndices() / 3;
 
-	uint16* Indices = Mesh->IndexBuffer->GetIndexData16();
+	// Sized once up front, the per element Add this replaced grew the arrays repeatedly on large meshes.
+	CollisionData->Vertices.SetNumUninitialized(NumVertices);
+	for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+	{
+		CollisionData->Vertices[VertIdx] = Positions[VertIdx].Position;
+	}
 
-	// Do we have collision enabled?
-	if (Mesh != nullptr && Mesh->bEnableCollision)
+	// See if we should copy UVs
+	auto TexCoordData = Mesh->VertexBuffers->GetTexCoordData();
+	if (UPhysicsSettings::Get()->bSupportUVFromHitResults && TexCoordData != nullptr && TexCoordData->GetDataPointer() != nullptr)
 	{
-		// Copy vert data
-		for (uint32 VertIdx = 0; VertIdx < Mesh->VertexBuffers->GetNumVertices(); VertIdx++)
+		const FVector2DHalf* TexCoords = (const FVector2DHalf*)TexCoordData->GetDataPointer();
+		CollisionData->UVs.SetNum(1); // only one UV channel
+		CollisionData->UVs[0].SetNumUninitialized(NumVertices);
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
 		{
-			CollisionData->Vertices.Add(Positions[VertIdx].Position);
-
-			// Copy UV if desired
-			if (bCopyUVs)
-			{
-				CollisionData->UVs[0].Add(TexCoords[VertIdx]);
-			}
+			CollisionData->UVs[0][VertIdx] = TexCoords[VertIdx];
 		}
+	}
 
-		// Copy triangle data
-		const int32 NumTriangles = Mesh->IndexBuffer->GetNumIndices() / 3;
+	CollisionData->Indices.SetNumUninitialized(NumTriangles);
+	if (Mesh->IndexBuffer->Use32Bit())
+	{
+		const uint32* Indices = Mesh->IndexBuffer->GetIndexData32();
 		for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
 		{
-			// Need to add base offset for indices
-			FTriIndices Triangle;
-			Triangle.v0 = Indices[(TriIdx * 3) + 0] + VertexBase;
-			Triangle.v1 = Indices[(TriIdx * 3) + 1] + VertexBase;
-			Triangle.v2 = Indices[(TriIdx * 3) + 2] + VertexBase;
-			CollisionData->Indices.Add(Triangle);
-
-			// Also store material info
-			CollisionData->MaterialIndices.Add(0);
+			FTriIndices& Triangle = CollisionData->Indices[TriIdx];
+			Triangle.v0 = Indices[(TriIdx * 3) + 0];
+			Triangle.v1 = Indices[(TriIdx * 3) + 1];
+			Triangle.v2 = Indices[(TriIdx * 3) + 2];
+		}
+	}
+	else
+	{
+		const uint16* Indices = Mesh->IndexBuffer->GetIndexData16();
+		for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
+		{
+			FTriIndices& Triangle = CollisionData->Indices[TriIdx];
+			Triangle.v0 = Indices[(TriIdx * 3) + 0];
+			Triangle.v1 = Indices[(TriIdx * 3) + 1];
+			Triangle.v2 = Indices[(TriIdx * 3) + 2];
 		}
-
-		// Remember the base index that new verts will be added from in next section
-		VertexBase = CollisionData->Vertices.Num();
 	}
 
+	// Single material
+	CollisionData->MaterialIndices.SetNumZeroed(NumTriangles);
+
 	CollisionData->bFlipNormals = true;
 	CollisionData->bDeformableMesh = true;
 	CollisionData->bFastCook = true;
@@ -834,6 +1454,12 @@ void UHoloMeshComponent::UpdateCollision()
 {
 	//SCOPE_CYCLE_COUNTER(STAT_HoloMesh_UpdateCollision);
 
+	// Proxy collision is swapped in SetCollisionProxy and there is nothing to cook with collision off.
+	if (CollisionMode != EHoloMeshCollisionMode::Full)
+	{
+		return;
+	}
+
 	UWorld* World = GetWorld();
 	const bool bUseAsyncCook = World && World->IsGameWorld() && bUseAsyncCooking;
 
@@ -906,6 +1532,61 @@ void UHoloMeshComponent::FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* Finis
 	}
 }
 
+void UHoloMeshComponent::SetCollisionProxy(int ProxyIndex, const TArray<FVector>& HullPoints)
+{
+	if (CollisionMode != EHoloMeshCollisionMode::Proxy)
+	{
+		return;
+	}
+
+	UBodySetup** CachedProxy = CollisionProxies.Find(ProxyIndex);
+	UBodySetup* ProxyBodySetup = CachedProxy ? *CachedProxy : nullptr;
+	if (ProxyBodySetup == nullptr)
+	{
+		if (HullPoints.Num() < 4)
+		{
+			return;
+		}
+
+		ProxyBodySetup = CreateBodySetupHelper();
+		ProxyBodySetup->CollisionTraceFlag = CTF_UseSimpleAsComplex;
+
+		FKConvexElem HullElem;
+		HullElem.VertexData = HullPoints;
+		HullElem.UpdateElemBox();
+		ProxyBodySetup->AggGeom.ConvexElems.Add(HullElem);
+
+		ProxyBodySetup->bHasCookedCollisionData = true;
+		ProxyBodySetup->InvalidatePhysicsData();
+		ProxyBodySetup->CreatePhysicsMeshes();
+		CollisionProxies.Add(ProxyIndex, ProxyBodySetup);
+	}
+
+	if (ProcMeshBodySetup != ProxyBodySetup)
+	{
+		ProcMeshBodySetup = ProxyBodySetup;
+		RecreatePhysicsState();
+	}
+}
+
+void UHoloMeshComponent::ClearCollisionProxies()
+{
+	if (CollisionProxies.Num() == 0)
+	{
+		return;
+	}
+
+	for (const TPair<int32, UBodySetup*>& Proxy : CollisionProxies)
+	{
+		if (Proxy.Value == ProcMeshBodySetup)
+		{
+			ProcMeshBodySetup = nullptr;
+			RecreatePhysicsState();
+		}
+	}
+	CollisionProxies.Empty();
+}
+
 UBodySetup* UHoloMeshComponent::GetBodySetup()
 {
 	CreateProcMeshBodySetup();
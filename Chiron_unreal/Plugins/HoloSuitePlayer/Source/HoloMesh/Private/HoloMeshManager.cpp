@@ -24,8 +24,90 @@ static TAutoConsoleVariable<bool> CVarEnableHoloMeshStats(
 	TEXT("Displays render statistics for HoloMeshes."),
 	ECVF_Default);
 
+// Zero disables the decoded frame cache.
+static TAutoConsoleVariable<int32> CVarDecodedFrameCacheBudget(
+	TEXT("r.HoloMesh.DecodedFrameCache.BudgetMB"),
+	0,
+	TEXT("Memory shared by the decoded frame caches of every HoloMesh. Looping clips that fit are decoded once\n")
+	TEXT("and replayed from the cache, least recently used caches are evicted when it's exceeded."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarDecodedFrameCacheMaxClip(
+	TEXT("r.HoloMesh.DecodedFrameCache.MaxClipMB"),
+	64,
+	TEXT("Largest decoded frame cache a single clip may use, longer clips are always decoded."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarGovernor(
+	TEXT("r.HoloMesh.Governor"),
+	false,
+	TEXT("Lowers HoloMesh quality in steps while decoding falls behind: update rate of distant meshes first,\n")
+	TEXT("then their texture updates, then a LOD bias on every mesh. Quality comes back once there's headroom\n")
+	TEXT("for the level above, estimated from how much stepping down from it saved."),
+	ECVF_Default);
+
+// Time a level has to run before its load is taken as what stepping down to it saved.
+static const double GovernorSettleTime = 1.0;
+
+// Zero leaves frame time out of the governor's decisions.
+static TAutoConsoleVariable<float> CVarGovernorTargetFrameTime(
+	TEXT("r.HoloMesh.Governor.TargetFrameMS"),
+	0.0f,
+	TEXT("Average game frame time the governor lowers quality above."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGovernorMaxIOLatency(
+	TEXT("r.HoloMesh.Governor.MaxIOLatencyMS"),
+	100.0f,
+	TEXT("Average read latency the governor lowers quality above, zero ignores it."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGovernorMaxQueuedWork(
+	TEXT("r.HoloMesh.Governor.MaxQueuedWork"),
+	0,
+	TEXT("Work requests waiting for a HoloMesh worker the governor lowers quality above. Zero uses 4 per worker thread.\n")
+	TEXT("Applies to the IO and decode pools separately."),
+	ECVF_Default);
+
+// Thread pools are created once when the manager initializes, changes to these take effect on the next run.
+static TAutoConsoleVariable<int32> CVarIOThreads(
+	TEXT("r.HoloMesh.IOThreads"),
+	2,
+	TEXT("Threads that issue and wait on AVV and OMS reads. Zero or less uses 1."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarIOThreadPriority(
+	TEXT("r.HoloMesh.IOThreadPriority"),
+	(int32)TPri_AboveNormal,
+	TEXT("EThreadPriority of the IO threads: 0 Normal, 1 AboveNormal, 2 BelowNormal, 3 Highest, 4 Lowest, 5 SlightlyBelowNormal, 6 TimeCritical."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<FString> CVarIOThreadAffinity(
+	TEXT("r.HoloMesh.IOThreadAffinity"),
+	TEXT(""),
+	TEXT("Core mask the IO threads are kept on, e.g. 0xF0. Empty uses the engine's pool thread mask."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarDecodeThreads(
+	TEXT("r.HoloMesh.DecodeThreads"),
+	0,
+	TEXT("Threads that decode meshes on the CPU. Zero uses the engine's worker thread count."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarDecodeThreadPriority(
+	TEXT("r.HoloMesh.DecodeThreadPriority"),
+	(int32)TPri_Normal,
+	TEXT("EThreadPriority of the decode threads, see r.HoloMesh.IOThreadPriority."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<FString> CVarDecodeThreadAffinity(
+	TEXT("r.HoloMesh.DecodeThreadAffinity"),
+	TEXT(""),
+	TEXT("Core mask the decode threads are kept on, e.g. 0xF0. Empty uses the engine's pool thread mask."),
+	ECVF_ReadOnly);
+
 HoloMeshManager::HoloMeshManager()
-	: MemoryPool(nullptr), ThreadPool(nullptr)
+	: MemoryPool(nullptr)
 {
     bInitialized = false;
 	queuePosition = 0;
@@ -45,10 +127,32 @@ void HoloMeshManager::Initialize()
 		bUseTickUpdates = true;
 #endif
 
-		// Allocate thread pool.
-		ThreadPool = FQueuedThreadPool::Allocate();
-		int32 NumThreadsInThreadPool = FPlatformMisc::NumberOfWorkerThreadsToSpawn();
-		verify(ThreadPool->Create(NumThreadsInThreadPool, 32768U, TPri_Normal, TEXT("HoloMeshThreadPool")));
+		// Allocate thread pools, reads are kept apart from decoding so blocking IO never holds a decode thread.
+		auto CreateThreadPool = [this](EHoloMeshWorkType workType, int32 numThreads, int32 priority, const FString& affinity, const TCHAR* name)
+		{
+			numThreads = FMath::Max(numThreads, 1);
+			EThreadPriority threadPriority = (EThreadPriority)FMath::Clamp(priority, 0, (int32)TPri_Num - 1);
+
+			FQueuedThreadPool* pool = FQueuedThreadPool::Allocate();
+			verify(pool->Create(numThreads, 32768U, threadPriority, name));
+
+			ThreadPools[(int)workType] = pool;
+			workerThreadCounts[(int)workType] = numThreads;
+			workerAffinityMasks[(int)workType] = affinity.IsEmpty() ? 0 : FCString::Strtoui64(*affinity, nullptr, 0);
+
+			UE_LOG(LogHoloMesh, Log, TEXT("%s: %d threads, priority %d, affinity 0x%llx"), name, numThreads, (int32)threadPriority, workerAffinityMasks[(int)workType]);
+		};
+
+		int32 numDecodeThreads = CVarDecodeThreads.GetValueOnGameThread();
+		if (numDecodeThreads <= 0)
+		{
+			numDecodeThreads = FPlatformMisc::NumberOfWorkerThreadsToSpawn();
+		}
+
+		CreateThreadPool(EHoloMeshWorkType::IO, CVarIOThreads.GetValueOnGameThread(), CVarIOThreadPriority.GetValueOnGameThread(),
+			CVarIOThreadAffinity.GetValueOnGameThread(), TEXT("HoloMeshIOThreadPool"));
+		CreateThreadPool(EHoloMeshWorkType::Decode, numDecodeThreads, CVarDecodeThreadPriority.GetValueOnGameThread(),
+			CVarDecodeThreadAffinity.GetValueOnGameThread(), TEXT("HoloMeshDecodeThreadPool"));
 
 		// Allocate memory pools
 		MemoryPool = new FHoloMemoryPool();
@@ -199,6 +303,7 @@ void HoloMeshManager::Unregister(FGuid registeredGUID)
 	if (RegisteredMeshes.Contains(registeredGUID))
 	{
 		ClearRequests(registeredGUID);
+		managerStats.totalFrameCacheBytes -= RegisteredMeshes[registeredGUID].decodedFrameCacheBytes;
 		RegisteredMeshes.Remove(registeredGUID);
 
 #if HOLOMESH_MANAGER_DEBUG
@@ -276,6 +381,97 @@ void HoloMeshManager::FreeUnusedMemory()
 	}
 }
 
+bool HoloMeshManager::ReserveDecodedFrameCache(FGuid holoMeshGUID, size_t sizeInBytes)
+{
+	size_t budgetBytes = (size_t)FMath::Max(CVarDecodedFrameCacheBudget.GetValueOnGameThread(), 0) * 1024 * 1024;
+	size_t maxClipBytes = (size_t)FMath::Max(CVarDecodedFrameCacheMaxClip.GetValueOnGameThread(), 0) * 1024 * 1024;
+	if (!bInitialized || sizeInBytes > budgetBytes || sizeInBytes > maxClipBytes)
+	{
+		return false;
+	}
+
+	TArray<UHoloMeshComponent*> evicted;
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		FRegisteredHoloMesh* entry = RegisteredMeshes.Find(holoMeshGUID);
+		if (entry == nullptr)
+		{
+			return false;
+		}
+
+		// Oldest first, until the new size fits. Caches that are being filled or played
+		// back right now are left alone, evicting them would only have them fill again.
+		double now = FPlatformTime::Seconds();
+		size_t requiredBytes = managerStats.totalFrameCacheBytes - entry->decodedFrameCacheBytes + sizeInBytes;
+		while (requiredBytes > budgetBytes)
+		{
+			FRegisteredHoloMesh* oldest = nullptr;
+			for (auto& kv : RegisteredMeshes)
+			{
+				FRegisteredHoloMesh& item = kv.Value;
+				if (kv.Key != holoMeshGUID && item.decodedFrameCacheBytes > 0 && !evicted.Contains(item.component)
+					&& now - item.decodedFrameCacheLastUse > 1.0
+					&& (oldest == nullptr || item.decodedFrameCacheLastUse < oldest->decodedFrameCacheLastUse))
+				{
+					oldest = &item;
+				}
+			}
+
+			if (oldest == nullptr)
+			{
+				return false;
+			}
+
+			requiredBytes -= oldest->decodedFrameCacheBytes;
+			evicted.Add(oldest->component);
+		}
+
+		managerStats.totalFrameCacheBytes += sizeInBytes - entry->decodedFrameCacheBytes;
+		entry->decodedFrameCacheBytes = sizeInBytes;
+		entry->decodedFrameCacheLastUse = now;
+	}
+
+	// Evicted caches release themselves through ReleaseDecodedFrameCache.
+	for (UHoloMeshComponent* component : evicted)
+	{
+		if (component != nullptr)
+		{
+			component->FreeDecodedFrameCache();
+		}
+	}
+
+	return true;
+}
+
+bool HoloMeshManager::IsDecodedFrameCacheEnabled() const
+{
+	return CVarDecodedFrameCacheBudget.GetValueOnGameThread() > 0;
+}
+
+void HoloMeshManager::ReleaseDecodedFrameCache(FGuid holoMeshGUID)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	FRegisteredHoloMesh* entry = RegisteredMeshes.Find(holoMeshGUID);
+	if (entry != nullptr)
+	{
+		managerStats.totalFrameCacheBytes -= entry->decodedFrameCacheBytes;
+		entry->decodedFrameCacheBytes = 0;
+	}
+}
+
+void HoloMeshManager::TouchDecodedFrameCache(FGuid holoMeshGUID)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	FRegisteredHoloMesh* entry = RegisteredMeshes.Find(holoMeshGUID);
+	if (entry != nullptr)
+	{
+		entry->decodedFrameCacheLastUse = FPlatformTime::Seconds();
+	}
+}
+
 void HoloMeshManager::AddUpdateRequest(FGuid holoMeshGUID, int holoMeshIndex, int segmentIndex, int frameIndex)
 {
 	if (!holoMeshGUID.IsValid())
@@ -324,18 +520,18 @@ void HoloMeshManager::AddUpdateRequest(FGuid holoMeshGUID, int holoMeshIndex, in
 	UpdateRequestQueue.Add(request);
 }
 
-void HoloMeshManager::AddWorkRequest(FGuid holoMeshGUID, int segmentIndex, int frameIndex)
+bool HoloMeshManager::AddWorkRequest(FGuid holoMeshGUID, int segmentIndex, int frameIndex, EHoloMeshWorkType workType)
 {
 	if (!bInitialized)
 	{
 		UE_LOG(LogHoloMesh, Error, TEXT("Rejecting work request before HoloMeshManager is initialized: %s"), *holoMeshGUID.ToString());
-		return;
+		return false;
 	}
 
 	if (!holoMeshGUID.IsValid())
 	{
 		UE_LOG(LogHoloMesh, Error, TEXT("Rejecting work request for invalid GUID: %s on frame %d."), *holoMeshGUID.ToString(), GFrameNumber);
-		return;
+		return false;
 	}
 
 	FScopeLock Lock(&CriticalSection);
@@ -343,20 +539,28 @@ void HoloMeshManager::AddWorkRequest(FGuid holoMeshGUID, int segmentIndex, int f
 	if (!RegisteredMeshes.Contains(holoMeshGUID))
 	{
 		UE_LOG(LogHoloMesh, Error, TEXT("Rejecting work request for invalid GUID: %s on frame %d."), *holoMeshGUID.ToString(), GFrameNumber);
-		return;
+		return false;
 	}
 
 	FRegisteredHoloMesh& item = RegisteredMeshes[holoMeshGUID];
 	if (!item.IsValid())
 	{
-		return;
+		return false;
 	}
 
 	FHoloMeshWorkRequest* HoloMeshWork = WorkRequestPool->Next();
 	HoloMeshWork->RegisteredGUID = holoMeshGUID;
 	HoloMeshWork->SegmentIndex = segmentIndex;
 	HoloMeshWork->FrameIndex = frameIndex;
-	ThreadPool->AddQueuedWork(HoloMeshWork);
+	HoloMeshWork->WorkType = workType;
+	managerStats.queuedWorkRequests[(int)workType]++;
+	ThreadPools[(int)workType]->AddQueuedWork(HoloMeshWork);
+	return true;
+}
+
+void HoloMeshManager::DequeueWorkRequest(FHoloMeshWorkRequest* request)
+{
+	managerStats.queuedWorkRequests[(int)request->WorkType]--;
 }
 
 void HoloMeshManager::FinishWorkRequest(FHoloMeshWorkRequest* request)
@@ -543,6 +747,7 @@ void HoloMeshManager::ProcessRequests(FRDGBuilder& GraphBuilder)
 
 		// Process as many requests as possible depending on FrameUpdateLimit.
 		bool limitReached = false;
+		int limitDeferred = 0;
 		TArray<FHoloMeshUpdateRequest> deferredUpdates;
 
 		while (!updateQueue.IsEmpty())
@@ -561,7 +766,10 @@ void HoloMeshManager::ProcessRequests(FRDGBuilder& GraphBuilder)
 				continue;
 			}
 
-			if (!limitReached)
+			// The governor has meshes beyond LOD 0 skip frames before anything else degrades.
+			bool throttled = item.framesSinceUpdate + 1 < GetUpdateInterval(item.LOD);
+
+			if (!limitReached && !throttled)
 			{
 				double updateStart = FPlatformTime::Seconds() * 1000.0;
 				item.component->Update_RenderThread(GraphBuilder, UpdateRequest);
@@ -576,6 +784,7 @@ void HoloMeshManager::ProcessRequests(FRDGBuilder& GraphBuilder)
 			{
 				deferredUpdates.Add(UpdateRequest);
 				item.framesSinceUpdate++;
+				limitDeferred += limitReached ? 1 : 0;
 			}
 
 			// Throttle update time if desired.
@@ -591,6 +800,7 @@ void HoloMeshManager::ProcessRequests(FRDGBuilder& GraphBuilder)
 		}
 
 		managerStats.updateTimeAverage.Add((FPlatformTime::Seconds() * 1000.0) - executeStart);
+		managerStats.deferredUpdates = limitDeferred;
 
 		UpdateRequestQueue.Empty();
 		UpdateRequestQueue = deferredUpdates;
@@ -681,6 +891,13 @@ void HoloMeshManager::UpdateStats(FSceneView* sceneView)
 		managerStats.uploadBytesPerSecond = managerStats.totalUploadBytes.load() - managerStats.lastUploadBytes;
 		managerStats.lastUploadBytes = managerStats.totalUploadBytes.load();
 
+		for (int stream = 0; stream < (int)EHoloMeshUploadStream::Count; ++stream)
+		{
+			size_t streamBytes = managerStats.totalStreamUploadBytes[stream].load();
+			managerStats.streamUploadBytesPerSecond[stream] = streamBytes - managerStats.lastStreamUploadBytes[stream];
+			managerStats.lastStreamUploadBytes[stream] = streamBytes;
+		}
+
 		managerStats.ioBytesPerSecond = managerStats.totalIOBytes.load() - managerStats.ioLastBytes;
 		managerStats.ioLastBytes = managerStats.totalIOBytes.load();
 	}
@@ -738,6 +955,27 @@ void HoloMeshManager::UpdateStats(FSceneView* sceneView)
 				managerStats.lodCounts[item.LOD]++;
 			}
 		}
+
+		// Instances don't decode anything themselves so a visible instance keeps
+		// its source updating, at the finest LOD any of them is drawn at.
+		for (auto& kv : RegisteredMeshes)
+		{
+			FRegisteredHoloMesh& item = kv.Value;
+			if (!item.IsValid() || !item.visible)
+			{
+				continue;
+			}
+
+			UHoloMeshComponent* source = item.component->GetInstanceSource();
+			if (source == nullptr || !RegisteredMeshes.Contains(source->RegisteredGUID))
+			{
+				continue;
+			}
+
+			FRegisteredHoloMesh& sourceItem = RegisteredMeshes[source->RegisteredGUID];
+			sourceItem.visible = true;
+			sourceItem.LOD = FMath::Min(sourceItem.LOD, item.LOD);
+		}
 	}
 
 	const int32 ArcturusDebugMessageKey = 65 + 82 + 67 + 84 + 85 + 82 + 85 + 83;
@@ -750,11 +988,12 @@ void HoloMeshManager::UpdateStats(FSceneView* sceneView)
 		int textureMB   = FUnitConversion::Convert(managerStats.totalTextureBytes.load(), EUnit::Bytes, EUnit::Megabytes);
 		int containerMB = FUnitConversion::Convert(managerStats.totalContainerBytes.load(), EUnit::Bytes, EUnit::Megabytes);
 		int blockPoolMB = FUnitConversion::Convert(FHoloMemoryBlock::TotalAllocatedBytes.load(), EUnit::Bytes, EUnit::Megabytes);
+		int frameCacheMB = FUnitConversion::Convert(managerStats.totalFrameCacheBytes.load(), EUnit::Bytes, EUnit::Megabytes);
 		
 		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 100, dbgTime, FColor::Green, FString::Printf(TEXT("HoloMesh Manager")), true, FVector2D(1.f, 1.f));
 		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 101, dbgTime, FColor::Green, FString::Printf(TEXT("  FPS: %.2f | Update Avg: %.2f ms Max: %.2f ms"), managerStats.averageFPS, managerStats.updateTimeAverage.GetAverage(), managerStats.updateTimeAverage.GetMax()), true, FVector2D(1.f, 1.f));
-		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 102, dbgTime, FColor::Green, FString::Printf(TEXT("  Visible: %d | LOD 0: %d | LOD 1: %d | LOD 2: %d"), managerStats.visibleMeshes, managerStats.lodCounts[0], managerStats.lodCounts[1], managerStats.lodCounts[2]), true, FVector2D(1.f, 1.f));
-		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 103, dbgTime, FColor::Green, FString::Printf(TEXT("  Meshes: %d mb | Textures: %d mb | Containers: %d/%d mb"), meshMB, textureMB, containerMB, blockPoolMB), true, FVector2D(1.f, 1.f));
+		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 102, dbgTime, FColor::Green, FString::Printf(TEXT("  Visible: %d | LOD 0: %d | LOD 1: %d | LOD 2: %d | Quality: %s"), managerStats.visibleMeshes, managerStats.lodCounts[0], managerStats.lodCounts[1], managerStats.lodCounts[2], *UEnum::GetValueAsString(qualityLevel.load())), true, FVector2D(1.f, 1.f));
+		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 103, dbgTime, FColor::Green, FString::Printf(TEXT("  Meshes: %d mb | Textures: %d mb | Containers: %d/%d mb | Frame Cache: %d/%d mb"), meshMB, textureMB, containerMB, blockPoolMB, frameCacheMB, CVarDecodedFrameCacheBudget.GetValueOnRenderThread()), true, FVector2D(1.f, 1.f));
 
 		if (bImmediateMode)
 		{
@@ -768,9 +1007,18 @@ void HoloMeshManager::UpdateStats(FSceneView* sceneView)
 
 		int ioMBPS = FUnitConversion::Convert(managerStats.ioBytesPerSecond, EUnit::Bytes, EUnit::Megabytes);
 		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 105, dbgTime, FColor::Green, FString::Printf(TEXT("  I/O Read: %d mb/s | I/O Avg: %.4f ms | I/O Max: %.4f ms"), ioMBPS, managerStats.ioAverageTime.GetAverage(), managerStats.ioAverageTime.GetMax()), true, FVector2D(1.f, 1.f));
+		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 119, dbgTime, FColor::Green, FString::Printf(TEXT("  Queued Work: I/O %d (%d threads) | Decode %d (%d threads)"),
+			managerStats.queuedWorkRequests[(int)EHoloMeshWorkType::IO].load(), workerThreadCounts[(int)EHoloMeshWorkType::IO],
+			managerStats.queuedWorkRequests[(int)EHoloMeshWorkType::Decode].load(), workerThreadCounts[(int)EHoloMeshWorkType::Decode]), true, FVector2D(1.f, 1.f));
 
 		int uploadMBPS = FUnitConversion::Convert(managerStats.uploadBytesPerSecond, EUnit::Bytes, EUnit::Megabytes);
-		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 106, dbgTime, FColor::Green, FString::Printf(TEXT("  GPU Upload: %d mb/s"), uploadMBPS), true, FVector2D(1.f, 1.f));
+		auto streamKBPS = [this](EHoloMeshUploadStream stream)
+		{
+			return (int)FUnitConversion::Convert(managerStats.streamUploadBytesPerSecond[(int)stream], EUnit::Bytes, EUnit::Kilobytes);
+		};
+		GEngine->AddOnScreenDebugMessage(ArcturusDebugMessageKey + 106, dbgTime, FColor::Green, FString::Printf(TEXT("  GPU Upload: %d mb/s | Idx: %d kb/s | Pos: %d kb/s | Nrm: %d kb/s | Col: %d kb/s | UV: %d kb/s"),
+			uploadMBPS, streamKBPS(EHoloMeshUploadStream::Indices), streamKBPS(EHoloMeshUploadStream::Positions), streamKBPS(EHoloMeshUploadStream::Normals),
+			streamKBPS(EHoloMeshUploadStream::Colors), streamKBPS(EHoloMeshUploadStream::UVs)), true, FVector2D(1.f, 1.f));
 
 		// Player Update Times
 		{
@@ -825,6 +1073,8 @@ void HoloMeshManager::Tick(float DeltaSeconds)
 
 	lastFrameNumber = GFrameNumber;
 
+	UpdateGovernor(DeltaSeconds);
+
 	if (MemoryPool != nullptr && FPlatformTime::Seconds() - lastMemoryCleanUpTime > 0.25)
 	{
 		AsyncTask(ENamedThreads::AnyThread, [this]
@@ -836,6 +1086,122 @@ void HoloMeshManager::Tick(float DeltaSeconds)
 	}
 }
 
+void HoloMeshManager::UpdateGovernor(float DeltaSeconds)
+{
+	if (!CVarGovernor.GetValueOnGameThread() || bImmediateMode)
+	{
+		qualityLevel = EHoloMeshQualityLevel::Full;
+		governorPressureTime = 0.0;
+		governorHeadroomTime = 0.0;
+		governorLevelTime = 0.0;
+		return;
+	}
+
+	managerStats.frameTimeAverage.Add(DeltaSeconds * 1000.0f);
+
+	// Each stage of the pipeline as a fraction of what it's allowed, the busiest one decides.
+	float load = 0.0f;
+
+	float targetFrameMS = CVarGovernorTargetFrameTime.GetValueOnGameThread();
+	if (targetFrameMS > 0.0f)
+	{
+		load = FMath::Max(load, managerStats.frameTimeAverage.GetAverage() / targetFrameMS);
+	}
+
+	float maxIOLatencyMS = CVarGovernorMaxIOLatency.GetValueOnGameThread();
+	if (maxIOLatencyMS > 0.0f)
+	{
+		load = FMath::Max(load, managerStats.ioAverageTime.GetAverage() / maxIOLatencyMS);
+	}
+
+	for (int workType = 0; workType < (int)EHoloMeshWorkType::Count; ++workType)
+	{
+		int maxQueuedWork = CVarGovernorMaxQueuedWork.GetValueOnGameThread();
+		if (maxQueuedWork <= 0)
+		{
+			maxQueuedWork = workerThreadCounts[workType] * 4;
+		}
+		if (maxQueuedWork > 0)
+		{
+			load = FMath::Max(load, (float)managerStats.queuedWorkRequests[workType].load() / maxQueuedWork);
+		}
+	}
+
+	if (frameUpdateLimit > 0.0f)
+	{
+		load = FMath::Max(load, (float)managerStats.updateTimeAverage.GetAverage() / frameUpdateLimit);
+	}
+
+	// Updates pushed to the next frame by frameUpdateLimit are the stutter this is meant to replace.
+	if (managerStats.deferredUpdates > 0)
+	{
+		load = FMath::Max(load, 1.0f);
+	}
+
+	EHoloMeshQualityLevel level = qualityLevel;
+	governorLevelTime += DeltaSeconds;
+
+	// Once a level has settled its load is what stepping down to it left, stepping back up is
+	// expected to scale the load by the ratio of the level above's load to it.
+	float restoredLoad = load;
+	if (level > EHoloMeshQualityLevel::Full)
+	{
+		int upperLevel = (int)level - 1;
+		if (governorSettledLoads[upperLevel] < 0.0f && governorLevelTime > GovernorSettleTime)
+		{
+			governorSettledLoads[upperLevel] = load;
+		}
+
+		if (governorSettledLoads[upperLevel] < 0.0f)
+		{
+			restoredLoad = 1.0f;
+		}
+		else
+		{
+			float costRatio = governorStepDownLoads[upperLevel] / FMath::Max(governorSettledLoads[upperLevel], 0.05f);
+			restoredLoad = load * FMath::Clamp(costRatio, 1.0f, 4.0f);
+		}
+	}
+
+	// Steps down quickly under sustained load and back up slowly, and only once the level above
+	// is expected to fit, so it doesn't oscillate.
+	if (load >= 1.0f)
+	{
+		governorPressureTime += DeltaSeconds;
+		governorHeadroomTime = 0.0;
+	}
+	else if (restoredLoad < 0.75f)
+	{
+		governorHeadroomTime += DeltaSeconds;
+		governorPressureTime = 0.0;
+	}
+	else
+	{
+		governorPressureTime = 0.0;
+		governorHeadroomTime = 0.0;
+	}
+
+	if (governorPressureTime > 0.25 && level < EHoloMeshQualityLevel::LODBias)
+	{
+		governorStepDownLoads[(int)level] = load;
+		governorSettledLoads[(int)level] = -1.0f;
+		level = (EHoloMeshQualityLevel)((uint8)level + 1);
+	}
+	else if (governorHeadroomTime > 2.0 && level > EHoloMeshQualityLevel::Full)
+	{
+		level = (EHoloMeshQualityLevel)((uint8)level - 1);
+	}
+
+	if (level != qualityLevel)
+	{
+		UE_LOG(LogHoloMesh, Display, TEXT("HoloMesh quality level: %s (Load: %.2f, Restored Load: %.2f)"), *UEnum::GetValueAsString(level), load, restoredLoad);
+		qualityLevel = level;
+		governorPressureTime = 0.0;
+		governorHeadroomTime = 0.0;
+		governorLevelTime = 0.0;
+	}
+}
+
 #if ENGINE_MAJOR_VERSION == 5
 void HoloMeshManager::BeginFrame(FRDGBuilder& GraphBuilder)
 {
@@ -891,12 +1257,34 @@ float UHoloMeshManagerBlueprintLibrary::GetAverageIOTime()
 	return GHoloMeshManager.GetAverageIOTime();
 }
 
+EHoloMeshQualityLevel UHoloMeshManagerBlueprintLibrary::GetQualityLevel()
+{
+	return GHoloMeshManager.GetQualityLevel();
+}
+
+void HoloMeshManager::ApplyWorkerAffinity(EHoloMeshWorkType workType)
+{
+	// FQueuedThreadPool creates its threads with the engine's pool mask, so each one moves
+	// itself the first time it picks up work. A thread only ever serves one pool.
+	static thread_local uint64 appliedAffinityMask = 0;
+
+	uint64 affinityMask = workerAffinityMasks[(int)workType];
+	if (affinityMask != 0 && affinityMask != appliedAffinityMask)
+	{
+		FPlatformProcess::SetThreadAffinityMask(affinityMask);
+		appliedAffinityMask = affinityMask;
+	}
+}
+
 void FHoloMeshWorkRequest::DoThreadedWork()
 {
+	GHoloMeshManager.DequeueWorkRequest(this);
+	GHoloMeshManager.ApplyWorkerAffinity(WorkType);
+
 	FRegisteredHoloMesh* registeredMesh = GHoloMeshManager.GetRegisteredMesh(RegisteredGUID);
 	if (registeredMesh && registeredMesh->IsValid())
 	{
-		registeredMesh->component->DoThreadedWork(SegmentIndex, FrameIndex);
+		registeredMesh->component->DoThreadedWork(SegmentIndex, FrameIndex, WorkType);
 	}
 	GHoloMeshManager.FinishWorkRequest(this);
 }
@@ -904,5 +1292,6 @@ void FHoloMeshWorkRequest::DoThreadedWork()
 void FHoloMeshWorkRequest::Abandon()
 {
 	UE_LOG(LogHoloMesh, Warning, TEXT("HoloMesh Threaded Work Abandoned."));
+	GHoloMeshManager.DequeueWorkRequest(this);
 	GHoloMeshManager.FinishWorkRequest(this);
 }
\ No newline at end of file
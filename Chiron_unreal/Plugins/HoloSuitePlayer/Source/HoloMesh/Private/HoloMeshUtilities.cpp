@@ -17,6 +17,19 @@ BEGIN_SHADER_PARAMETER_STRUCT(FCopyTextureParameters, )
 	RDG_TEXTURE_ACCESS(Input, ERHIAccess::CopySrc)
 END_SHADER_PARAMETER_STRUCT()
 
+BEGIN_SHADER_PARAMETER_STRUCT(FCopyToTextureParameters, )
+	RDG_TEXTURE_ACCESS(Output, ERHIAccess::CopyDest)
+END_SHADER_PARAMETER_STRUCT()
+
+// Vector paths for the BC4 block decoder, other platforms use the scalar loop.
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#define HOLOMESH_BC4_NEON 1
+#elif PLATFORM_ALWAYS_HAS_SSE4_1
+#include <smmintrin.h>
+#define HOLOMESH_BC4_SSE 1
+#endif
+
 #if (ENGINE_MAJOR_VERSION == 5)
 #define LOCK_VERT_BUFFER LockBuffer
 #define UNLOCK_VERT_BUFFER UnlockBuffer
@@ -96,17 +109,17 @@ void HoloMeshUtilities::UploadBuffer(FRDGBuilder& GraphBuilder, FRDGBufferRef Bu
 	GHoloMeshManager.AddUploadBytes(SizeInBytes);
 }
 
-bool HoloMeshUtilities::UploadVertexBuffer(FHoloMeshVertexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList)
+bool HoloMeshUtilities::UploadVertexBuffer(FHoloMeshVertexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList, uint32 OffsetInBytes)
 {
 	void* Buffer = nullptr;
 
 	if (RHICmdList != nullptr)
 	{
-		Buffer = RHICmdList->LOCK_VERT_BUFFER(BufferRHI, 0, SizeInBytes, RLM_WriteOnly);
+		Buffer = RHICmdList->LOCK_VERT_BUFFER(BufferRHI, OffsetInBytes, SizeInBytes, RLM_WriteOnly);
 	}
 	else
 	{
-		Buffer = RHI_LOCK_VERT_BUFFER(BufferRHI, 0, SizeInBytes, RLM_WriteOnly);
+		Buffer = RHI_LOCK_VERT_BUFFER(BufferRHI, OffsetInBytes, SizeInBytes, RLM_WriteOnly);
 	}
 
 	if (Buffer != nullptr)
@@ -126,17 +139,17 @@ bool HoloMeshUtilities::UploadVertexBuffer(FHoloMeshVertexBufferRHIRef BufferRHI
 	return true;
 }
 
-bool HoloMeshUtilities::UploadIndexBuffer(FHoloMeshIndexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList)
+bool HoloMeshUtilities::UploadIndexBuffer(FHoloMeshIndexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList, uint32 OffsetInBytes)
 {
 	void* Buffer = nullptr;
 
 	if (RHICmdList != nullptr)
 	{
-		Buffer = RHICmdList->LOCK_INDEX_BUFFER(BufferRHI, 0, SizeInBytes, RLM_WriteOnly);
+		Buffer = RHICmdList->LOCK_INDEX_BUFFER(BufferRHI, OffsetInBytes, SizeInBytes, RLM_WriteOnly);
 	}
 	else
 	{
-		Buffer = RHI_LOCK_INDEX_BUFFER(BufferRHI, 0, SizeInBytes, RLM_WriteOnly);
+		Buffer = RHI_LOCK_INDEX_BUFFER(BufferRHI, OffsetInBytes, SizeInBytes, RLM_WriteOnly);
 	}
 
 	if (Buffer != nullptr)
@@ -256,4 +269,308 @@ void HoloMeshUtilities::CopyTexture(FRDGBuilder& GraphBuilder, FIntVector Size,
 			RHICmdList.Transition(FRHITransitionInfo(DestTexture, ERHIAccess::CopyDest, ERHIAccess::SRVGraphics));
 		});
 #endif
+}
+
+void HoloMeshUtilities::CopyTexture(FRDGBuilder& GraphBuilder, FIntVector Size, FTexture2DRHIRef SourceTexture, int SourceMip, FRDGTextureRef DestRDGTexture, int DestMip)
+{
+	FCopyToTextureParameters* Parameters = GraphBuilder.AllocParameters<FCopyToTextureParameters>();
+	Parameters->Output = DestRDGTexture;
+
+	FRHICopyTextureInfo CopyInfo;
+	CopyInfo.Size = Size;
+	CopyInfo.SourceMipIndex = SourceMip;
+	CopyInfo.DestMipIndex = DestMip;
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("HoloMeshUtilities.CopyTexture"),
+		Parameters,
+		ERDGPassFlags::Copy | ERDGPassFlags::NeverCull,
+		[SourceTexture, DestRDGTexture, CopyInfo](FRHICommandList& RHICmdList)
+		{
+			RHICmdList.Transition(FRHITransitionInfo(SourceTexture, ERHIAccess::SRVMask, ERHIAccess::CopySrc));
+			RHICmdList.CopyTexture(SourceTexture, DestRDGTexture->GetRHI(), CopyInfo);
+			RHICmdList.Transition(FRHITransitionInfo(SourceTexture, ERHIAccess::CopySrc, ERHIAccess::SRVMask));
+		});
+}
+
+void HoloMeshUtilities::CopyTexture(FRDGBuilder& GraphBuilder, FTexture2DRHIRef SourceTexture, FTexture2DRHIRef DestTexture)
+{
+	if (!SourceTexture.IsValid() || !DestTexture.IsValid() || SourceTexture->GetSizeXY() != DestTexture->GetSizeXY())
+	{
+		return;
+	}
+
+	FRHICopyTextureInfo CopyInfo;
+	CopyInfo.NumMips = FMath::Min(SourceTexture->GetNumMips(), DestTexture->GetNumMips());
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("HoloMeshUtilities.CopyTexture"),
+		ERDGPassFlags::None | ERDGPassFlags::NeverCull,
+		[SourceTexture, DestTexture, CopyInfo](FRHICommandListImmediate& RHICmdList)
+		{
+			RHICmdList.Transition({
+				FRHITransitionInfo(SourceTexture, ERHIAccess::SRVMask, ERHIAccess::CopySrc),
+				FRHITransitionInfo(DestTexture, ERHIAccess::SRVMask, ERHIAccess::CopyDest) });
+			RHICmdList.CopyTexture(SourceTexture, DestTexture, CopyInfo);
+			RHICmdList.Transition({
+				FRHITransitionInfo(SourceTexture, ERHIAccess::CopySrc, ERHIAccess::SRVMask),
+				FRHITransitionInfo(DestTexture, ERHIAccess::CopyDest, ERHIAccess::SRVMask) });
+		});
+}
+
+void HoloMeshUtilities::CopyBuffer(FRDGBuilder& GraphBuilder, FHoloMeshBufferRHIRef SourceBuffer, FHoloMeshBufferRHIRef DestBuffer, uint32 SizeInBytes)
+{
+	if (!SourceBuffer.IsValid() || !DestBuffer.IsValid() || SizeInBytes == 0)
+	{
+		return;
+	}
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("HoloMeshUtilities.CopyBuffer"),
+		ERDGPassFlags::None | ERDGPassFlags::NeverCull,
+		[SourceBuffer, DestBuffer, SizeInBytes](FRHICommandListImmediate& RHICmdList)
+		{
+			RHICmdList.Transition({
+				FRHITransitionInfo(SourceBuffer, ERHIAccess::SRVMask, ERHIAccess::CopySrc),
+				FRHITransitionInfo(DestBuffer, ERHIAccess::SRVMask, ERHIAccess::CopyDest) });
+			RHICmdList.CopyBufferRegion(DestBuffer, 0, SourceBuffer, 0, SizeInBytes);
+			RHICmdList.Transition({
+				FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::SRVMask),
+				FRHITransitionInfo(DestBuffer, ERHIAccess::CopyDest, ERHIAccess::SRVMask) });
+		});
+}
+
+void HoloMeshUtilities::UpdateTexture(FRDGBuilder& GraphBuilder, FTexture2DRHIRef Texture, int Mip, FIntRect Region, const uint8* Data, uint32 SourcePitch)
+{
+	if (Texture == nullptr || !Texture.IsValid() || Region.Area() <= 0)
+	{
+		return;
+	}
+
+	// The command list copies the source rows so Data only has to live until this returns.
+	FUpdateTextureRegion2D UpdateRegion(Region.Min.X, Region.Min.Y, 0, 0, Region.Width(), Region.Height());
+	GraphBuilder.RHICmdList.UpdateTexture2D(Texture, Mip, UpdateRegion, SourcePitch, Data);
+}
+
+void HoloMeshUtilities::ComputeHullPoints(const FHoloMeshVec3* Positions, int32 Count, TArray<FVector>& OutPoints, int32 DirectionCount)
+{
+	OutPoints.Reset();
+	if (Positions == nullptr || Count <= 0 || DirectionCount <= 0)
+	{
+		return;
+	}
+
+	// Fibonacci sphere directions.
+	TArray<FHoloMeshVec3> Directions;
+	Directions.SetNumUninitialized(DirectionCount);
+	const float GoldenAngle = PI * (3.0f - FMath::Sqrt(5.0f));
+	for (int32 i = 0; i < DirectionCount; ++i)
+	{
+		const float Y = 1.0f - (2.0f * i + 1.0f) / DirectionCount;
+		const float Radius = FMath::Sqrt(FMath::Max(0.0f, 1.0f - Y * Y));
+		const float Theta = GoldenAngle * i;
+		Directions[i] = FHoloMeshVec3(FMath::Cos(Theta) * Radius, Y, FMath::Sin(Theta) * Radius);
+	}
+
+	TArray<float> BestDistance;
+	TArray<int32> BestIndex;
+	BestDistance.Init(-MAX_FLT, DirectionCount);
+	BestIndex.Init(0, DirectionCount);
+
+	// Vertices in the outer loop so the position array is streamed once.
+	for (int32 v = 0; v < Count; ++v)
+	{
+		const FHoloMeshVec3& P = Positions[v];
+		for (int32 d = 0; d < DirectionCount; ++d)
+		{
+			const float Distance = P.X * Directions[d].X + P.Y * Directions[d].Y + P.Z * Directions[d].Z;
+			if (Distance > BestDistance[d])
+			{
+				BestDistance[d] = Distance;
+				BestIndex[d] = v;
+			}
+		}
+	}
+
+	OutPoints.Reserve(DirectionCount);
+	for (int32 d = 0; d < DirectionCount; ++d)
+	{
+		OutPoints.AddUnique(FVector(Positions[BestIndex[d]]));
+	}
+}
+
+// BC4 palette, D3D rounding of the interpolated entries to the nearest 8-bit value.
+static inline void BuildBC4Palette(const uint8* Block, uint8* Palette)
+{
+	const int32 R0 = Block[0];
+	const int32 R1 = Block[1];
+
+	Palette[0] = (uint8)R0;
+	Palette[1] = (uint8)R1;
+
+	if (R0 > R1)
+	{
+		for (int32 i = 1; i < 7; ++i)
+		{
+			Palette[i + 1] = (uint8)((R0 * (7 - i) + R1 * i + 3) / 7);
+		}
+	}
+	else
+	{
+		for (int32 i = 1; i < 5; ++i)
+		{
+			Palette[i + 1] = (uint8)((R0 * (5 - i) + R1 * i + 2) / 5);
+		}
+		Palette[6] = 0;
+		Palette[7] = 255;
+	}
+}
+
+void HoloMeshUtilities::DecodeBC4Block(const uint8* Block, uint8* Out)
+{
+	uint8 Palette[16] = {};
+	BuildBC4Palette(Block, Palette);
+
+#if defined(HOLOMESH_BC4_SSE)
+	// Each 16 bit lane loads the two bytes holding a 3 bit index, the multiply moves the index
+	// up to bit 8 so every lane can be shifted by the same amount.
+	const __m128i BlockData = _mm_loadl_epi64((const __m128i*)Block);
+	const __m128i ShuffleLo = _mm_setr_epi8(2, 3, 2, 3, 2, 3, 3, 4, 3, 4, 3, 4, 4, 5, 4, 5);
+	const __m128i ShuffleHi = _mm_setr_epi8(5, 6, 5, 6, 5, 6, 6, 7, 6, 7, 6, 7, 7, 8, 7, 8);
+	const __m128i Shifts = _mm_setr_epi16(256, 32, 4, 128, 16, 2, 64, 8);
+	const __m128i IndexMask = _mm_set1_epi16(7);
+
+	__m128i IndicesLo = _mm_and_si128(_mm_srli_epi16(_mm_mullo_epi16(_mm_shuffle_epi8(BlockData, ShuffleLo), Shifts), 8), IndexMask);
+	__m128i IndicesHi = _mm_and_si128(_mm_srli_epi16(_mm_mullo_epi16(_mm_shuffle_epi8(BlockData, ShuffleHi), Shifts), 8), IndexMask);
+	__m128i Indices = _mm_packus_epi16(IndicesLo, IndicesHi);
+
+	_mm_storeu_si128((__m128i*)Out, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)Palette), Indices));
+#elif defined(HOLOMESH_BC4_NEON)
+	static const uint8 ShuffleLoData[16] = { 2, 3, 2, 3, 2, 3, 3, 4, 3, 4, 3, 4, 4, 5, 4, 5 };
+	static const uint8 ShuffleHiData[16] = { 5, 6, 5, 6, 5, 6, 6, 7, 6, 7, 6, 7, 7, 8, 7, 8 };
+	static const uint16 ShiftData[8] = { 256, 32, 4, 128, 16, 2, 64, 8 };
+
+	const uint8x16_t BlockData = vcombine_u8(vld1_u8(Block), vdup_n_u8(0));
+	const uint16x8_t Shifts = vld1q_u16(ShiftData);
+	const uint16x8_t IndexMask = vdupq_n_u16(7);
+
+	uint16x8_t IndicesLo = vandq_u16(vshrq_n_u16(vmulq_u16(vreinterpretq_u16_u8(vqtbl1q_u8(BlockData, vld1q_u8(ShuffleLoData))), Shifts), 8), IndexMask);
+	uint16x8_t IndicesHi = vandq_u16(vshrq_n_u16(vmulq_u16(vreinterpretq_u16_u8(vqtbl1q_u8(BlockData, vld1q_u8(ShuffleHiData))), Shifts), 8), IndexMask);
+	uint8x16_t Indices = vcombine_u8(vmovn_u16(IndicesLo), vmovn_u16(IndicesHi));
+
+	vst1q_u8(Out, vqtbl1q_u8(vld1q_u8(Palette), Indices));
+#else
+	uint64 Indices = 0;
+	FMemory::Memcpy(&Indices, Block + 2, 6);
+
+	for (int32 i = 0; i < 16; ++i)
+	{
+		Out[i] = Palette[(Indices >> (i * 3)) & 7];
+	}
+#endif
+}
+
+void HoloMeshUtilities::DecodeBC4Blocks(const uint8* Blocks, int32 BlockCount, uint8* Out)
+{
+	for (int32 i = 0; i < BlockCount; ++i)
+	{
+		DecodeBC4Block(Blocks + (i * 8), Out + (i * 16));
+	}
+}
+
+// ETC2 EAC modifier tables, shared by the R11 and alpha formats.
+static const int32 EACModifierTables[16][8] =
+{
+	{ -3, -6,  -9, -15, 2, 5, 8, 14 },
+	{ -3, -7, -10, -13, 2, 6, 9, 12 },
+	{ -2, -5,  -8, -13, 1, 4, 7, 12 },
+	{ -2, -4,  -6, -13, 1, 3, 5, 12 },
+	{ -3, -6,  -8, -12, 2, 5, 7, 11 },
+	{ -3, -7,  -9, -11, 2, 6, 8, 10 },
+	{ -4, -7,  -8, -11, 3, 6, 7, 10 },
+	{ -3, -5,  -8, -11, 2, 4, 7, 10 },
+	{ -2, -6,  -8, -10, 1, 5, 7,  9 },
+	{ -2, -5,  -8, -10, 1, 4, 7,  9 },
+	{ -2, -4,  -8, -10, 1, 3, 7,  9 },
+	{ -2, -5,  -7, -10, 1, 4, 6,  9 },
+	{ -3, -4,  -7, -10, 2, 3, 6,  9 },
+	{ -1, -2,  -3, -10, 0, 1, 2,  9 },
+	{ -4, -6,  -8,  -9, 3, 5, 7,  8 },
+	{ -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+
+void HoloMeshUtilities::TranscodeBC4BlockToEAC(const uint8* Block, uint8* Out)
+{
+	uint8 Pixels[16];
+	DecodeBC4Block(Block, Pixels);
+
+	// Targets in the 11 bit range EAC decodes to.
+	int32 Targets[16];
+	int32 MinTarget = 2047;
+	int32 MaxTarget = 0;
+	for (int32 i = 0; i < 16; ++i)
+	{
+		Targets[i] = (Pixels[i] * 2047 + 127) / 255;
+		MinTarget = FMath::Min(MinTarget, Targets[i]);
+		MaxTarget = FMath::Max(MaxTarget, Targets[i]);
+	}
+
+	int32 BestError = MAX_int32;
+	uint64 BestBlock = 0;
+
+	// Every table gets the multiplier and base codeword that stretch its modifiers over the
+	// block's range, the one with the lowest squared error wins.
+	for (int32 Table = 0; Table < 16 && BestError > 0; ++Table)
+	{
+		const int32* Modifiers = EACModifierTables[Table];
+		const int32 Span = Modifiers[7] - Modifiers[3];
+
+		const int32 Multiplier = FMath::Clamp((MaxTarget - MinTarget + Span * 4) / (Span * 8), 1, 15);
+		int32 Center = (MinTarget + MaxTarget) / 2 - ((Modifiers[7] + Modifiers[3]) * Multiplier * 8) / 2;
+		int32 Base = FMath::Clamp(Center / 8, 0, 255);
+
+		int32 Error = 0;
+		uint64 Indices = 0;
+		for (int32 i = 0; i < 16; ++i)
+		{
+			int32 BestPixelError = MAX_int32;
+			int32 BestIndex = 0;
+			for (int32 Index = 0; Index < 8; ++Index)
+			{
+				int32 Value = FMath::Clamp(Base * 8 + 4 + Modifiers[Index] * Multiplier * 8, 0, 2047);
+				int32 PixelError = (Value - Targets[i]) * (Value - Targets[i]);
+				if (PixelError < BestPixelError)
+				{
+					BestPixelError = PixelError;
+					BestIndex = Index;
+				}
+			}
+
+			// EAC stores pixels column by column, the first one in the highest bits.
+			int32 x = i & 3;
+			int32 y = i >> 2;
+			Indices |= (uint64)BestIndex << (45 - (x * 4 + y) * 3);
+			Error += BestPixelError;
+		}
+
+		if (Error < BestError)
+		{
+			BestError = Error;
+			BestBlock = ((uint64)Base << 56) | ((uint64)Multiplier << 52) | ((uint64)Table << 48) | Indices;
+		}
+	}
+
+	// Blocks are big endian.
+	for (int32 i = 0; i < 8; ++i)
+	{
+		Out[i] = (uint8)(BestBlock >> (56 - i * 8));
+	}
+}
+
+void HoloMeshUtilities::TranscodeBC4BlocksToEAC(const uint8* Blocks, int32 BlockCount, uint8* Out)
+{
+	for (int32 i = 0; i < BlockCount; ++i)
+	{
+		TranscodeBC4BlockToEAC(Blocks + (i * 8), Out + (i * 8));
+	}
 }
\ No newline at end of file
@@ -11,7 +11,10 @@ void FHoloMeshVertexFactory::InitRHI(FRHICommandListBase& RHICmdList)
 	FHoloMeshVertexFactoryParameters Parameters;
 	Parameters.PreviousPositionBuffer = GNullVertexBuffer.VertexBufferSRV;
 	Parameters.PreviousPositionWeight = 0.0f;
+	Parameters.InterpolationWeight = 1.0f;
 	HoloMeshUniformBuffer = TUniformBufferRef<FHoloMeshVertexFactoryParameters>::CreateUniformBufferImmediate(Parameters, UniformBuffer_MultiFrame);
+	PublishedInterpolationWeight = Parameters.InterpolationWeight;
+	PublishedPreviousPositionWeight = Parameters.PreviousPositionWeight;
 
 	check(IsValidRef(GetDeclaration()));
 }
@@ -23,12 +26,37 @@ void FHoloMeshVertexFactory::InitRHI()
 	FHoloMeshVertexFactoryParameters Parameters;
 	Parameters.PreviousPositionBuffer = GNullVertexBuffer.VertexBufferSRV;
 	Parameters.PreviousPositionWeight = 0.0f;
+	Parameters.InterpolationWeight = 1.0f;
 	HoloMeshUniformBuffer = TUniformBufferRef<FHoloMeshVertexFactoryParameters>::CreateUniformBufferImmediate(Parameters, UniformBuffer_MultiFrame);
+	PublishedInterpolationWeight = Parameters.InterpolationWeight;
+	PublishedPreviousPositionWeight = Parameters.PreviousPositionWeight;
 
 	check(IsValidRef(GetDeclaration()));
 }
 #endif
 
+float FHoloMeshVertexFactory::GetInterpolationWeight(float Frame) const
+{
+	if (InterpolationFromFrame < 0 || InterpolationToFrame <= InterpolationFromFrame
+		|| Frame < InterpolationFromFrame || Frame >= InterpolationToFrame)
+	{
+		return 1.0f;
+	}
+	return (Frame - InterpolationFromFrame) / (float)(InterpolationToFrame - InterpolationFromFrame);
+}
+
+void FHoloMeshVertexFactory::UpdateUniforms(float PreviousPositionWeight)
+{
+	FHoloMeshVertexFactoryParameters Parameters;
+	Parameters.PreviousPositionBuffer = GetPreSkinPositionSRV();
+	Parameters.PreviousPositionWeight = PreviousPositionWeight;
+	Parameters.InterpolationWeight = GetInterpolationWeight(PresentedFrame);
+	HoloMeshUniformBuffer.UpdateUniformBufferImmediate(Parameters);
+
+	PublishedInterpolationWeight = Parameters.InterpolationWeight;
+	PublishedPreviousPositionWeight = PreviousPositionWeight;
+}
+
 void FHoloMeshVertexFactoryShaderParameters::Bind(const FShaderParameterMap& ParameterMap)
 {
 	// No special parameters to bind for now.
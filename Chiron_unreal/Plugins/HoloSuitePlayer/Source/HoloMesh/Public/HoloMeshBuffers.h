@@ -32,6 +32,45 @@ enum class EHoloMeshUpdateFlags : uint8
 };
 ENUM_CLASS_FLAGS(EHoloMeshUpdateFlags)
 
+// Range of elements written on the CPU since the last upload of a stream.
+struct FHoloMeshDirtyRange
+{
+    uint32 First = 0;
+    uint32 End = 0;
+
+    bool IsEmpty() const { return End <= First; }
+
+    void Add(uint32 InFirst, uint32 InCount)
+    {
+        if (InCount == 0)
+        {
+            return;
+        }
+
+        if (IsEmpty())
+        {
+            First = InFirst;
+            End = InFirst + InCount;
+        }
+        else
+        {
+            First = FMath::Min(First, InFirst);
+            End = FMath::Max(End, InFirst + InCount);
+        }
+    }
+
+    void Reset()
+    {
+        First = 0;
+        End = 0;
+    }
+};
+
+// Buffers that are swapped between sources of different sizes allocate in these steps
+// so GPU resources can be kept whenever the new data fits.
+#define HOLOMESH_VERTEX_CAPACITY_BUCKET (UINT16_MAX + 1)
+#define HOLOMESH_INDEX_CAPACITY_BUCKET  60000
+
 // Index Buffer
 class HOLOMESH_API FHoloMeshIndexBuffer : public FRenderResource
 {
@@ -79,7 +118,11 @@ public:
     FHoloMeshIndexBuffer();
     ~FHoloMeshIndexBuffer();
 
-    void Create(uint32 InNumIndices, bool bInUse32Bit = false, bool bInNeedsUAV = false);
+    // Allocates InCapacity indices (at least InNumIndices) and uses the first InNumIndices.
+    void Create(uint32 InNumIndices, bool bInUse32Bit = false, bool bInNeedsUAV = false, uint32 InCapacity = 0);
+
+    // Rounds an index count up to HOLOMESH_INDEX_CAPACITY_BUCKET.
+    static uint32 GetBucketCapacity(uint32 InNumIndices);
 
     bool IsInitialized()
     {
@@ -94,18 +137,31 @@ public:
     void SwapData(FHoloMeshIndexBuffer* srcIndexBuffer);
     void Clear(uint32 startingIndex = 0);
 
+    // Limits the next upload to the indices written since the last one. Without a dirty
+    // range the whole used range is uploaded.
+    void MarkDirty(uint32 FirstIndex, uint32 NumIndices);
+
     void UpdateData();
     void UpdateData_RenderThread(FRHICommandListImmediate& RHICmdList);
 
-    uint32  GetNumIndices() const;
+    // GPU side copy from another index buffer, no CPU data is touched.
+    void CopyFrom(FRDGBuilder& GraphBuilder, FHoloMeshIndexBuffer* SourceIndexBuffer);
+
+    // Number of indices drawn and uploaded, at most GetCapacity().
+    uint32  GetNumIndices() const { return UsedIndices; }
+    uint32  GetCapacity() const { return Capacity; }
+    uint32  GetSizeBytes() const { return SizeBytes; }
     bool    Use32Bit() { return bUse32Bit; }
 
     uint32 GetUsedIndices() { return UsedIndices; }
     void SetUsedIndices(uint32 count)
     {
-        UsedIndices = count;
+        UsedIndices = FMath::Min(count, Capacity);
     }
 
+    // True if the source's indices can be swapped in without reallocating the GPU buffer.
+    bool CanSwapData(FHoloMeshIndexBuffer* srcIndexBuffer) const;
+
     TArray<uint32>* GetData() { return IndexData; }
     TArray<uint32>* TakeData() 
     { 
@@ -137,6 +193,8 @@ protected:
     bool bNeedsUAV     = false;
 
     uint32_t UsedIndices = 0;
+    uint32_t Capacity = 0;
+    FHoloMeshDirtyRange DirtyRange;
     uint32_t SizeBytes = 0;
 
     TArray<uint32>* IndexData;
@@ -189,11 +247,16 @@ public:
     void CleanUp();
 
     // Sets the number of vertices and texcoords and allocates the requires buffers to hold them.
+    // InCapacity vertices are allocated when it is larger than NumVertices.
     void Create(uint32 NumVertices,
         uint32 NumTexCoords = 1, 
         bool bInNeedsUAV = false, 
         bool bInUseHighPrecision = false,
-        bool bInNeedsCPUAccess = true);
+        bool bInNeedsCPUAccess = true,
+        uint32 InCapacity = 0);
+
+    // Rounds a vertex count up to HOLOMESH_VERTEX_CAPACITY_BUCKET.
+    static uint32 GetBucketCapacity(uint32 InNumVertices);
 
     bool IsInitialized()
     {
@@ -202,6 +265,13 @@ public:
 
     void SwapData(FHoloMeshVertexBuffers* srcVertexBuffers);
 
+    // True if the source's data can be swapped in without reallocating GPU buffers.
+    bool CanSwapData(FHoloMeshVertexBuffers* srcVertexBuffers) const;
+
+    // Limits the next upload of the flagged streams to the vertices written since the last
+    // one. Streams without a dirty range upload their whole used range.
+    void MarkDirty(EHoloMeshUpdateFlags Flags, uint32 FirstVertex, uint32 InNumVertices);
+
     // Initialize (or update) render resources.
     void InitOrUpdate(FHoloMeshVertexFactory* VertexFactory, uint32 LightMapIndex = 0);
 
@@ -275,6 +345,18 @@ public:
     {
         return NumVertices;
     }
+    FORCEINLINE uint32 GetCapacity() const
+    {
+        return Capacity;
+    }
+    FORCEINLINE uint32 GetSizeBytes() const
+    {
+        return SizeBytes;
+    }
+    FORCEINLINE void SetNumVertices(uint32 InNumVertices)
+    {
+        NumVertices = FMath::Min(InNumVertices, Capacity);
+    }
     FORCEINLINE_DEBUGGABLE uint32 GetNumTexCoords() const
     {
         return NumTexCoords;
@@ -296,11 +378,15 @@ public:
     void UpdateData();
     void UpdateData_RenderThread(FRHICommandListImmediate& RHICmdList, EHoloMeshUpdateFlags Flags);
 
+    // GPU side copy from buffers with a matching layout, no CPU data is touched.
+    void CopyFrom(FRDGBuilder& GraphBuilder, const FHoloMeshVertexBuffers* SourceVertexBuffers);
+
 private:
 
     mutable FCriticalSection CriticalSection;
     uint32 NumVertices;
     uint32 NumTexCoords;
+    uint32 Capacity;
     uint32 SizeBytes;
     bool bInitialized	   = false;
     bool bUseHighPrecision = false;
@@ -308,6 +394,9 @@ private:
     bool bNeedsUAV		   = false;
     bool bDoubleBuffer	   = true;
 
+    // Positions, Normals, Colors, UVs
+    FHoloMeshDirtyRange DirtyRanges[4];
+
     // CPU Side Data
     TMemoryImagePtr<class FPositionVertexData> PositionData;
     TMemoryImagePtr<class FPositionVertexData> PrevPositionData;
@@ -32,6 +32,18 @@ struct FHoloMesh;
 
 DECLARE_DELEGATE_TwoParams(FHoloMeshUpdateDelegate, FRHICommandListImmediate& RHICmdList, FHoloMesh* Mesh);
 
+UENUM(BlueprintType)
+enum class EHoloMeshCollisionMode : uint8
+{
+	// No collision is cooked.
+	None,
+	// A convex shape per segment or sequence, cooked once and swapped as playback crosses them.
+	// AVV segments use their bounding box, OMS sequences the convex hull of their vertices.
+	Proxy,
+	// Every triangle of the current mesh, recooked whenever the mesh changes.
+	Full
+};
+
 // FHoloMesh is the rendering representation of a volumetric mesh.
 // Contains vertex buffers, textures, etc for rendering the mesh.
 USTRUCT()
@@ -48,21 +60,38 @@ struct HOLOMESH_API FHoloMesh
 
 	FHoloMeshDataTexture SSDRBoneTexture;
 	FHoloMeshDataTexture RetargetBoneTexture;
+
+	// Bone matrices for every SSDR frame of the current sequence, uploaded when the sequence is
+	// loaded. Changing frames only swaps which one is bound, -1 binds SSDRBoneTexture.
+	TArray<FHoloMeshDataTexture> SSDRFrameTextures;
+	int SSDRFrame = -1;
+
+	// Bone matrices blended on the GPU from SSDRBlendFrame towards the frame after it, bound
+	// instead of SSDRFrame while SSDRBlend is above 0.
+	FHoloMeshRenderTarget SSDRBlendTexture;
+	int SSDRBlendFrame = -1;
+	float SSDRBlend = 0.0f;
 	FHoloMeshRenderTarget LumaTexture;
 	FHoloMeshRenderTarget MaskTexture;
 	FHoloMeshTexture BC4Texture;
 
 	bool bVisible;
 	FBox LocalBox;
-	bool bEnableCollision;
+
+	// LocalBox bounds only the current frame rather than the whole segment, so it isn't padded.
+	bool bFrameBounds = false;
 	bool bInitialized;
 
+	// Deprecated, set UHoloMeshComponent::CollisionMode instead. A component with collision off
+	// switches to Full the next time it's updated with this set on any of its meshes.
+	bool bEnableCollision;
+
 	FHoloMesh()
 		: Material(nullptr)
 		, VertexFactory(nullptr)
 		, bVisible(true)
-		, bEnableCollision(false)
 		, bInitialized(false)
+		, bEnableCollision(false)
 	{
 		VertexBuffers = new FHoloMeshVertexBuffers();
 		IndexBuffer = new FHoloMeshIndexBuffer();
@@ -137,12 +166,32 @@ struct HOLOMESH_API FHoloMesh
 	void UpdateUniforms(float PreviousPositionWeight); 
 	void UpdateUniforms(FRDGBuilder& GraphBuilder, float PreviousPositionWeight);
 
+	// Positions can only be interpolated where the vertex factory fetches them manually.
+	bool SupportsInterpolation() const;
+
+	// Frames presented in between the last two decoded frames interpolate positions from the
+	// previous position buffer, Frame can be fractional. With motion vectors they cover the
+	// distance moved since the previously presented frame (Game Thread).
+	void SetPresentedFrame(float Frame, bool bMotionVectors);
+
+	// Called as FrameNumber is animated into the position buffer. Unless bContinuous is false the
+	// frame it replaced, now in the previous position buffer, is interpolated from (Render Thread).
+	void SetDecodedFrame(FRDGBuilder& GraphBuilder, int FrameNumber, bool bContinuous);
+
 	// If source vertex or index counts match only CPU side structures will be taken.
 	// If they do not match the vertex and index buffer objects will be taken.
 	// Data is not copied so it will be nulled in the provided Source.
 	void UpdateFromSource(FHoloMesh* SourceHoloMesh);
 };
 
+// Copy of a previously decoded frame, used by instances drawing with a frame offset
+// and by the decoded frame cache.
+struct FHoloMeshInstanceFrame
+{
+	TUniquePtr<FHoloMesh> Mesh;
+	std::atomic<int> FrameNumber = { -1 };
+};
+
 class FHoloMeshSceneProxy;
 
 // Component used for rendering Arcturus volumetric mesh data.
@@ -167,6 +216,9 @@ public:
 	// Updates HoloMesh representation including Physics. 
 	void UpdateHoloMesh();
 
+	/** Update LocalBounds member from the local box of each section */
+	void UpdateLocalBounds();
+
 	// Will be populated by HoloMeshManager if this mesh is registered with it.
 	FGuid RegisteredGUID;
 
@@ -177,7 +229,7 @@ public:
 
 	//~ Begin Interface_CollisionDataProvider Interface
 	virtual bool GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData) override;
-	virtual bool ContainsPhysicsTriMeshData(bool InUseAllTriData) const override { return false; }
+	virtual bool ContainsPhysicsTriMeshData(bool InUseAllTriData) const override { return CollisionMode == EHoloMeshCollisionMode::Full; }
 	virtual bool WantsNegXTriMesh() override { return false; }
 	//~ End Interface_CollisionDataProvider Interface
 
@@ -194,6 +246,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "HoloSuite Mesh Component")
 	bool bUseAsyncCooking;
 
+	/**
+	*	Collision generated for the mesh. Proxy collision is cheap to swap during playback, Full collision
+	*	recooks every triangle whenever the segment or sequence changes.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "HoloSuite Mesh Component")
+	EHoloMeshCollisionMode CollisionMode;
+
+	// Switches Proxy collision to the shape of the given segment or sequence. It's cooked as the convex
+	// hull of HullPoints the first time an index is seen and reused after that.
+	void SetCollisionProxy(int ProxyIndex, const TArray<FVector>& HullPoints);
+
+	// Releases cached proxies, called when the source changes.
+	void ClearCollisionProxies();
+
 	/** Collision data */
 	UPROPERTY(Instanced)
 	class UBodySetup* ProcMeshBodySetup;
@@ -215,6 +281,10 @@ public:
 	virtual void PostLoad() override;
 	//~ End UObject Interface.
 
+	//~ Begin UActorComponent Interface.
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+	//~ End UActorComponent Interface.
+
 	// Rendering options.
 	void SetRenderingOptions(bool _motionVectors, bool _responsiveAA, bool _receiveDecals)
 	{	
@@ -245,16 +315,57 @@ public:
 	// Called by the manager to flush out any excess memory usage.
 	virtual void FreeUnusedMemory() {}
 
-	// Executed via a thread from HoloMeshManager's pool.
-	virtual void DoThreadedWork(int sequenceIndex, int frameIndex);
+	// -- Instancing --
+
+	// Binds this component to the decoded mesh of Source so it's drawn with this component's
+	// transform without decoding anything itself. A positive FrameOffset draws the frame that
+	// was decoded that many frames before Source's current one, served from Source's frame ring.
+	// Passing nullptr unbinds.
+	void SetInstanceSource(UHoloMeshComponent* Source, int FrameOffset = 0);
+	UHoloMeshComponent* GetInstanceSource() const { return InstanceSource.Get(); }
+	bool IsHoloMeshInstance() const { return InstanceSource.IsValid(); }
+	int GetInstanceFrameOffset() const { return InstanceFrameOffset; }
+
+	// Lowest LOD across this component and its bound instances, which is what has to be decoded.
+	int GetDecodeLOD();
+
+	// Called by decoders on the game thread once a frame has been requested so instances
+	// can pick up the matching ring entry.
+	void UpdateInstances(int FrameNumber, int FrameCount);
+
+	// Called by decoders on the render thread after a frame was decoded into SourceMesh.
+	// Copies it into the frame ring if any instance uses a frame offset.
+	void CaptureInstanceFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMesh* SourceMesh, int FrameNumber);
+
+	// -- Decoded Frame Cache --
+
+	// Keeps a copy of every frame of a FrameCount long clip as it's decoded so later loops can
+	// bind them instead of decoding again. Creates the entry FrameNumber will be captured into,
+	// if the clip fits HoloMeshManager's budget. Called by decoders on the game thread.
+	void UpdateDecodedFrameCache(int FrameNumber, int FrameCount);
+
+	// Called by decoders on the render thread after a frame was decoded into SourceMesh.
+	void CaptureDecodedFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMesh* SourceMesh, int FrameNumber);
+
+	// Cached copy of FrameNumber, only once every frame of the clip has been captured.
+	FHoloMesh* GetDecodedFrame(int FrameNumber);
+
+	// Draws a mesh returned by GetDecodedFrame instead of the decoded one, nullptr goes back to it.
+	void BindDecodedFrame(FHoloMesh* FrameMesh);
+	bool IsDecodedFrameBound() const { return DecodedFrameMesh != nullptr; }
+	bool HasDecodedFrameCache() const { return DecodedFrameCache.Num() > 0; }
+
+	// Releases every cached frame. Also called by HoloMeshManager to evict the cache.
+	virtual void FreeDecodedFrameCache();
+
+	// Executed via a thread from the HoloMeshManager pool for workType.
+	virtual void DoThreadedWork(int sequenceIndex, int frameIndex, EHoloMeshWorkType workType);
 
 private:
 	//~ Begin USceneComponent Interface.
 	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
 	//~ Begin USceneComponent Interface.
 
-	/** Update LocalBounds member from the local box of each section */
-	void UpdateLocalBounds();
 	/** Ensure ProcMeshBodySetup is allocated and configured */
 	void CreateProcMeshBodySetup();
 	/** Mark collision data as dirty, and re-create on instance if necessary */
@@ -277,6 +388,10 @@ private:
 	UPROPERTY(transient)
 	TArray<class UBodySetup*> AsyncBodySetupQueue;
 
+	/** Cooked proxy hulls by segment or sequence index */
+	UPROPERTY(transient)
+	TMap<int32, class UBodySetup*> CollisionProxies;
+
 protected:
 	// Double buffered HoloMesh data
 	FHoloMesh HoloMesh[HOLOMESH_BUFFER_COUNT];
@@ -306,5 +421,39 @@ protected:
 	TArray<FHoloMeshSceneProxy*> SceneProxies;
 	mutable FCriticalSection CriticalSection;
 
+	// Instancing
+	TWeakObjectPtr<UHoloMeshComponent> InstanceSource;
+	int InstanceFrameOffset = 0;
+	FHoloMesh* InstanceFrameMesh = nullptr;
+	TArray<TWeakObjectPtr<UHoloMeshComponent>> HoloMeshInstances;
+
+	// Recently decoded frames kept for instances with a frame offset. Entries are
+	// keyed by FrameNumber % Num() and only ever grow so instance proxies stay valid.
+	TArray<TUniquePtr<FHoloMeshInstanceFrame>> InstanceFrameRing;
+
+	UPROPERTY(Transient)
+	TArray<UMaterialInstanceDynamic*> InstanceFrameMaterials;
+
+	void AddHoloMeshInstance(UHoloMeshComponent* Instance);
+	void RemoveHoloMeshInstance(UHoloMeshComponent* Instance);
+	void UpdateInstanceFrameRing();
+	FHoloMesh* GetInstanceFrame(int FrameNumber);
+
+	// One entry per frame of the clip, created as frames are first decoded.
+	TArray<TUniquePtr<FHoloMeshInstanceFrame>> DecodedFrameCache;
+	FHoloMesh* DecodedFrameMesh = nullptr;
+	size_t DecodedFrameCacheBytes = 0;
+	bool bDecodedFrameCacheComplete = false;
+	double DecodedFrameCacheRetryTime = 0.0;
+
+	UPROPERTY(Transient)
+	TArray<UMaterialInstanceDynamic*> DecodedFrameMaterials;
+
+	// Shared by the frame ring and decoded frame cache.
+	TUniquePtr<FHoloMesh> CreateFrameCopy(FHoloMesh* SourceMesh);
+	void UpdateFrameCopyTextures(FHoloMesh* SourceMesh, FHoloMesh* FrameMesh, TArray<UMaterialInstanceDynamic*>& FrameMaterials);
+	static bool CopyFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMesh* SourceMesh, FHoloMesh* FrameMesh);
+	static size_t GetFrameCopySizeBytes(FHoloMesh* FrameMesh);
+
 	friend class FHoloMeshSceneProxy;
 };
@@ -16,6 +16,33 @@
 class FHoloMeshSceneViewExtension;
 class UHoloMeshComponent;
 
+// Mesh buffer stream an upload was written to, for upload stats.
+enum class EHoloMeshUploadStream : uint8
+{
+    Other,
+    Indices,
+    Positions,
+    Normals,
+    Colors,
+    UVs,
+    Count
+};
+
+// Quality the governor allows while HoloMesh work doesn't fit the frame. Each level
+// keeps the reductions of the ones before it.
+UENUM(BlueprintType)
+enum class EHoloMeshQualityLevel : uint8
+{
+    // Everything updates at full rate and quality.
+    Full,
+    // Meshes beyond LOD 0 update every LOD + 1 frames.
+    ReducedUpdateRate,
+    // Meshes beyond LOD 0 stop reading and decoding textures, the last one decoded is kept.
+    ReducedTextures,
+    // Every mesh is drawn and decoded one LOD coarser.
+    LODBias
+};
+
 USTRUCT()
 struct FRegisteredHoloMesh
 {
@@ -33,6 +60,10 @@ struct FRegisteredHoloMesh
     int framesSinceUpdate = 0;
     int lastContentFrame = -1;
 
+    // Decoded frame cache held by the component, see HoloMeshManager::ReserveDecodedFrameCache.
+    size_t decodedFrameCacheBytes = 0;
+    double decodedFrameCacheLastUse = 0.0;
+
     TMovingAverage<double, 30> averageUpdateTime;
 
     bool IsValid()
@@ -57,6 +88,16 @@ struct FHoloMeshUpdateRequest
     }
 };
 
+// Thread pool a work request runs on, each one is sized and placed by its own r.HoloMesh.*Threads console variables.
+enum class EHoloMeshWorkType : uint8
+{
+    // Issuing, waiting on and parsing reads. Mostly blocked so it shouldn't hold up decoding.
+    IO,
+    // CPU mesh decoding.
+    Decode,
+    Count
+};
+
 class FHoloMeshWorkRequest : public IQueuedWork
 {
 public:
@@ -64,6 +105,7 @@ public:
 
     int SegmentIndex = 0;
     int FrameIndex = 0;
+    EHoloMeshWorkType WorkType = EHoloMeshWorkType::Decode;
 
     virtual void DoThreadedWork();
     virtual void Abandon();
@@ -92,6 +134,15 @@ public:
     void FreeBlock(FHoloMemoryBlockRef Block);
     void FreeUnusedMemory();
 
+    // Decoded frame caches share r.HoloMesh.DecodedFrameCache.BudgetMB. Sets the size of the mesh's
+    // cache, evicting the least recently used caches of other meshes to make room. Returns false
+    // if it's over r.HoloMesh.DecodedFrameCache.MaxClipMB or doesn't fit without evicting caches
+    // touched within the last second (Game Thread).
+    bool ReserveDecodedFrameCache(FGuid holoMeshGUID, size_t sizeInBytes);
+    bool IsDecodedFrameCacheEnabled() const;
+    void ReleaseDecodedFrameCache(FGuid holoMeshGUID);
+    void TouchDecodedFrameCache(FGuid holoMeshGUID);
+
     // Render Update Requests
     void AddUpdateRequest(FGuid holoMeshGUID, int holoMeshIndex, int segmentIndex, int frameIndex);
     void ClearRequests(FGuid holoMeshGUID);
@@ -100,9 +151,16 @@ public:
 
     // Threaded Work
     TReusableObjectPool<FHoloMeshWorkRequest, 16368>* WorkRequestPool;
-    void AddWorkRequest(FGuid holoMeshGUID, int segmentIndex, int frameIndex);
+    // Returns false if the mesh isn't registered, nothing is queued then.
+    bool AddWorkRequest(FGuid holoMeshGUID, int segmentIndex, int frameIndex, EHoloMeshWorkType workType = EHoloMeshWorkType::Decode);
     void FinishWorkRequest(FHoloMeshWorkRequest* request);
 
+    // Called when a worker picks a request up or when it is abandoned without running (Any Thread)
+    void DequeueWorkRequest(FHoloMeshWorkRequest* request);
+
+    // Moves the calling pool thread onto the cores configured for its pool (Worker Thread)
+    void ApplyWorkerAffinity(EHoloMeshWorkType workType);
+
     // Update manager stats and view frustum related information.
     void UpdateStats(FSceneView* sceneView);
 
@@ -119,6 +177,11 @@ public:
     int GetVisibleMeshCount() { return managerStats.visibleMeshes; }
     float GetAverageIOTime() { return managerStats.ioAverageTime.GetAverage(); }
 
+    // Quality Governor
+    EHoloMeshQualityLevel GetQualityLevel() const { return qualityLevel; }
+    int GetLODBias() const { return qualityLevel >= EHoloMeshQualityLevel::LODBias ? 1 : 0; }
+    int GetUpdateInterval(int LOD) const { return (qualityLevel >= EHoloMeshQualityLevel::ReducedUpdateRate && LOD > 0) ? LOD + 1 : 1; }
+
     // For memory statistics tracking purposes.
     void AddMeshBytes(size_t meshBytes)             { managerStats.totalMeshBytes += meshBytes; }
     void RemoveMeshBytes(size_t meshBytes)          { managerStats.totalMeshBytes -= meshBytes; }
@@ -128,7 +191,12 @@ public:
     void RemoveContainerBytes(size_t containerSize) { managerStats.totalContainerBytes -= containerSize; }
 
     void AddIOResult(size_t sizeInBytes, float fillTimeMS);
-    void AddUploadBytes(size_t bufferSize) { managerStats.totalUploadBytes += bufferSize; }
+    void AddUploadBytes(size_t bufferSize, EHoloMeshUploadStream stream = EHoloMeshUploadStream::Other)
+    {
+        managerStats.totalUploadBytes += bufferSize;
+        managerStats.totalStreamUploadBytes[(int)stream] += bufferSize;
+    }
+    size_t GetUploadBytesPerSecond(EHoloMeshUploadStream stream) const { return managerStats.streamUploadBytesPerSecond[(int)stream]; }
 
     /** FTickableGameObject implementation */
     virtual void Tick(float DeltaSeconds) override;
@@ -164,16 +232,41 @@ private:
         std::atomic<size_t> totalTextureBytes   = { 0 };
         std::atomic<size_t> totalContainerBytes = { 0 };
         std::atomic<size_t> totalUploadBytes    = { 0 };
+        std::atomic<size_t> totalFrameCacheBytes = { 0 };
 
         size_t uploadBytesPerSecond = 0;
         size_t lastUploadBytes = 0;
 
+        std::atomic<size_t> totalStreamUploadBytes[(int)EHoloMeshUploadStream::Count] = {};
+        size_t streamUploadBytesPerSecond[(int)EHoloMeshUploadStream::Count] = {};
+        size_t lastStreamUploadBytes[(int)EHoloMeshUploadStream::Count] = {};
+
         // IO
         size_t ioBytesPerSecond = 0;
         size_t ioLastBytes = 0;
         std::atomic<size_t> totalIOBytes = { 0 };
         TMovingAverage<float, 30> ioAverageTime;
+
+        // Governor inputs, queued work requests are the ones still waiting for a worker.
+        std::atomic<int> queuedWorkRequests[(int)EHoloMeshWorkType::Count] = {};
+        std::atomic<int> deferredUpdates = { 0 };
+        TMovingAverage<float, 30> frameTimeAverage;
     } managerStats;
+
+    // Steps quality down while the pipeline falls behind and back up once it has headroom again (Game Thread)
+    void UpdateGovernor(float DeltaSeconds);
+
+    std::atomic<EHoloMeshQualityLevel> qualityLevel = { EHoloMeshQualityLevel::Full };
+    double governorPressureTime = 0.0;
+    double governorHeadroomTime = 0.0;
+    double governorLevelTime = 0.0;
+
+    // Load each level was stepped down from and the load the level below it settled at, their ratio
+    // estimates what stepping back up would cost. Settled loads are negative until measured.
+    float governorStepDownLoads[(int)EHoloMeshQualityLevel::LODBias + 1] = {};
+    float governorSettledLoads[(int)EHoloMeshQualityLevel::LODBias + 1] = {};
+    int workerThreadCounts[(int)EHoloMeshWorkType::Count] = {};
+    uint64 workerAffinityMasks[(int)EHoloMeshWorkType::Count] = {};
     
     int queuePosition;
     bool bInitialized = false;
@@ -194,7 +287,7 @@ private:
     TArray<FHoloMeshUpdateRequest> EndFrameRequestQueue;
 
     FHoloMemoryPool* MemoryPool;
-    FQueuedThreadPool* ThreadPool;
+    FQueuedThreadPool* ThreadPools[(int)EHoloMeshWorkType::Count] = {};
 };
 
 extern HOLOMESH_API TGlobalResource<HoloMeshManager> GHoloMeshManager;
@@ -216,6 +309,10 @@ public:
 
     UFUNCTION(BlueprintPure, Category = "HoloMeshManager")
     static float GetAverageIOTime();
+
+    // Quality reductions currently applied by the governor, see r.HoloMesh.Governor.
+    UFUNCTION(BlueprintPure, Category = "HoloMeshManager")
+    static EHoloMeshQualityLevel GetQualityLevel();
 };
 
 // Used to hook into PrePostProcessPass_RenderThread.
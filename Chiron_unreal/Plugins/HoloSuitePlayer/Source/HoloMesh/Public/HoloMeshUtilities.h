@@ -39,8 +39,9 @@ public:
     static void UploadBuffer(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, void* DataPtr, uint32_t SizeInBytes, ERDGInitialDataFlags initialDataFlags);
     static void UploadBuffer(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, void* DataPtr, uint32_t SizeInBytes, FHoloUploadCompleteCallback&& UploadCompleteCallback);
 
-    static bool UploadVertexBuffer(FHoloMeshVertexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList = nullptr);
-    static bool UploadIndexBuffer(FHoloMeshIndexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList = nullptr);
+    // Data is written to the buffer starting at OffsetInBytes.
+    static bool UploadVertexBuffer(FHoloMeshVertexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList = nullptr, uint32 OffsetInBytes = 0);
+    static bool UploadIndexBuffer(FHoloMeshIndexBufferRHIRef BufferRHI, const void* Data, uint32 SizeInBytes, FRHICommandListImmediate* RHICmdList = nullptr, uint32 OffsetInBytes = 0);
 
     // ConvertToExternalBuffer but works on both 4.27 and 5.0+
     static void ConvertToPooledBuffer(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, TRefCountPtr<FRDGPooledBuffer>& OutPooledBuffer);
@@ -51,6 +52,31 @@ public:
     // Copies an RDG texture to a non-RDG one.
     static void CopyTexture(FRDGBuilder& GraphBuilder, FIntVector Size, FRDGTextureRef SourceRDGTexture, int SourceMip, FTexture2DRHIRef DestTexture, int DestMip);
     static void CopyTexture(FRDGBuilder& GraphBuilder, FIntVector Size, FRDGTextureRef SourceRDGTexture, FIntVector SourcePosition, FRDGTextureRef DestRDGTexture, FTexture2DRHIRef DestTexture, FIntVector DestPosition);
+
+    // Copies a non-RDG texture into an RDG one, the source is expected to be in SRV state before and after.
+    static void CopyTexture(FRDGBuilder& GraphBuilder, FIntVector Size, FTexture2DRHIRef SourceTexture, int SourceMip, FRDGTextureRef DestRDGTexture, int DestMip);
+
+    // Copies between two non-RDG resources, both are expected to be in SRV state before and after.
+    static void CopyTexture(FRDGBuilder& GraphBuilder, FTexture2DRHIRef SourceTexture, FTexture2DRHIRef DestTexture);
+    static void CopyBuffer(FRDGBuilder& GraphBuilder, FHoloMeshBufferRHIRef SourceBuffer, FHoloMeshBufferRHIRef DestBuffer, uint32 SizeInBytes);
+
+    // Uploads CPU data into a region of a non-RDG texture mip, Data points at the first row of the region.
+    // Compressed formats expect a block aligned region and a pitch in bytes per row of blocks.
+    static void UpdateTexture(FRDGBuilder& GraphBuilder, FTexture2DRHIRef Texture, int Mip, FIntRect Region, const uint8* Data, uint32 SourcePitch);
+
+    // Decodes 8 byte BC4 blocks into 4x4 8-bit texels, 16 bytes per block in row order.
+    // Uses SSE or NEON when the platform has them. Safe to call from any thread.
+    static void DecodeBC4Block(const uint8* Block, uint8* Out);
+    static void DecodeBC4Blocks(const uint8* Blocks, int32 BlockCount, uint8* Out);
+
+    // Transcodes BC4 blocks into ETC2 EAC R11 blocks, also 8 bytes each, for GPUs without BC
+    // support. The texels are decoded and refit so this is lossy. Safe to call from any thread.
+    static void TranscodeBC4BlockToEAC(const uint8* Block, uint8* Out);
+    static void TranscodeBC4BlocksToEAC(const uint8* Blocks, int32 BlockCount, uint8* Out);
+
+    // Approximates the convex hull of a point cloud by taking the extreme point along DirectionCount
+    // evenly spread directions. Output points are unique and lie on the true hull.
+    static void ComputeHullPoints(const FHoloMeshVec3* Positions, int32 Count, TArray<FVector>& OutPoints, int32 DirectionCount = 64);
 };
 
 // -- Priority Queue --
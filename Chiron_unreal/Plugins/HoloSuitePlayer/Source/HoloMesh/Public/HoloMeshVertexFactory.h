@@ -16,6 +16,7 @@
 BEGIN_GLOBAL_SHADER_PARAMETER_STRUCT(FHoloMeshVertexFactoryParameters, )
 	SHADER_PARAMETER_SRV(Buffer<float>, PreviousPositionBuffer)
 	SHADER_PARAMETER(float, PreviousPositionWeight)
+	SHADER_PARAMETER(float, InterpolationWeight)
 END_GLOBAL_SHADER_PARAMETER_STRUCT()
 
 /**
@@ -50,6 +51,20 @@ public:
 	{
 		return HoloMeshUniformBuffer.GetReference();
 	}
+
+	// Decoded frames held by the previous and current position buffers and the frame presented
+	// in between them (Render Thread). InterpolationFromFrame is -1 when they can't be blended.
+	int InterpolationFromFrame = -1;
+	int InterpolationToFrame = -1;
+	float PresentedFrame = -1.0f;
+	float PublishedInterpolationWeight = 1.0f;
+	float PublishedPreviousPositionWeight = 0.0f;
+
+	// How far Frame is from InterpolationFromFrame to InterpolationToFrame, 1 if it's outside of them.
+	float GetInterpolationWeight(float Frame) const;
+
+	// Rewrites HoloMeshUniformBuffer with the interpolation weight of PresentedFrame (Render Thread).
+	void UpdateUniforms(float PreviousPositionWeight);
 };
 
 /**
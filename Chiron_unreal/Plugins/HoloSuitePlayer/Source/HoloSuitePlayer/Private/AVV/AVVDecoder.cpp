@@ -3,8 +3,12 @@
 #include "AVV/AVVDecoder.h"
 #include "RenderGraphUtils.h"
 
+#include <algorithm>
+
 IMPLEMENT_GLOBAL_SHADER(FAVVDecodeTextureBlock_BC4_CS, "/HoloSuitePlayer/AVV/AVVLumaDecodeCS.usf", "DecodeTextureBlockBC4", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FAVVCopyTextureBlock_BC4_CS,   "/HoloSuitePlayer/AVV/AVVLumaDecodeCS.usf", "CopyTextureBlockBC4",   SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FAVVDecodeTextureBlockDelta_BC4_CS, "/HoloSuitePlayer/AVV/AVVLumaDecodeCS.usf", "DecodeTextureBlockBC4Delta", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FAVVCopyTextureBlockDelta_BC4_CS,   "/HoloSuitePlayer/AVV/AVVLumaDecodeCS.usf", "CopyTextureBlockBC4Delta",   SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FAVVDecodeFrameAnim_None_CS,   "/HoloSuitePlayer/AVV/AVVAnimDecodeCS.usf", "DecodeFrameAnimNone",   SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FAVVDecodeFrameAnim_SSDR_CS,   "/HoloSuitePlayer/AVV/AVVAnimDecodeCS.usf", "DecodeFrameAnimSSDR",   SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FAVVDecodeFrameAnim_Delta_CS,  "/HoloSuitePlayer/AVV/AVVAnimDecodeCS.usf", "DecodeFrameAnimDelta",  SF_Compute);
@@ -16,6 +20,7 @@ DECLARE_CYCLE_STAT(TEXT("AVVDecoder.Update"),           STAT_AVVDecoder_Update,
 DECLARE_CYCLE_STAT(TEXT("AVVDecoder.DecodeAnimation"),  STAT_AVVDecoder_DecodeAnimation,    STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVDecoder.ClearTextures"),    STAT_AVVDecoder_ClearTextures,      STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVDecoder.DecodeTexture"),    STAT_AVVDecoder_DecodeTexture,      STATGROUP_HoloSuitePlayer);
+DECLARE_CYCLE_STAT(TEXT("AVVDecoder.UploadLuma"),       STAT_AVVDecoder_UploadLuma,         STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVDecoder.DecodePending"),    STAT_AVVDecoder_DecodePending,      STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVDecoder.UpdateDataCache"),  STAT_AVVDecoder_UpdateDataCache,    STATGROUP_HoloSuitePlayer);
 
@@ -23,6 +28,54 @@ DECLARE_GPU_STAT_NAMED(GPU_AVVDecoder_DecodeAnimation,  TEXT("AVVDecoder.GPUDeco
 DECLARE_GPU_STAT_NAMED(GPU_AVVDecoder_ClearTextures,    TEXT("AVVDecoder.GPUClearTextures"));
 DECLARE_GPU_STAT_NAMED(GPU_AVVDecoder_DecodeTexture,    TEXT("AVVDecoder.GPUDecodeTexture"));
 
+// Set to false to decode every stream regardless of LOD (textures are still skipped at LOD 2).
+static TAutoConsoleVariable<bool> CVarAVVLODDecodeProfiles(
+    TEXT("r.AVV.LODDecodeProfiles"),
+    true,
+    TEXT("Skips reading and decoding AVV streams that aren't needed at the mesh's current LOD."),
+    ECVF_Default);
+
+// Set to false to always decode the full mesh, coarser LODs still skip streams and frames.
+static TAutoConsoleVariable<bool> CVarAVVGeometryLODs(
+    TEXT("r.AVV.GeometryLODs"),
+    true,
+    TEXT("Decodes and draws the reduced triangle lists AVV files carry for coarser LODs."),
+    ECVF_Default);
+
+// Mobile GPUs pay the most for the compute decode and are the ones without BC4 sampling.
+static TAutoConsoleVariable<int32> CVarAVVCPULumaDecode(
+    TEXT("r.AVV.CPULumaDecode"),
+#if PLATFORM_ANDROID
+    2,
+#else
+    0,
+#endif
+    TEXT("Decodes AVV luma blocks on worker threads instead of the GPU. Applies to files opened afterwards.\n")
+    TEXT(" 0: GPU compute decode\n")
+    TEXT(" 1: CPU decode to an 8-bit texture\n")
+    TEXT(" 2: CPU transcode to ETC2 EAC R11, 8-bit where it isn't supported"),
+    ECVF_Default);
+
+static EAVVLumaFormat GetCPULumaFormat()
+{
+    int32 mode = CVarAVVCPULumaDecode.GetValueOnAnyThread();
+    if (mode >= 2 && GPixelFormats[PF_ETC2_R11_EAC].Supported)
+    {
+        return EAVVLumaFormat::EAC;
+    }
+    return (mode >= 1) ? EAVVLumaFormat::R8 : EAVVLumaFormat::BC4;
+}
+
+static EPixelFormat GetLumaPixelFormat(EAVVLumaFormat format)
+{
+    switch (format)
+    {
+        case EAVVLumaFormat::R8:    return PF_G8;
+        case EAVVLumaFormat::EAC:   return PF_ETC2_R11_EAC;
+        default:                    return PF_BC4;
+    }
+}
+
 // Sets default values
 UAVVDecoder::UAVVDecoder(const FObjectInitializer& ObjectInitializer) : UHoloMeshComponent(ObjectInitializer)
 {
@@ -35,6 +88,17 @@ UAVVDecoder::UAVVDecoder(const FObjectInitializer& ObjectInitializer) : UHoloMes
     PendingState.Reset();
     CurrentState.Reset();
 
+    // LOD 0 decodes everything, LOD 1 drops motion vectors and LOD 2 only decodes
+    // geometry and vertex colors.
+    LODDecodeFlags[0] = EAVVDecodeFlags::All;
+    LODDecodeFlags[1] = EAVVDecodeFlags::Texture | EAVVDecodeFlags::Normals;
+    LODDecodeFlags[2] = EAVVDecodeFlags::None;
+
+    for (int i = 0; i < HOLOMESH_MAX_LODS; ++i)
+    {
+        LODUpdateDivisors[i] = 1;
+    }
+
 #if PLATFORM_ANDROID
     bUseBC4HardwareDecoding = false;
 #else
@@ -68,18 +132,42 @@ bool UAVVDecoder::OpenAVV(UAVVFile* AVVFile, UMaterialInterface* NewMeshMaterial
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoder_OpenAVV);
 
     Close();
+    ClearCollisionProxies();
 
-    bool openSuccess = avvReader.Open(AVVFile);
+    bool openSuccess = avvReader.Open(AVVFile, bResidentPlayback);
     if (!openSuccess)
     {
         UE_LOG(LogHoloSuitePlayer, Error, TEXT("Failed to load AVV File."));
         return false;
     }
 
+    LumaFormat = GetCPULumaFormat();
+    avvReader.CPULumaFormat = LumaFormat;
+
     InitDecoder(NewMeshMaterial);
 
     GHoloMeshManager.Register(this, GetOwner());
 
+    // The reader asks for an update on an IO thread only when it has reads to issue or collect, and
+    // for a decode thread to parse what it read. Idle players queue nothing.
+    FGuid readerGUID = RegisteredGUID;
+    bReaderUpdateQueued = false;
+    bReaderPrepareQueued = false;
+    avvReader.SetUpdateCallback([this, readerGUID]
+    {
+        if (!bReaderUpdateQueued.exchange(true) && !GHoloMeshManager.AddWorkRequest(readerGUID, -1, -1, EHoloMeshWorkType::IO))
+        {
+            bReaderUpdateQueued = false;
+        }
+    });
+    avvReader.SetPrepareCallback([this, readerGUID]
+    {
+        if (!bReaderPrepareQueued.exchange(true) && !GHoloMeshManager.AddWorkRequest(readerGUID, -1, -1, EHoloMeshWorkType::Decode))
+        {
+            bReaderPrepareQueued = false;
+        }
+    });
+
     return true;
 }
 
@@ -93,10 +181,30 @@ void UAVVDecoder::Close()
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoder_Close);
 
+    avvReader.SetUpdateCallback(nullptr);
+    avvReader.SetPrepareCallback(nullptr);
     GHoloMeshManager.ClearRequests(RegisteredGUID);
     GHoloMeshManager.Unregister(RegisteredGUID);
     RegisteredGUID.Invalidate();
+    PrefetchState.Reset();
     DataCache.Empty();
+
+    if (HasDecodedFrameCache())
+    {
+        FreeDecodedFrameCache();
+    }
+
+    LumaMesh = nullptr;
+    LumaFrameNumber = -1;
+    LumaSegmentIndex = -1;
+
+    PresentedFrame = -1.0f;
+    RequestedPresentFrame = -1.0f;
+    LastAnimatedFrame = -1;
+    LastAnimatedVertexCount = 0;
+
+    SegmentLOD = 0;
+    SegmentLODCount = 1;
 }
 
 void UAVVDecoder::SetFrame(int frameNumber, bool force)
@@ -115,12 +223,35 @@ void UAVVDecoder::SetFrame(int frameNumber, bool force)
     {
         CurrentState.Reset();
         RequestedState.FrameNumber  = frameNumber;
+        RequestedPresentFrame = -1.0f;
         return;
     }
 
-    if (CurrentState.FrameNumber != frameNumber)
+    // With an update divisor the decoded frame can be ahead of the one that's presented.
+    if (CurrentState.FrameNumber != frameNumber || PresentedFrame != frameNumber)
     {
         RequestedState.FrameNumber = frameNumber;
+        RequestedPresentFrame = -1.0f;
+    }
+}
+
+void UAVVDecoder::SetSubFrame(float frame)
+{
+    int frameNumber = FMath::FloorToInt(frame);
+    int nextFrameNumber = FMath::CeilToInt(frame);
+
+    // Blending never crosses a segment, the last frame of one is held until the next one starts.
+    if (!bSubFramePresentation || !CanInterpolate() || nextFrameNumber >= FrameCount
+        || avvReader.GetSegmentIndex(nextFrameNumber) != avvReader.GetSegmentIndex(frameNumber))
+    {
+        SetFrame(frameNumber);
+        return;
+    }
+
+    if (CurrentState.FrameNumber != nextFrameNumber || PresentedFrame != frame)
+    {
+        RequestedState.FrameNumber = nextFrameNumber;
+        RequestedPresentFrame = frame;
     }
 }
 
@@ -134,12 +265,12 @@ void UAVVDecoder::SetFrameImmediate(int frameNumber)
         if (!DataCache.HasSegment(requestedSegment))
         {
             // Request segment + frame + texture.
-            avvReader.AddRequest(requestedSegment, frameNumber, ShouldRequestTexture(), true);
+            avvReader.AddRequest(requestedSegment, frameNumber, GetDecodeFlags(), true);
         }
         else if (!DataCache.HasFrame(frameNumber))
         {
             // Only request the frame data + texture.
-            avvReader.AddRequest(-1, frameNumber, ShouldRequestTexture(), true);
+            avvReader.AddRequest(-1, frameNumber, GetDecodeFlags(), true);
         }
 
         PendingState.FrameNumber = frameNumber;
@@ -150,6 +281,7 @@ void UAVVDecoder::SetFrameImmediate(int frameNumber)
     if (dataReady)
     {
         GHoloMeshManager.AddUpdateRequest(RegisteredGUID, 0, requestedSegment, frameNumber);
+        UpdateInstances(frameNumber, FrameCount);
     }
     else 
     {
@@ -159,6 +291,10 @@ void UAVVDecoder::SetFrameImmediate(int frameNumber)
 
 UMaterialInterface* UAVVDecoder::GetMaterial(int32 ElementIndex) const
 {
+    if (DecodedFrameMesh != nullptr)
+    {
+        return DecodedFrameMesh->Material;
+    }
     return HoloMesh[ReadIndex].Material;
 }
 
@@ -204,14 +340,27 @@ void UAVVDecoder::Update(float DeltaTime)
         HoloMeshLODDirty = false;
     }
 
-    // Update AVV reader via worker thread.
-    GHoloMeshManager.AddWorkRequest(RegisteredGUID, -1, -1);
-
     if (bImmediateMode)
     {
         return;
     }
 
+    float presentFrame = (RequestedPresentFrame > -1.0f) ? RequestedPresentFrame : (float)RequestedState.FrameNumber;
+
+    // Frames in between decoded ones are presented without waiting on the decoder.
+    if (RequestedState.FrameNumber > -1 && PendingState.FrameNumber < 0 && !IsDecodedFrameBound()
+        && (RequestedState.FrameNumber == CurrentState.FrameNumber || GetUpdateFrame(RequestedState.FrameNumber) == CurrentState.FrameNumber))
+    {
+        PresentFrame(presentFrame);
+        RequestedState.Reset();
+        RequestedPresentFrame = -1.0f;
+    }
+    else if (RequestedState.FrameNumber < 0 && bPresentedMotion)
+    {
+        // Nothing moved since the last frame, clear its motion vectors.
+        PresentFrame(PresentedFrame);
+    }
+
     if (DecoderState == EDecoderState::Idle)
     {
         // Check for newly requested frame
@@ -219,9 +368,22 @@ void UAVVDecoder::Update(float DeltaTime)
                  RequestedState.FrameNumber != CurrentState.FrameNumber &&
                  RequestedState.FrameNumber != PendingState.FrameNumber)
         {
-            PendingState = RequestedState;
-            RequestedState.Reset();
-            DecodePending(true, true);
+            // Looping clips replay the decoded frame cache without reading or decoding anything,
+            // its frames are presented whole.
+            if (BindCachedFrame(FMath::FloorToInt(presentFrame)))
+            {
+                RequestedState.Reset();
+                RequestedPresentFrame = -1.0f;
+            }
+            else
+            {
+                PendingState = RequestedState;
+                PendingState.FrameNumber = GetUpdateFrame(RequestedState.FrameNumber);
+                RequestedState.Reset();
+                RequestedPresentFrame = -1.0f;
+                DecodePending(true, true);
+                PresentFrame(presentFrame);
+            }
         }
     }
 
@@ -250,23 +412,97 @@ void UAVVDecoder::Update(float DeltaTime)
     }
 }
 
-void UAVVDecoder::DoThreadedWork(int sequenceIndex, int frameIndex)
+void UAVVDecoder::DoThreadedWork(int sequenceIndex, int frameIndex, EHoloMeshWorkType workType)
 {
+    // Cleared first so anything the update doesn't pick up queues another one.
+    if (workType == EHoloMeshWorkType::IO)
+    {
+        bReaderUpdateQueued = false;
+    }
+    else
+    {
+        bReaderPrepareQueued = false;
+    }
+
     if (!RegisteredGUID.IsValid())
     {
         return;
     }
 
-    avvReader.Update();
+    if (workType == EHoloMeshWorkType::IO)
+    {
+        avvReader.Update();
+    }
+    else
+    {
+        avvReader.Prepare();
+    }
+}
+
+void UAVVDecoder::Prefetch(int frameNumber, int frameCount, bool loop)
+{
+    if (!bInitialized || bImmediateMode || !RegisteredGUID.IsValid() || avvReader.FrameCount <= 0)
+    {
+        return;
+    }
+
+    if (loop)
+    {
+        frameNumber = ((frameNumber % avvReader.FrameCount) + avvReader.FrameCount) % avvReader.FrameCount;
+    }
+    else
+    {
+        int lastFrameNumber = FMath::Min(frameNumber + frameCount, avvReader.FrameCount);
+        frameNumber = FMath::Clamp(frameNumber, 0, avvReader.FrameCount - 1);
+        frameCount = FMath::Max(lastFrameNumber - frameNumber, 1);
+    }
+
+    UpdateDataCache();
+    PrefetchState.FrameNumber = frameNumber;
+    PrefetchFrameCount = frameCount;
+
+    int lastRequestedSegment = -1;
+    for (int n = 0; n < frameCount; ++n)
+    {
+        int prefetchFrameNumber = (frameNumber + n) % avvReader.FrameCount;
+        if (DataCache.HasFrame(prefetchFrameNumber))
+        {
+            continue;
+        }
+
+        int prefetchSegmentIndex = avvReader.GetSegmentIndex(prefetchFrameNumber);
+        if (prefetchSegmentIndex == lastRequestedSegment 
+            || prefetchSegmentIndex == DecodedSegmentIndex || DataCache.HasSegment(prefetchSegmentIndex))
+        {
+            prefetchSegmentIndex = -1;
+        }
+
+        if (avvReader.AddRequest(prefetchSegmentIndex, prefetchFrameNumber, GetDecodeFlags()) && prefetchSegmentIndex > -1)
+        {
+            lastRequestedSegment = prefetchSegmentIndex;
+        }
+    }
 }
 
 void UAVVDecoder::UpdateDataCache()
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoder_UpdateDataCache);
 
+    // Once playback has reached any of the prefetched frames the regular window covers them. Looping
+    // prefetches wrap around the end, non-looping ones never do so wrapping here is safe for both.
+    if (PrefetchState.FrameNumber > -1 && CurrentState.FrameNumber > -1)
+    {
+        int prefetchOffset = ((CurrentState.FrameNumber - PrefetchState.FrameNumber) % avvReader.FrameCount + avvReader.FrameCount) % avvReader.FrameCount;
+        if (prefetchOffset < PrefetchFrameCount)
+        {
+            PrefetchState.Reset();
+        }
+    }
+
     // Free any stale data thats older than our current segment/frame number.
     int SegmentIndex = avvReader.GetSegmentIndex(CurrentState.FrameNumber);
-    DataCache.FreeStaleData(SegmentIndex, CurrentState.FrameNumber);
+    int PrefetchSegmentIndex = PrefetchState.FrameNumber > -1 ? avvReader.GetSegmentIndex(PrefetchState.FrameNumber) : -1;
+    DataCache.FreeStaleData(SegmentIndex, CurrentState.FrameNumber, false, PrefetchSegmentIndex, PrefetchState.FrameNumber);
 
     // Cache the data from the finisher reader requests.
     FAVVReaderRequestRef request = avvReader.GetFinishedRequest();
@@ -293,7 +529,10 @@ bool UAVVDecoder::DecodePending(bool requestIfMissing, bool requestNextFrame)
     UpdateDataCache();
 
     int requestedSegmentIndex = avvReader.GetSegmentIndex(PendingState.FrameNumber);
-    bool segmentFound = DataCache.HasSegment(requestedSegmentIndex) || (DecodedSegmentIndex == requestedSegmentIndex);
+
+    // Decoded segments are freed, switching geometry LOD reads the segment again.
+    bool segmentFound = DataCache.HasSegment(requestedSegmentIndex) 
+        || (DecodedSegmentIndex == requestedSegmentIndex && !IsSegmentLODStale(requestedSegmentIndex));
     bool frameFound = DataCache.HasFrame(PendingState.FrameNumber);
     bool requestedSegment = false;
 
@@ -322,13 +561,13 @@ bool UAVVDecoder::DecodePending(bool requestIfMissing, bool requestNextFrame)
         {
             if (!segmentFound)
             {
-                avvReader.AddRequest(requestedSegmentIndex, PendingState.FrameNumber, ShouldRequestTexture());
+                avvReader.AddRequest(requestedSegmentIndex, PendingState.FrameNumber, GetDecodeFlags());
                 DecoderState = EDecoderState::WaitingCPU;
                 requestedSegment = true;
             }
             else if (!frameFound)
             {
-                avvReader.AddRequest(-1, PendingState.FrameNumber, ShouldRequestTexture());
+                avvReader.AddRequest(-1, PendingState.FrameNumber, GetDecodeFlags());
                 DecoderState = EDecoderState::WaitingCPU;
             }
         }
@@ -342,13 +581,16 @@ bool UAVVDecoder::DecodePending(bool requestIfMissing, bool requestNextFrame)
         // that window is very narrow. Cache ahead 2 frames instead.
         const int cacheAheadFrames = 2;
 
+        // Frames skipped by the update divisor are never decoded so they aren't read either.
+        int nextFrameNumber = PendingState.FrameNumber;
         for (int n = 1; n <= cacheAheadFrames; ++n)
         {
-            int nextFrameNumber = PendingState.FrameNumber + n;
+            nextFrameNumber = nextFrameNumber + 1;
             if (nextFrameNumber >= avvReader.FrameCount)
             {
                 nextFrameNumber = 0;
             }
+            nextFrameNumber = GetUpdateFrame(nextFrameNumber);
             int nextSegmentIndex = avvReader.GetSegmentIndex(nextFrameNumber);
             if ((requestedSegment && nextSegmentIndex == requestedSegmentIndex) 
                 || nextSegmentIndex == DecodedSegmentIndex || DataCache.HasSegment(nextSegmentIndex))
@@ -357,7 +599,7 @@ bool UAVVDecoder::DecodePending(bool requestIfMissing, bool requestNextFrame)
             }
             if (!DataCache.HasFrame(nextFrameNumber))
             {
-                avvReader.AddRequest(nextSegmentIndex, nextFrameNumber, ShouldRequestTexture());
+                avvReader.AddRequest(nextSegmentIndex, nextFrameNumber, GetDecodeFlags());
             }
         }
     }
@@ -374,6 +616,124 @@ void UAVVDecoder::FreeUnusedMemory()
     DataCache.Empty();
 }
 
+void UAVVDecoder::FreeDecodedFrameCache()
+{
+    bool wasBound = IsDecodedFrameBound();
+
+    UHoloMeshComponent::FreeDecodedFrameCache();
+    DecodedFrameCacheLOD = -1;
+
+    // The decoded mesh is still on the last frame decoded before the cache took over.
+    if (wasBound)
+    {
+        CurrentState.Reset();
+    }
+}
+
+bool UAVVDecoder::BindCachedFrame(int frameNumber)
+{
+    int decodeLOD = FMath::Clamp(GetDecodeLOD(), 0, HOLOMESH_MAX_LODS - 1);
+    if (HasDecodedFrameCache() && decodeLOD < DecodedFrameCacheLOD)
+    {
+        FreeDecodedFrameCache();
+    }
+
+    if (DecodedFrameCacheLOD < 0)
+    {
+        DecodedFrameCacheLOD = decodeLOD;
+    }
+
+    FHoloMesh* frameMesh = GetDecodedFrame(frameNumber);
+    if (frameMesh == nullptr)
+    {
+        return false;
+    }
+
+    BindDecodedFrame(frameMesh);
+    UpdateInstances(frameNumber, FrameCount);
+    CurrentState.FrameNumber = frameNumber;
+    PresentedFrame = frameNumber;
+    return true;
+}
+
+int UAVVDecoder::GetUpdateFrame(int frameNumber)
+{
+    int divisor = GetUpdateDivisor();
+    int segmentIndex = avvReader.GetSegmentIndex(frameNumber);
+    int startFrame = avvReader.GetSegmentStartFrame(segmentIndex);
+    if (divisor <= 1 || startFrame < 0)
+    {
+        return frameNumber;
+    }
+
+    // Every segment starts on a decoded frame and ends on one, interpolation never crosses them.
+    int endFrame = avvReader.GetSegmentStartFrame(segmentIndex + 1) - 1;
+    if (endFrame < startFrame)
+    {
+        endFrame = avvReader.FrameCount - 1;
+    }
+
+    int updateFrame = startFrame + FMath::DivideAndRoundUp(frameNumber - startFrame, divisor) * divisor;
+    return FMath::Min(updateFrame, endFrame);
+}
+
+bool UAVVDecoder::CanInterpolate()
+{
+    return !bImmediateMode && !bReversedCaching && HoloMesh[ReadIndex].SupportsInterpolation();
+}
+
+bool UAVVDecoder::IsInterpolating()
+{
+    return bSubFramePresentation ? CanInterpolate() : GetUpdateDivisor() > 1;
+}
+
+void UAVVDecoder::PresentFrame(float frame)
+{
+    float previousFrame = PresentedFrame;
+    PresentedFrame = frame;
+
+    if (IsDecodedFrameBound())
+    {
+        return;
+    }
+
+    // Without interpolation decoded frames are presented as they are, the meshes only need to
+    // hear about it once they've been interpolated.
+    bool interpolated = IsInterpolating();
+    if (!interpolated && !bFrameInterpolated && !bPresentedMotion)
+    {
+        return;
+    }
+
+    bool motion = interpolated && GetMotionVectorsEnabled() && EnumHasAnyFlags(GetDecodeFlags(), EAVVDecodeFlags::MotionVectors)
+        && frame != previousFrame;
+    for (uint32_t i = 0; i < HOLOMESH_BUFFER_COUNT; ++i)
+    {
+        HoloMesh[i].SetPresentedFrame(frame, motion && i == ReadIndex);
+    }
+
+    bFrameInterpolated = interpolated;
+    bPresentedMotion = motion;
+}
+
+void UAVVDecoder::PrepareFrameCapture(int frameNumber)
+{
+    BindDecodedFrame(nullptr);
+
+    if (FMath::Clamp(GetDecodeLOD(), 0, HOLOMESH_MAX_LODS - 1) == DecodedFrameCacheLOD)
+    {
+        UpdateDecodedFrameCache(frameNumber, FrameCount);
+    }
+}
+
+bool UAVVDecoder::CanCaptureDecodedFrame()
+{
+    // Frames decoded while the governor holds textures back would replay without them, and the
+    // cache is never complete while frames are skipped by the update divisor.
+    return !bLumaIncomplete && GetUpdateDivisor() == 1 && FMath::Clamp(GetDecodeLOD(), 0, HOLOMESH_MAX_LODS - 1) == DecodedFrameCacheLOD
+        && GHoloMeshManager.GetQualityLevel() < EHoloMeshQualityLevel::ReducedTextures;
+}
+
 void UAVVDecoder::UpdateBoundingBox(AVVEncodedSegment* segment, FHoloMesh* meshOut)
 {
     FHoloMeshVec3 originalMin = segment->GetAABBMin();
@@ -383,6 +743,60 @@ void UAVVDecoder::UpdateBoundingBox(AVVEncodedSegment* segment, FHoloMesh* meshO
     FHoloMeshVec3 finalMax = FHoloMeshVec3(originalMax.X * 100.0f, originalMax.Z * 100.0f, originalMax.Y * 100.0f);
 
     meshOut->LocalBox = FBox(finalMin, finalMax);
+    meshOut->bFrameBounds = false;
+}
+
+bool UAVVDecoder::UpdateFrameBoundingBox(AVVEncodedFrame* frame, FHoloMesh* meshOut, AVVEncodedFrame* previousFrame)
+{
+    if (frame == nullptr || !frame->hasAABB)
+    {
+        return false;
+    }
+
+    auto GetFrameBox = [](AVVEncodedFrame* boundsFrame)
+    {
+        FHoloMeshVec3 originalMin = boundsFrame->GetAABBMin();
+        FHoloMeshVec3 originalMax = boundsFrame->GetAABBMax();
+
+        FHoloMeshVec3 finalMin = FHoloMeshVec3(originalMin.X * 100.0f, originalMin.Z * 100.0f, originalMin.Y * 100.0f);
+        FHoloMeshVec3 finalMax = FHoloMeshVec3(originalMax.X * 100.0f, originalMax.Z * 100.0f, originalMax.Y * 100.0f);
+        return FBox(finalMin, finalMax);
+    };
+
+    meshOut->LocalBox = GetFrameBox(frame);
+
+    // Interpolated frames are drawn in between the previous frame and this one.
+    if (previousFrame != nullptr && previousFrame->hasAABB && IsInterpolating())
+    {
+        meshOut->LocalBox += GetFrameBox(previousFrame);
+    }
+
+    meshOut->bFrameBounds = true;
+    return true;
+}
+
+void UAVVDecoder::UpdateCollisionProxy(int segmentIndex, AVVEncodedSegment* segment)
+{
+    if (CollisionMode != EHoloMeshCollisionMode::Proxy || segment == nullptr)
+    {
+        return;
+    }
+
+    // Compute decoded positions never come back to the CPU so the proxy is the segment's bounding
+    // box rather than a hull of its vertices.
+    FHoloMeshVec3 originalMin = segment->GetAABBMin();
+    FHoloMeshVec3 originalMax = segment->GetAABBMax();
+
+    FBox segmentBox = FBox(
+        FVector(originalMin.X * 100.0f, originalMin.Z * 100.0f, originalMin.Y * 100.0f),
+        FVector(originalMax.X * 100.0f, originalMax.Z * 100.0f, originalMax.Y * 100.0f));
+
+    FVector corners[8];
+    segmentBox.GetVertices(corners);
+
+    TArray<FVector> boxCorners;
+    boxCorners.Append(corners, 8);
+    SetCollisionProxy(segmentIndex, boxCorners);
 }
 
 void UAVVDecoder::UploadData(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, void* DataPtr, uint32_t SizeInBytes, AVVEncodedSegment* SourceSegment, AVVEncodedFrame* SourceFrame)
@@ -458,6 +872,8 @@ void UAVVDecoder::DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFram
     FRDGBuffer* VertexBuffer = GraphBuilder.RegisterExternalBuffer(DecodedVertexBuffer);
     FRDGBufferUAVRef DecodedVertexBufferUAV = GraphBuilder.CreateUAV(VertexBuffer, PF_R32G32B32A32_UINT);
 
+    int vertexCount = DecodedSegmentVertexCount;
+
     if (frame->ssdrBoneCount == 0 && frame->deltaPosCount == 0)
     {
         FAVVDecodeFrameAnim_None_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVDecodeFrameAnim_None_CS::FParameters>();
@@ -465,7 +881,7 @@ void UAVVDecoder::DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFram
         PassParameters->DecodedVertexBuffer      = DecodedVertexBufferUAV;
         PassParameters->VertexPositionBuffer     = meshOut->VertexBuffers->GetPositionBufferUAV();
         PassParameters->VertexPrevPositionBuffer = meshOut->VertexBuffers->GetPrevPositionBufferUAV();
-        PassParameters->gVertexCount             = DecodedSegmentVertexCount;
+        PassParameters->gVertexCount             = vertexCount;
 
         TShaderMapRef<FAVVDecodeFrameAnim_None_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
         FComputeShaderUtils::AddPass(
@@ -474,7 +890,7 @@ void UAVVDecoder::DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFram
             ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
             ComputeShader,
             PassParameters,
-            FIntVector((DecodedSegmentVertexCount / 64) + 1, 1, 1)
+            FIntVector((vertexCount / 64) + 1, 1, 1)
         );
     }
     else if (frame->ssdrBoneCount > 0)
@@ -487,7 +903,7 @@ void UAVVDecoder::DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFram
         PassParameters->DecodedVertexBuffer      = DecodedVertexBufferUAV;
         PassParameters->VertexPositionBuffer     = meshOut->VertexBuffers->GetPositionBufferUAV();
         PassParameters->VertexPrevPositionBuffer = meshOut->VertexBuffers->GetPrevPositionBufferUAV();
-        PassParameters->gVertexCount             = DecodedSegmentVertexCount;
+        PassParameters->gVertexCount             = vertexCount;
         PassParameters->gBoneCount               = frame->ssdrBoneCount;
 
         TShaderMapRef<FAVVDecodeFrameAnim_SSDR_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
@@ -497,7 +913,7 @@ void UAVVDecoder::DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFram
             ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
             ComputeShader,
             PassParameters,
-            FIntVector((DecodedSegmentVertexCount / 64) + 1, 1, 1)
+            FIntVector((vertexCount / 64) + 1, 1, 1)
         );
     }
     else if (frame->deltaPosCount > 0)
@@ -510,7 +926,7 @@ void UAVVDecoder::DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFram
         PassParameters->DecodedVertexBuffer      = DecodedVertexBufferUAV;
         PassParameters->VertexPositionBuffer     = meshOut->VertexBuffers->GetPositionBufferUAV();
         PassParameters->VertexPrevPositionBuffer = meshOut->VertexBuffers->GetPrevPositionBufferUAV();
-        PassParameters->gVertexCount             = DecodedSegmentVertexCount;
+        PassParameters->gVertexCount             = vertexCount;
         PassParameters->gAABBMin                 = FHoloMeshVec3(frame->deltaAABBMin[0], frame->deltaAABBMin[1], frame->deltaAABBMin[2]);
         PassParameters->gAABBMax                 = FHoloMeshVec3(frame->deltaAABBMax[0], frame->deltaAABBMax[1], frame->deltaAABBMax[2]);
 
@@ -521,27 +937,99 @@ void UAVVDecoder::DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFram
             ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
             ComputeShader,
             PassParameters,
-            FIntVector((DecodedSegmentVertexCount / 64) + 1, 1, 1)
+            FIntVector((vertexCount / 64) + 1, 1, 1)
         );
     }
+
+    // The frame that was in the position buffer is now in the previous one, frames presented
+    // before this one are interpolated from it as long as both are from the same segment.
+    int frameIndex = (int)frame->frameIndex;
+    bool continuous = IsInterpolating() && LastAnimatedFrame > -1 && LastAnimatedFrame < frameIndex
+        && avvReader.GetSegmentIndex(LastAnimatedFrame) == DecodedSegmentIndex && vertexCount <= LastAnimatedVertexCount;
+    meshOut->SetDecodedFrame(GraphBuilder, frameIndex, continuous);
+
+    LastAnimatedFrame = frameIndex;
+    LastAnimatedVertexCount = vertexCount;
 }
 
-bool UAVVDecoder::ShouldRequestTexture()
+void UAVVDecoder::SetLODDecodeFlags(int LOD, EAVVDecodeFlags DecodeFlags)
 {
-    if (HoloMeshLOD < 2)
+    if (LOD < 0 || LOD >= HOLOMESH_MAX_LODS)
     {
-        return true;
+        return;
     }
-    return false;
+
+    LODDecodeFlags[LOD] = DecodeFlags;
+}
+
+void UAVVDecoder::SetLODUpdateDivisor(int LOD, int Divisor)
+{
+    if (LOD < 0 || LOD >= HOLOMESH_MAX_LODS)
+    {
+        return;
+    }
+
+    LODUpdateDivisors[LOD] = FMath::Max(Divisor, 1);
+}
+
+int UAVVDecoder::GetUpdateDivisor()
+{
+    if (!CanInterpolate())
+    {
+        return 1;
+    }
+
+    int LOD = FMath::Clamp(GetDecodeLOD(), 0, HOLOMESH_MAX_LODS - 1);
+    return LODUpdateDivisors[LOD];
+}
+
+int UAVVDecoder::GetGeometryLOD()
+{
+    if (!CVarAVVGeometryLODs.GetValueOnAnyThread())
+    {
+        return 0;
+    }
+
+    return FMath::Clamp(GetDecodeLOD(), 0, HOLOMESH_MAX_LODS - 1);
+}
+
+bool UAVVDecoder::IsSegmentLODStale(int segmentIndex)
+{
+    if (DecodedSegmentIndex != segmentIndex)
+    {
+        return false;
+    }
+
+    return FMath::Min(GetGeometryLOD(), SegmentLODCount - 1) != SegmentLOD;
+}
+
+EAVVDecodeFlags UAVVDecoder::GetDecodeFlags()
+{
+    int LOD = FMath::Clamp(GetDecodeLOD(), 0, HOLOMESH_MAX_LODS - 1);
+
+    EAVVDecodeFlags decodeFlags = LODDecodeFlags[LOD];
+    if (!CVarAVVLODDecodeProfiles.GetValueOnAnyThread())
+    {
+        decodeFlags = (LOD < 2) ? EAVVDecodeFlags::All : (EAVVDecodeFlags::All & ~EAVVDecodeFlags::Texture);
+    }
+
+    // Under load the quality governor stops texture reads and decodes beyond LOD 0.
+    if (LOD > 0 && GHoloMeshManager.GetQualityLevel() >= EHoloMeshQualityLevel::ReducedTextures)
+    {
+        decodeFlags &= ~EAVVDecodeFlags::Texture;
+    }
+
+    return decodeFlags;
 }
 
 void UAVVDecoder::ApplyTextures(FHoloMesh* Mesh, AVVEncodedSegment* segment)
 {
-    if (bUseBC4HardwareDecoding)
+    if (bUseBC4HardwareDecoding || LumaFormat != EAVVLumaFormat::BC4)
     {
-        if (!Mesh->BC4Texture.IsValid() && segment != nullptr)
+        EPixelFormat format = GetLumaPixelFormat(LumaFormat);
+        if ((!Mesh->BC4Texture.IsValid() || Mesh->BC4Texture.Format != format) && segment != nullptr)
         {
-            Mesh->BC4Texture.Create(segment->texture.width, segment->texture.height, EPixelFormat::PF_BC4, 3);
+            Mesh->BC4Texture.Create(segment->texture.width, segment->texture.height, format, 3);
             Mesh->MaskTexture.Create(segment->texture.width / 4, segment->texture.height / 4, RTF_R8, TextureFilter::TF_Nearest, true);
         }
 
@@ -576,6 +1064,33 @@ void UAVVDecoder::ClearTextures(FRDGBuilder& GraphBuilder, AVVEncodedSegment* se
     SCOPED_GPU_STAT(GraphBuilder.RHICmdList, GPU_AVVDecoder_ClearTextures);
     SCOPED_GPU_MASK(GraphBuilder.RHICmdList, FRHIGPUMask::All());
 
+    // The CPU copy is resized for the new segment with an empty mask, the next frame uploads
+    // all of it which clears the textures as well.
+    if (LumaFormat != EAVVLumaFormat::BC4)
+    {
+        int blockSize = (LumaFormat == EAVVLumaFormat::R8) ? 16 : 8;
+        LumaMirrorLevelCount = segment->texture.multiRes ? FMath::Clamp((int)segment->texture.levelBlockCounts.size(), 1, 3) : 1;
+
+        for (int level = 0; level < 3; ++level)
+        {
+            FLumaMirrorLevel& mirror = LumaMirror[level];
+            mirror.BlocksX = (segment->texture.width / 4) >> level;
+            mirror.BlocksY = (segment->texture.height / 4) >> level;
+
+            int blocks = (level < LumaMirrorLevelCount) ? mirror.BlocksX * mirror.BlocksY : 0;
+            if (mirror.Luma.Num() != blocks * blockSize)
+            {
+                mirror.Luma.SetNumZeroed(blocks * blockSize);
+            }
+            mirror.Mask.SetNumZeroed(blocks);
+            FMemory::Memzero(mirror.Mask.GetData(), mirror.Mask.Num());
+            mirror.Dirty.Reset();
+        }
+
+        meshOut->MaskTexture.SetClearFlag(true);
+        return;
+    }
+
     FTexture2DRHIRef RenderTargetTexture = meshOut->MaskTexture.GetRenderTargetRHI();
     bool validRT = RenderTargetTexture != nullptr && RenderTargetTexture->IsValid();
 
@@ -605,10 +1120,158 @@ void UAVVDecoder::ClearTextures(FRDGBuilder& GraphBuilder, AVVEncodedSegment* se
     }
 }
 
+void UAVVDecoder::CopyLumaTextures(FRDGBuilder& GraphBuilder, FHoloMesh* sourceMesh, FHoloMesh* meshOut)
+{
+    if (bUseBC4HardwareDecoding)
+    {
+        if (sourceMesh->BC4Texture.IsValid() && meshOut->BC4Texture.IsValid())
+        {
+            HoloMeshUtilities::CopyTexture(GraphBuilder, sourceMesh->BC4Texture.GetTextureRHI(), meshOut->BC4Texture.GetTextureRHI());
+        }
+    }
+    else if (sourceMesh->LumaTexture.IsValid() && meshOut->LumaTexture.IsValid())
+    {
+        HoloMeshUtilities::CopyTexture(GraphBuilder, sourceMesh->LumaTexture.GetRenderTargetRHI(), meshOut->LumaTexture.GetRenderTargetRHI());
+    }
+
+    if (sourceMesh->MaskTexture.IsValid() && meshOut->MaskTexture.IsValid())
+    {
+        HoloMeshUtilities::CopyTexture(GraphBuilder, sourceMesh->MaskTexture.GetRenderTargetRHI(), meshOut->MaskTexture.GetRenderTargetRHI());
+        meshOut->MaskTexture.SetClearFlag(false);
+    }
+}
+
+void UAVVDecoder::UploadFrameLuma(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* meshOut)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AVVDecoder_UploadLuma);
+
+    if (LumaBlockMap.Num() == 0)
+    {
+        UE_LOG(LogHoloSuitePlayer, Warning, TEXT("Texture block map hasn't been loaded yet."));
+        return;
+    }
+
+    bool continuous = (LumaFrameNumber == (int)frame->frameIndex - 1) && (LumaSegmentIndex == DecodedSegmentIndex);
+    bLumaIncomplete = frame->deltaBlocks && (!continuous || bLumaIncomplete);
+
+    // The mirror already holds whatever the previous frame left behind. After a seek or dropped
+    // frame the texture is incomplete until the next full frame refreshes it, same as on the GPU path.
+    LumaMesh = meshOut;
+    LumaFrameNumber = frame->frameIndex;
+    LumaSegmentIndex = DecodedSegmentIndex;
+
+    // Blocks are only ever decoded on the reader's threads, a frame without them just uploads what's dirty.
+    if (frame->decodedLumaContent != nullptr && frame->decodedLumaFormat == LumaFormat)
+    {
+        const uint8_t* decoded = frame->decodedLumaContent->Data;
+        const uint32_t* blockIndices = frame->deltaBlocks ? (uint32_t*)&frame->textureContent->Data[frame->blockIndexOffset] : nullptr;
+        int blockSize = (LumaFormat == EAVVLumaFormat::R8) ? 16 : 8;
+        int level = 0;
+
+        // Block map indices only ever increase so the mip level can be tracked as we go.
+        for (uint32_t i = 0; i < frame->blockCount; ++i)
+        {
+            uint32_t mapIndex = (blockIndices != nullptr) ? blockIndices[i] : i;
+            while (level < LumaMirrorLevelCount && mapIndex >= LumaLevelEnds[level])
+            {
+                level++;
+            }
+            if (level >= LumaMirrorLevelCount || mapIndex >= (uint32_t)LumaBlockMap.Num())
+            {
+                break;
+            }
+
+            FLumaMirrorLevel& mirror = LumaMirror[level];
+            int blockX = LumaBlockMap[mapIndex] & 0xFFFF;
+            int blockY = LumaBlockMap[mapIndex] >> 16;
+            if (blockX >= mirror.BlocksX || blockY >= mirror.BlocksY)
+            {
+                continue;
+            }
+
+            const uint8_t* block = &decoded[i * blockSize];
+            if (LumaFormat == EAVVLumaFormat::R8)
+            {
+                int pitch = mirror.BlocksX * 4;
+                for (int row = 0; row < 4; ++row)
+                {
+                    FMemory::Memcpy(&mirror.Luma[((blockY * 4) + row) * pitch + (blockX * 4)], &block[row * 4], 4);
+                }
+            }
+            else
+            {
+                FMemory::Memcpy(&mirror.Luma[((blockY * mirror.BlocksX) + blockX) * 8], block, 8);
+            }
+            mirror.Mask[(blockY * mirror.BlocksX) + blockX] = 255;
+
+            // Every mesh that's seen the mirror misses this block until it's uploaded to it.
+            FIntRect blockRect(blockX, blockY, blockX + 1, blockY + 1);
+            for (TPair<FHoloMesh*, FIntRect>& meshDirty : mirror.Dirty)
+            {
+                if (meshDirty.Value.Area() > 0)
+                {
+                    meshDirty.Value.Union(blockRect);
+                }
+                else
+                {
+                    meshDirty.Value = blockRect;
+                }
+            }
+        }
+    }
+
+    for (int level = 0; level < LumaMirrorLevelCount; ++level)
+    {
+        FLumaMirrorLevel& mirror = LumaMirror[level];
+        FIntRect* meshDirty = mirror.Dirty.Find(meshOut);
+        FIntRect blocks = (meshDirty != nullptr) ? *meshDirty : FIntRect(0, 0, mirror.BlocksX, mirror.BlocksY);
+        mirror.Dirty.Add(meshOut, FIntRect());
+
+        if (blocks.Area() <= 0)
+        {
+            continue;
+        }
+
+        // R8 rows are texel rows while EAC rows are rows of blocks, both start at the rect's first block.
+        if (LumaFormat == EAVVLumaFormat::R8)
+        {
+            uint32 pitch = mirror.BlocksX * 4;
+            HoloMeshUtilities::UpdateTexture(GraphBuilder, meshOut->BC4Texture.GetTextureRHI(), level, blocks * 4, &mirror.Luma[(blocks.Min.Y * 4 * pitch) + (blocks.Min.X * 4)], pitch);
+        }
+        else
+        {
+            uint32 pitch = mirror.BlocksX * 8;
+            HoloMeshUtilities::UpdateTexture(GraphBuilder, meshOut->BC4Texture.GetTextureRHI(), level, blocks * 4, &mirror.Luma[(blocks.Min.Y * pitch) + (blocks.Min.X * 8)], pitch);
+        }
+        HoloMeshUtilities::UpdateTexture(GraphBuilder, meshOut->MaskTexture.GetRenderTargetRHI(), level, blocks, &mirror.Mask[(blocks.Min.Y * mirror.BlocksX) + blocks.Min.X], mirror.BlocksX);
+    }
+
+    meshOut->MaskTexture.SetClearFlag(false);
+}
+
 void UAVVDecoder::UpdateTextureBlockMap(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment)
 {
     uint8_t* data = segment->content->Data;
 
+    // The CPU path places blocks itself, the GPU never sees the block map.
+    if (LumaFormat != EAVVLumaFormat::BC4)
+    {
+        LumaBlockMap.SetNumUninitialized(segment->texture.blockCount);
+        FMemory::Memcpy(LumaBlockMap.GetData(), &data[segment->texture.blockDataOffset], segment->texture.blockCount * sizeof(uint32));
+
+        // Block map range of each mip, finest first.
+        uint32_t levelEnd = segment->texture.multiRes ? 0 : segment->texture.blockCount;
+        for (int level = 0; level < 3; ++level)
+        {
+            if (segment->texture.multiRes && level < (int)segment->texture.levelBlockCounts.size())
+            {
+                levelEnd += segment->texture.levelBlockCounts[level];
+            }
+            LumaLevelEnds[level] = levelEnd;
+        }
+        return;
+    }
+
     if (TextureBlockMapBuffer == nullptr)
     {
         FRDGBuffer* Buffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), avvReader.Limits.MaxTextureBlocks), TEXT("AVVTextureBlockData"));
@@ -634,7 +1297,7 @@ void UAVVDecoder::DecodeFrameTexture(FRDGBuilder& GraphBuilder, AVVEncodedFrame*
         return;
     }
 
-    if (bUseBC4HardwareDecoding)
+    if (bUseBC4HardwareDecoding || LumaFormat != EAVVLumaFormat::BC4)
     {
         if (!meshOut->BC4Texture.IsValid())
         {
@@ -669,17 +1332,44 @@ void UAVVDecoder::DecodeFrameTexture(FRDGBuilder& GraphBuilder, AVVEncodedFrame*
         return;
     }
 
+    // LOD dictates some features.
+    bool decodeTexture = EnumHasAnyFlags(GetDecodeFlags(), EAVVDecodeFlags::Texture);
+
+    if (LumaFormat != EAVVLumaFormat::BC4)
+    {
+        if (frame->blockDecode && decodeTexture)
+        {
+            UploadFrameLuma(GraphBuilder, frame, meshOut);
+        }
+        return;
+    }
+
     if (TextureBlockMapBuffer == nullptr)
     {
         UE_LOG(LogHoloSuitePlayer, Warning, TEXT("Texture block map hasn't been loaded yet."));
         return;
     }
 
-    // LOD dictates some features.
-    int LOD = GetHoloMeshLOD();
+    // Delta frames only hold the blocks that changed since the previous frame so the target
+    // texture has to contain the previous frame already. When decoding alternates between
+    // meshes it's copied over from the mesh the previous frame was decoded into. After a seek
+    // or dropped frame the texture is incomplete until the next full frame refreshes it.
+    if (frame->blockDecode && decodeTexture)
+    {
+        bool continuous = (LumaFrameNumber == (int)frame->frameIndex - 1) && (LumaSegmentIndex == DecodedSegmentIndex);
+        if (frame->deltaBlocks && continuous && LumaMesh != nullptr && LumaMesh != meshOut)
+        {
+            CopyLumaTextures(GraphBuilder, LumaMesh, meshOut);
+        }
+        bLumaIncomplete = frame->deltaBlocks && (!continuous || bLumaIncomplete);
+
+        LumaMesh = meshOut;
+        LumaFrameNumber = frame->frameIndex;
+        LumaSegmentIndex = DecodedSegmentIndex;
+    }
 
     // Decode Texture Blocks to Luma Texture
-    if (frame->blockDecode && LOD < 2 && frame->lumaDataSize > 0)
+    if (frame->blockDecode && decodeTexture && frame->lumaDataSize > 0)
     {
         uint8_t* data = frame->textureContent->Data;
 
@@ -690,13 +1380,36 @@ void UAVVDecoder::DecodeFrameTexture(FRDGBuilder& GraphBuilder, AVVEncodedFrame*
         FRDGBuffer* BlockMapBuffer = GraphBuilder.RegisterExternalBuffer(TextureBlockMapBuffer);
         FRDGBufferUAVRef TextureBlockMapBufferUAV = GraphBuilder.CreateUAV(BlockMapBuffer, PF_R32_UINT);
 
+        // Block map index of each changed block, sorted ascending.
+        uint32_t* blockIndices = nullptr;
+        FRDGBufferUAVRef LumaBlockIndexBufferUAV = nullptr;
+        if (frame->deltaBlocks)
+        {
+            blockIndices = (uint32_t*)&data[frame->blockIndexOffset];
+
+            FRDGBufferRef LumaBlockIndexBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), frame->blockCount), TEXT("AVVFrameLumaBlockIndices"));
+            LumaBlockIndexBufferUAV = GraphBuilder.CreateUAV(LumaBlockIndexBuffer, PF_R32_UINT);
+            UploadData(GraphBuilder, LumaBlockIndexBuffer, blockIndices, frame->blockCount * sizeof(uint32_t), nullptr, frame);
+        }
+
         auto DecodeLevel = [&](int mipLevel, int blockCount, int blockOffset)
         {
-            if (bUseBC4HardwareDecoding)
+            // Narrow the level's range of the block map down to the changed blocks inside it.
+            if (frame->deltaBlocks)
             {
-                TShaderMapRef<FAVVCopyTextureBlock_BC4_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
-                FAVVCopyTextureBlock_BC4_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVCopyTextureBlock_BC4_CS::FParameters>();
+                uint32_t* first = std::lower_bound(blockIndices, blockIndices + frame->blockCount, (uint32_t)blockOffset);
+                uint32_t* last = std::lower_bound(first, blockIndices + frame->blockCount, (uint32_t)(blockOffset + blockCount));
+                blockOffset = first - blockIndices;
+                blockCount = last - first;
+
+                if (blockCount <= 0)
+                {
+                    return;
+                }
+            }
 
+            if (bUseBC4HardwareDecoding)
+            {
                 int divisor = 4 * FMath::Pow(2.0, mipLevel);
                 FIntPoint mipSize = FIntPoint(DecodedSegmentTextureInfo.width / divisor, DecodedSegmentTextureInfo.height / divisor);
 
@@ -709,24 +1422,77 @@ void UAVVDecoder::DecodeFrameTexture(FRDGBuilder& GraphBuilder, AVVEncodedFrame*
 
                 FRDGTextureUAVRef BC4StagingTextureUAV = GraphBuilder.CreateUAV(BC4StagingTexture);
 
+                if (frame->deltaBlocks)
+                {
+                    // The whole mip is copied back out of staging so it starts with the current blocks.
+                    HoloMeshUtilities::CopyTexture(GraphBuilder, FIntVector(mipSize.X * 4, mipSize.Y * 4, 0), meshOut->BC4Texture.GetTextureRHI(), mipLevel, BC4StagingTexture, 0);
+
+                    TShaderMapRef<FAVVCopyTextureBlockDelta_BC4_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+                    FAVVCopyTextureBlockDelta_BC4_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVCopyTextureBlockDelta_BC4_CS::FParameters>();
+
+                    PassParameters->TextureBlockDataBuffer  = TextureBlockMapBufferUAV;
+                    PassParameters->LumaBlockDataBuffer     = LumaBlockDataBufferUAV;
+                    PassParameters->LumaBlockIndexBuffer    = LumaBlockIndexBufferUAV;
+                    PassParameters->BC4StagingTextureOut    = BC4StagingTextureUAV;
+                    PassParameters->MaskTextureOut          = meshOut->MaskTexture.GetRenderTargetUAV(mipLevel);
+                    PassParameters->gBlockCount             = blockCount;
+                    PassParameters->gBlockOffset            = blockOffset;
+
+                    FComputeShaderUtils::AddPass(
+                        GraphBuilder,
+                        RDG_EVENT_NAME("AVVDecoder.TextureDelta_%d", mipLevel),
+                        ERDGPassFlags::Compute,
+                        ComputeShader,
+                        PassParameters,
+                        FIntVector((blockCount / 64) + 1, 1, 1)
+                    );
+                }
+                else
+                {
+                    TShaderMapRef<FAVVCopyTextureBlock_BC4_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+                    FAVVCopyTextureBlock_BC4_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVCopyTextureBlock_BC4_CS::FParameters>();
+
+                    PassParameters->TextureBlockDataBuffer  = TextureBlockMapBufferUAV;
+                    PassParameters->LumaBlockDataBuffer     = LumaBlockDataBufferUAV;
+                    PassParameters->BC4StagingTextureOut    = BC4StagingTextureUAV;
+                    PassParameters->MaskTextureOut          = meshOut->MaskTexture.GetRenderTargetUAV(mipLevel);
+                    PassParameters->gBlockCount             = blockCount;
+                    PassParameters->gBlockOffset            = blockOffset;
+
+                    FComputeShaderUtils::AddPass(
+                        GraphBuilder,
+                        RDG_EVENT_NAME("AVVDecoder.Texture_%d", mipLevel),
+                        ERDGPassFlags::Compute,
+                        ComputeShader,
+                        PassParameters,
+                        FIntVector((blockCount / 64) + 1, 1, 1)
+                    );
+                }
+
+                // Copy the unpacked data from BC4 staging into actual BC4 texture.
+                HoloMeshUtilities::CopyTexture(GraphBuilder, FIntVector(mipSize.X, mipSize.Y, 0), BC4StagingTexture, 0, meshOut->BC4Texture.GetTextureRHI(), mipLevel);
+            }
+            else if (frame->deltaBlocks)
+            {
+                TShaderMapRef<FAVVDecodeTextureBlockDelta_BC4_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+                FAVVDecodeTextureBlockDelta_BC4_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVDecodeTextureBlockDelta_BC4_CS::FParameters>();
+
                 PassParameters->TextureBlockDataBuffer  = TextureBlockMapBufferUAV;
                 PassParameters->LumaBlockDataBuffer     = LumaBlockDataBufferUAV;
-                PassParameters->BC4StagingTextureOut    = BC4StagingTextureUAV;
+                PassParameters->LumaBlockIndexBuffer    = LumaBlockIndexBufferUAV;
+                PassParameters->LumaTextureOut          = meshOut->LumaTexture.GetRenderTargetUAV(mipLevel);
                 PassParameters->MaskTextureOut          = meshOut->MaskTexture.GetRenderTargetUAV(mipLevel);
                 PassParameters->gBlockCount             = blockCount;
                 PassParameters->gBlockOffset            = blockOffset;
 
                 FComputeShaderUtils::AddPass(
                     GraphBuilder,
-                    RDG_EVENT_NAME("AVVDecoder.Texture_%d", mipLevel),
+                    RDG_EVENT_NAME("AVVDecoder.TextureDelta_%d", mipLevel),
                     ERDGPassFlags::Compute,
                     ComputeShader,
                     PassParameters,
                     FIntVector((blockCount / 64) + 1, 1, 1)
                 );
-
-                // Copy the unpacked data from BC4 staging into actual BC4 texture.
-                HoloMeshUtilities::CopyTexture(GraphBuilder, FIntVector(mipSize.X, mipSize.Y, 0), BC4StagingTexture, 0, meshOut->BC4Texture.GetTextureRHI(), mipLevel);
             }
             else
             {
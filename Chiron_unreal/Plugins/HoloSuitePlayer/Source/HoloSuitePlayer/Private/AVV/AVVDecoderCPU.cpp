@@ -96,23 +96,40 @@ void UAVVDecoderCPU::Update(float DeltaTime)
         int holoMeshIndex = ReadIndex;
 
         int pendingSegment = avvReader.GetSegmentIndex(PendingState.FrameNumber);
-        bool updatedSegment = pendingSegment != DecodedSegmentIndex;
+        bool updatedSegment = pendingSegment != DecodedSegmentIndex 
+            || (IsSegmentLODStale(pendingSegment) && DataCache.HasSegment(pendingSegment));
         if (updatedSegment)
         {
             holoMeshIndex = WriteIndex;
+
+            AVVEncodedSegment* segment = DataCache.GetSegment(pendingSegment);
+            SegmentLOD = segment->GetGeometryLOD(GetGeometryLOD());
+            SegmentLODCount = (int)segment->geometryLODs.size() + 1;
         }
 
+        PrepareFrameCapture(PendingState.FrameNumber);
         GHoloMeshManager.AddUpdateRequest(RegisteredGUID, holoMeshIndex, pendingSegment, PendingState.FrameNumber);
+        UpdateInstances(PendingState.FrameNumber, FrameCount);
+
+        // Interpolation never crosses segments.
+        AVVEncodedFrame* previousFrame = updatedSegment ? nullptr : DataCache.GetFrame(CurrentState.FrameNumber);
 
         CurrentState = PendingState;
         PendingState.Reset();
 
         // Update bounding box.
+        FHoloMesh* mesh = GetHoloMesh(holoMeshIndex);
         if (updatedSegment)
         {
             AVVEncodedSegment* segment = DataCache.GetSegment(pendingSegment);
-            FHoloMesh* mesh = GetHoloMesh(holoMeshIndex);
             UpdateBoundingBox(segment, mesh);
+            UpdateCollisionProxy(pendingSegment, segment);
+        }
+
+        // Segment changes update bounds when the meshes are swapped.
+        if (UpdateFrameBoundingBox(DataCache.GetFrame(CurrentState.FrameNumber), mesh, previousFrame) && !updatedSegment)
+        {
+            UpdateLocalBounds();
         }
 
         DecoderState = EDecoderState::WaitingGPU;
@@ -146,6 +163,12 @@ void UAVVDecoderCPU::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpd
     else
     {
         frame = DataCache.GetFrame(UpdateRequest.FrameIndex);
+
+        // The segment was read again to decode it at another geometry LOD.
+        if (frame != nullptr && DecodedSegmentLOD != SegmentLOD)
+        {
+            segment = DataCache.GetSegment(UpdateRequest.SegmentIndex);
+        }
     }
 
     if (mesh == nullptr || (segment == nullptr && frame == nullptr))
@@ -157,19 +180,22 @@ void UAVVDecoderCPU::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpd
     // Sequence Update
     if (segment != nullptr)
     {
-        CPUDecodeMesh(mesh, segment);
+        int lod = segment->GetGeometryLOD(SegmentLOD);
+        uint32_t vertexCount = segment->GetVertexCount(lod);
+
+        CPUDecodeMesh(mesh, segment, lod);
 
         // Vertex Data
         if (DecodedVertexBuffer == nullptr)
         {
             FRDGBuffer* Buffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t) * 4, avvReader.Limits.MaxVertexCount * 8), TEXT("AVVDecodedVertexBuffer"));
-            UploadData(GraphBuilder, Buffer, DecodedVertexData, segment->vertexCount * 32, segment);
+            UploadData(GraphBuilder, Buffer, DecodedVertexData, vertexCount * 32, segment);
             HoloMeshUtilities::ConvertToPooledBuffer(GraphBuilder, Buffer, DecodedVertexBuffer);
         }
         else
         {
             FRDGBuffer* Buffer = GraphBuilder.RegisterExternalBuffer(DecodedVertexBuffer);
-            UploadData(GraphBuilder, Buffer, DecodedVertexData, segment->vertexCount * 32, segment);
+            UploadData(GraphBuilder, Buffer, DecodedVertexData, vertexCount * 32, segment);
         }
 
         // Texture Block Map
@@ -192,7 +218,8 @@ void UAVVDecoderCPU::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpd
             });
         
         DecodedSegmentIndex = UpdateRequest.SegmentIndex;
-        DecodedSegmentVertexCount = segment->vertexCount;
+        DecodedSegmentVertexCount = vertexCount;
+        DecodedSegmentLOD = lod;
         DecodedSegmentTextureInfo = segment->texture;
         RequiresSwap = true;
         segment->processed = true;
@@ -202,11 +229,13 @@ void UAVVDecoderCPU::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpd
     {
         bool requiresMeshUpdate = false;
         EHoloMeshUpdateFlags updateFlags = EHoloMeshUpdateFlags::None;
+        EAVVDecodeFlags decodeFlags = GetDecodeFlags();
 
         // Decode and update vertex colors
         if (frame->colorCount > 0 && frame->normalCount > 0)
         {
-            CPUDecodeFrameColorsNormals(mesh, frame);
+            CPUDecodeFrameColorsNormals(mesh, frame, EnumHasAnyFlags(decodeFlags, EAVVDecodeFlags::Normals));
+            mesh->VertexBuffers->MarkDirty(EHoloMeshUpdateFlags::Colors, 0, DecodedSegmentVertexCount);
 
             requiresMeshUpdate = true;
             updateFlags = EHoloMeshUpdateFlags::Colors;
@@ -214,6 +243,7 @@ void UAVVDecoderCPU::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpd
         else if (frame->colorCount > 0)
         {
             CPUDecodeFrameColors(mesh, frame);
+            mesh->VertexBuffers->MarkDirty(EHoloMeshUpdateFlags::Colors, 0, DecodedSegmentVertexCount);
 
             requiresMeshUpdate = true;
             updateFlags = EHoloMeshUpdateFlags::Colors;
@@ -236,8 +266,8 @@ void UAVVDecoderCPU::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpd
             DecodeFrameAnimation(GraphBuilder, frame, mesh);
         }
 
-        // Render/decode luma
-        if (true)
+        // Render/decode luma, delta frames without changed blocks still advance the luma frame.
+        if ((frame->lumaCount > 0 || frame->deltaBlocks) && EnumHasAnyFlags(decodeFlags, EAVVDecodeFlags::Texture))
         {
             DecodeFrameTexture(GraphBuilder, frame, mesh);
         }
@@ -245,6 +275,13 @@ void UAVVDecoderCPU::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpd
         frame->processed = true;
     }
 
+    // Keep a copy around for instances drawing with a frame offset.
+    CaptureInstanceFrame_RenderThread(GraphBuilder, mesh, UpdateRequest.FrameIndex);
+    if (CanCaptureDecodedFrame())
+    {
+        CaptureDecodedFrame_RenderThread(GraphBuilder, mesh, UpdateRequest.FrameIndex);
+    }
+
     DecoderState = EDecoderState::FinishedGPU;
 }
 
@@ -258,7 +295,7 @@ void UAVVDecoderCPU::RequestCulled_RenderThread(FHoloMeshUpdateRequest request)
     CurrentState.Reset();
 }
 
-bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segment)
+bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segment, int lod)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoderCPU_DecodeMesh);
 
@@ -299,7 +336,11 @@ bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segmen
         return false;
     }
 
-    int vertCount = segment->vertexCount;
+    // Coarser LODs only use a prefix of the vertices and have their own triangles.
+    lod = segment->GetGeometryLOD(lod);
+    uint32_t vertCount = segment->GetVertexCount(lod);
+    uint32_t compactVertCount = segment->GetCompactVertexCount(lod);
+    uint32_t indexCount = segment->GetIndexCount(lod);
 
     // AVV_SEGMENT_POS_SKIN_EXPAND_128
     data = (uint32_t*)(&SegmentData[segment->vertexDataOffset]);
@@ -312,7 +353,7 @@ bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segmen
         float pos0[3];
         float pos1[3];
 
-        uint32 vertexPairCount = (segment->vertexCount / 2);
+        uint32 vertexPairCount = FMath::Min((vertCount + 1) / 2, segment->vertexCount / 2);
 
         for (uint32_t v = 0; v < vertexPairCount; ++v)
         {
@@ -342,7 +383,7 @@ bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segmen
         float pos[3];
         float boneWeights[4];
 
-        for (uint32_t v = 0; v < segment->compactVertexCount; ++v)
+        for (uint32_t v = 0; v < compactVertCount; ++v)
         {
             // Each encoded vertex is 16 bytes.
             readPos = v * 4;
@@ -397,7 +438,8 @@ bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segmen
     if (segment->uv12normal888)
     {
         data = (uint32_t*)(&SegmentData[segment->uvDataOffset]);
-        for (uint32_t v = 0; v < (segment->uvCount / 2); ++v)
+        uint32_t uvPairCount = FMath::Min((vertCount + 1) / 2, segment->uvCount / 2);
+        for (uint32_t v = 0; v < uvPairCount; ++v)
         {
             // We decode in sets of 2, each is 6 bytes.
             readPos = v * 3;
@@ -432,7 +474,8 @@ bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segmen
     else
     {
         data = (uint32_t*)(&SegmentData[segment->uvDataOffset]);
-        for (uint32_t v = 0; v < segment->uvCount; ++v)
+        uint32_t uvCount = FMath::Min(vertCount, segment->uvCount);
+        for (uint32_t v = 0; v < uvCount; ++v)
         {
             // Each uv is 1 byte.
             readPos = v * 1;
@@ -448,7 +491,13 @@ bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segmen
 
     // Indices
     FHoloMeshIndexBuffer::IndexWriter Indices(meshOut->IndexBuffer);
-    if (segment->index32Bit)
+    if (lod > 0)
+    {
+        // AVV_SEGMENT_TRIS_LODS_32
+        uint32_t* index32 = (uint32_t*)(&SegmentData[segment->geometryLODs[lod - 1].indexDataOffset]);
+        Indices.Write(index32, indexCount);
+    }
+    else if (segment->index32Bit)
     {
         // AVV_SEGMENT_TRIS_32
         uint32_t* index32 = (uint32_t*)(&SegmentData[segment->indexDataOffset]);
@@ -461,8 +510,11 @@ bool UAVVDecoderCPU::CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segmen
         Indices.Write(index16, segment->indexCount);
     }
 
-    // Clear unused entries in index buffer.
-    meshOut->IndexBuffer->Clear(segment->indexCount);
+    // Buffers are allocated at the reader's limits, draws and uploads only cover the segment's range.
+    meshOut->IndexBuffer->SetUsedIndices(indexCount);
+    meshOut->VertexBuffers->SetNumVertices(vertCount);
+    meshOut->IndexBuffer->MarkDirty(0, indexCount);
+    meshOut->VertexBuffers->MarkDirty(EHoloMeshUpdateFlags::Normals | EHoloMeshUpdateFlags::UVs, 0, vertCount);
 
     double decodeMeshTime = FPlatformTime::Seconds() - decodeMeshStart;
     //UE_LOG(LogHoloSuitePlayer, Warning, TEXT("Decode Mesh Time: %f"), decodeMeshTime);
@@ -519,7 +571,7 @@ inline FHoloMeshVec3 decodeNormalOct16(FHoloMeshVec2 f)
     return n;
 }
 
-bool UAVVDecoderCPU::CPUDecodeFrameColorsNormals(FHoloMesh* meshOut, AVVEncodedFrame* frame)
+bool UAVVDecoderCPU::CPUDecodeFrameColorsNormals(FHoloMesh* meshOut, AVVEncodedFrame* frame, bool decodeNormals)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoderCPU_CPUDecodeFrameColorsNormals);
 
@@ -542,7 +594,21 @@ bool UAVVDecoderCPU::CPUDecodeFrameColorsNormals(FHoloMesh* meshOut, AVVEncodedF
 
     // On CPU/Mobile decoding the color buffer is used for both colors and normals.
     // The packed color+normal is 32 bits so it matches the color stride perfectly.
-    memcpy(Colors, data, sizeof(uint32_t) * DecodedSegmentVertexCount);
+    if (decodeNormals)
+    {
+        memcpy(Colors, data, sizeof(uint32_t) * DecodedSegmentVertexCount);
+    }
+    else
+    {
+        // Colors only, the normal half is left empty like AVV_FRAME_COLORS_RGB_565 does.
+        for (int v = 0; v < DecodedSegmentVertexCount; ++v)
+        {
+            Colors[(v * 4) + 0] = data[v * 2] & 0xFF;
+            Colors[(v * 4) + 1] = (data[v * 2] >> 8) & 0xFF;
+            Colors[(v * 4) + 2] = 0;
+            Colors[(v * 4) + 3] = 0;
+        }
+    }
 
     double decodeColorsNormalsTime = FPlatformTime::Seconds() - decodeFrameColorsNormalsStart;
     //UE_LOG(LogHoloSuitePlayer, Warning, TEXT("Decode Colors & Normals Time: %f"), decodeColorsNormalsTime);
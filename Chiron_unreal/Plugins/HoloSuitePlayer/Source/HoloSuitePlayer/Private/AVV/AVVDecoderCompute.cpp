@@ -102,21 +102,49 @@ void UAVVDecoderCompute::Update(float DeltaTime)
         int holoMeshIndex = 0;
 
         int pendingSegment = avvReader.GetSegmentIndex(PendingState.FrameNumber);
-        bool updatedSegment = pendingSegment != DecodedSegmentIndex;
+        bool updatedSegment = pendingSegment != DecodedSegmentIndex 
+            || (IsSegmentLODStale(pendingSegment) && DataCache.HasSegment(pendingSegment));
 
+        // The draw is static, the counts it's built with are set before the render state is
+        // recreated with DirtyHoloMesh below.
+        if (updatedSegment)
+        {
+            AVVEncodedSegment* segment = DataCache.GetSegment(pendingSegment);
+            SegmentLOD = segment->GetGeometryLOD(GetGeometryLOD());
+            SegmentLODCount = (int)segment->geometryLODs.size() + 1;
+
+            FHoloMesh* mesh = GetHoloMesh(holoMeshIndex);
+            mesh->IndexBuffer->SetUsedIndices(segment->GetIndexCount(SegmentLOD));
+            mesh->VertexBuffers->SetNumVertices(segment->GetVertexCount(SegmentLOD));
+        }
+
+        PrepareFrameCapture(PendingState.FrameNumber);
         GHoloMeshManager.AddUpdateRequest(RegisteredGUID, holoMeshIndex, pendingSegment, PendingState.FrameNumber);
+        UpdateInstances(PendingState.FrameNumber, FrameCount);
+
+        // Interpolation never crosses segments.
+        AVVEncodedFrame* previousFrame = updatedSegment ? nullptr : DataCache.GetFrame(CurrentState.FrameNumber);
 
         CurrentState = PendingState;
         PendingState.Reset();
 
         // Update bounding box.
+        FHoloMesh* mesh = GetHoloMesh(holoMeshIndex);
+        bool frameBounds = UpdateFrameBoundingBox(DataCache.GetFrame(CurrentState.FrameNumber), mesh, previousFrame);
         if (updatedSegment)
         {
             AVVEncodedSegment* segment = DataCache.GetSegment(pendingSegment);
-            FHoloMesh* mesh = GetHoloMesh(holoMeshIndex);
-            UpdateBoundingBox(segment, mesh);
+            if (!frameBounds)
+            {
+                UpdateBoundingBox(segment, mesh);
+            }
+            UpdateCollisionProxy(pendingSegment, segment);
             DirtyHoloMesh();
         }
+        else if (frameBounds)
+        {
+            UpdateLocalBounds();
+        }
 
         DecoderState = EDecoderState::Idle;
     }
@@ -142,6 +170,12 @@ void UAVVDecoderCompute::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMes
     else 
     {
         frame = DataCache.GetFrame(UpdateRequest.FrameIndex);
+
+        // The segment was read again to decode it at another geometry LOD.
+        if (frame != nullptr && DecodedSegmentLOD != SegmentLOD)
+        {
+            segment = DataCache.GetSegment(UpdateRequest.SegmentIndex);
+        }
     }
 
     if (mesh == nullptr || (segment == nullptr && frame == nullptr))
@@ -151,7 +185,8 @@ void UAVVDecoderCompute::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMes
     }
 
     bool updatedSegment = false;
-    bool useMotionVectors = GetMotionVectorsEnabled() && !bReversedCaching;
+    EAVVDecodeFlags decodeFlags = GetDecodeFlags();
+    bool useMotionVectors = GetMotionVectorsEnabled() && !bReversedCaching && EnumHasAnyFlags(decodeFlags, EAVVDecodeFlags::MotionVectors);
 
     // Decode segment
     if (segment != nullptr)
@@ -163,20 +198,23 @@ void UAVVDecoderCompute::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMes
             HoloMeshUtilities::ConvertToPooledBuffer(GraphBuilder, Buffer, DecodedVertexBuffer);
         }
 
+        int lod = segment->GetGeometryLOD(SegmentLOD);
+
         UpdateTextureBlockMap(GraphBuilder, segment);
-        ComputeDecodeSegmentVertices(GraphBuilder, segment, mesh);
-        ComputeDecodeSegmentUVNormals(GraphBuilder, segment, mesh);
-        ComputeDecodeSegmentTriangles(GraphBuilder, segment, mesh);
+        ComputeDecodeSegmentVertices(GraphBuilder, segment, mesh, lod);
+        ComputeDecodeSegmentUVNormals(GraphBuilder, segment, mesh, lod);
+        ComputeDecodeSegmentTriangles(GraphBuilder, segment, mesh, lod);
         ClearTextures(GraphBuilder, segment, mesh);
 
         if (segment->motionVectors && useMotionVectors)
         {
-            ComputeDecodeSegmentMotionVectors(GraphBuilder, segment, mesh);
+            ComputeDecodeSegmentMotionVectors(GraphBuilder, segment, mesh, lod);
             mesh->UpdateUniforms(GraphBuilder, 1.0f);
         }
 
         DecodedSegmentIndex = UpdateRequest.SegmentIndex;
-        DecodedSegmentVertexCount = segment->vertexCount;
+        DecodedSegmentVertexCount = segment->GetVertexCount(lod);
+        DecodedSegmentLOD = lod;
         DecodedSegmentTextureInfo = segment->texture;
         updatedSegment = true;
 
@@ -194,16 +232,23 @@ void UAVVDecoderCompute::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMes
         }
 
         // Color/Normal Decode
-        ComputeDecodeFrameColorNormals(GraphBuilder, frame, mesh);
+        ComputeDecodeFrameColorNormals(GraphBuilder, frame, mesh, EnumHasAnyFlags(decodeFlags, EAVVDecodeFlags::Normals));
 
-        // Texture Decode
-        if (frame->lumaCount > 0)
+        // Texture Decode, delta frames without changed blocks still advance the luma frame.
+        if ((frame->lumaCount > 0 || frame->deltaBlocks) && EnumHasAnyFlags(decodeFlags, EAVVDecodeFlags::Texture))
         {
             DecodeFrameTexture(GraphBuilder, frame, mesh);
         }
 
         frame->processed = true;
     }
+
+    // Keep a copy around for instances drawing with a frame offset.
+    CaptureInstanceFrame_RenderThread(GraphBuilder, mesh, UpdateRequest.FrameIndex);
+    if (CanCaptureDecodedFrame())
+    {
+        CaptureDecodedFrame_RenderThread(GraphBuilder, mesh, UpdateRequest.FrameIndex);
+    }
 }
 
 void UAVVDecoderCompute::EndFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpdateRequest UpdateRequest)
@@ -221,7 +266,7 @@ void UAVVDecoderCompute::EndFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloM
     mesh->UpdateUniforms(GraphBuilder, 0.0f);
 }
 
-bool UAVVDecoderCompute::ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh)
+bool UAVVDecoderCompute::ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh, int lod)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoderCompute_ComputeDecodeSegmentVertices);
     RDG_GPU_STAT_SCOPE(GraphBuilder, GPU_AVVDecoderCompute_ComputeDecodeSegmentVertices);
@@ -235,13 +280,18 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder,
 
     uint8_t* data = segment->content->Data;
 
+    // Coarser LODs only use a prefix of the vertices, only that much is uploaded and decoded.
+    uint32_t vertexCount = segment->GetVertexCount(lod);
+    uint32_t compactVertexCount = segment->GetCompactVertexCount(lod);
+
     if (segment->posOnlySegment)
     {
-        // Upload Data
+        // Upload Data, 12 bytes per vertex pair.
+        uint32_t vertexDataSize = FMath::Min(segment->vertexDataSize, ((vertexCount / 2) + 1) * 12);
 
-        FRDGBufferRef VertexDataBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), segment->vertexDataSize / 4), TEXT("AVVVertexData"));
+        FRDGBufferRef VertexDataBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), vertexDataSize / 4), TEXT("AVVVertexData"));
         FRDGBufferUAVRef VertexDataBufferUAV = GraphBuilder.CreateUAV(VertexDataBuffer, PF_R32_UINT);
-        UploadData(GraphBuilder, VertexDataBuffer, &data[segment->vertexDataOffset], segment->vertexDataSize, segment);
+        UploadData(GraphBuilder, VertexDataBuffer, &data[segment->vertexDataOffset], vertexDataSize, segment);
 
         FRDGBuffer* VertBuffer = GraphBuilder.RegisterExternalBuffer(DecodedVertexBuffer);
         FRDGBufferUAVRef DecodedVertexBufferUAV = GraphBuilder.CreateUAV(VertBuffer, PF_R32G32B32A32_UINT);
@@ -249,13 +299,13 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder,
         TShaderMapRef<FAVVDecodePos16_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
         FAVVDecodePos16_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVDecodePos16_CS::FParameters>();
 
-        PassParameters->gVertexCount = segment->vertexCount;
+        PassParameters->gVertexCount = vertexCount;
         PassParameters->gAABBMin = segment->GetAABBMin();
         PassParameters->gAABBMax = segment->GetAABBMax();
         PassParameters->VertexDataBuffer = VertexDataBufferUAV;
         PassParameters->DecodedVertexBuffer = DecodedVertexBufferUAV;
 
-        int vertexPairCount = segment->vertexCount / 2;
+        int vertexPairCount = vertexCount / 2;
 
         FComputeShaderUtils::AddPass(
             GraphBuilder,
@@ -268,26 +318,27 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder,
     }
     else 
     {
-        // Upload Data
+        // Upload Data, 16 bytes per compact vertex.
+        uint32_t vertexDataSize = FMath::Min(segment->vertexDataSize, compactVertexCount * 16);
 
-        FRDGBufferRef VertexSkinDataBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t) * 4, segment->vertexDataSize / 16), TEXT("AVVVertexData"));
+        FRDGBufferRef VertexSkinDataBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t) * 4, vertexDataSize / 16), TEXT("AVVVertexData"));
         FRDGBufferUAVRef VertexSkinDataBufferUAV = GraphBuilder.CreateUAV(VertexSkinDataBuffer, PF_R32G32B32A32_UINT);
-        UploadData(GraphBuilder, VertexSkinDataBuffer, &data[segment->vertexDataOffset], segment->vertexDataSize, segment);
+        UploadData(GraphBuilder, VertexSkinDataBuffer, &data[segment->vertexDataOffset], vertexDataSize, segment);
 
         FRDGBufferRef VertexWriteTableBuffer = nullptr;
         FRDGBufferUAVRef VertexWriteTableBufferUAV = nullptr;
         if (segment->vertexWriteTableOffset > 0 && segment->vertexWriteTable.Num() == 0)
         {
             // v2 of this container includes the vertex write data in the file.
-            VertexWriteTableBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), segment->compactVertexCount), TEXT("AVVVertexWriteTable"));
+            VertexWriteTableBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), compactVertexCount), TEXT("AVVVertexWriteTable"));
             VertexWriteTableBufferUAV = GraphBuilder.CreateUAV(VertexWriteTableBuffer, PF_R32_UINT);
-            UploadData(GraphBuilder, VertexWriteTableBuffer, &data[segment->vertexWriteTableOffset], segment->compactVertexCount * 4, segment);
+            UploadData(GraphBuilder, VertexWriteTableBuffer, &data[segment->vertexWriteTableOffset], compactVertexCount * 4, segment);
         }
         else 
         {
-            VertexWriteTableBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), segment->compactVertexCount), TEXT("AVVVertexWriteTable"));
+            VertexWriteTableBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), compactVertexCount), TEXT("AVVVertexWriteTable"));
             VertexWriteTableBufferUAV = GraphBuilder.CreateUAV(VertexWriteTableBuffer, PF_R32_UINT);
-            UploadData(GraphBuilder, VertexWriteTableBuffer, segment->vertexWriteTable.GetData(), segment->compactVertexCount * 4, segment);
+            UploadData(GraphBuilder, VertexWriteTableBuffer, segment->vertexWriteTable.GetData(), compactVertexCount * 4, segment);
         }
         
         FRDGBuffer* VertBuffer = GraphBuilder.RegisterExternalBuffer(DecodedVertexBuffer);
@@ -296,8 +347,8 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder,
         TShaderMapRef<FAVVDecodePosSkinExpand_128_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
         FAVVDecodePosSkinExpand_128_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVDecodePosSkinExpand_128_CS::FParameters>();
 
-        PassParameters->gVertexCount = segment->vertexCount;
-        PassParameters->gCompactVertexCount = segment->compactVertexCount;
+        PassParameters->gVertexCount = vertexCount;
+        PassParameters->gCompactVertexCount = compactVertexCount;
         PassParameters->gAABBMin = segment->GetAABBMin();
         PassParameters->gAABBMax = segment->GetAABBMax();
         PassParameters->VertexSkinDataBuffer = VertexSkinDataBufferUAV;
@@ -310,14 +361,14 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder,
             ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
             ComputeShader,
             PassParameters,
-            FIntVector((segment->compactVertexCount / 64) + 1, 1, 1)
+            FIntVector((compactVertexCount / 64) + 1, 1, 1)
         );
     }
 
     return true;
 }
 
-bool UAVVDecoderCompute::ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh)
+bool UAVVDecoderCompute::ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh, int lod)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoderCompute_ComputeDecodeSegmentUVNormals);
     RDG_GPU_STAT_SCOPE(GraphBuilder, GPU_AVVDecoderCompute_ComputeDecodeSegmentUVNormals);
@@ -335,6 +386,10 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder
     FRDGBufferUAVRef UVDataBufferUAV = GraphBuilder.CreateUAV(UVDataBuffer, PF_R32_UINT);
     UploadData(GraphBuilder, UVDataBuffer, &data[segment->uvDataOffset], segment->uvDataSize, segment);
 
+    // UVs beyond the LOD's vertices are never drawn, pairs keep the count even.
+    uint32_t vertexCount = segment->GetVertexCount(lod);
+    uint32_t uvCount = FMath::Min(segment->uvCount, vertexCount + (vertexCount & 1));
+
     if (segment->uv12normal888)
     {
         TShaderMapRef<FAVVDecodeUVS_12_Normals_888_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
@@ -344,10 +399,10 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder
         PassParameters->VertexTexCoordBuffer = mesh->VertexBuffers->GetTexCoordBufferUAV();
         PassParameters->VertexTangentBuffer  = mesh->VertexBuffers->GetTangentsBufferUAV();
         PassParameters->gTexCoordStride      = mesh->VertexBuffers->GetNumTexCoords();
-        PassParameters->gVertexCount         = segment->vertexCount;
-        PassParameters->gUVCount             = segment->uvCount;
+        PassParameters->gVertexCount         = vertexCount;
+        PassParameters->gUVCount             = uvCount;
 
-        int uvNormDataCount = segment->uvCount / 2;
+        int uvNormDataCount = uvCount / 2;
 
         FComputeShaderUtils::AddPass(
             GraphBuilder,
@@ -366,7 +421,7 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder
         PassParameters->UVDataBuffer         = UVDataBufferUAV;
         PassParameters->VertexTexCoordBuffer = mesh->VertexBuffers->GetTexCoordBufferUAV();
         PassParameters->gTexCoordStride      = mesh->VertexBuffers->GetNumTexCoords();
-        PassParameters->gUVCount             = segment->uvCount;
+        PassParameters->gUVCount             = uvCount;
 
         FComputeShaderUtils::AddPass(
             GraphBuilder,
@@ -374,14 +429,14 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder
             ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
             ComputeShader,
             PassParameters,
-            FIntVector((segment->uvCount / 64) + 1, 1, 1)
+            FIntVector((uvCount / 64) + 1, 1, 1)
         );
     };
 
     return true;
 }
 
-bool UAVVDecoderCompute::ComputeDecodeSegmentTriangles(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh)
+bool UAVVDecoderCompute::ComputeDecodeSegmentTriangles(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh, int lod)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoderCompute_ComputeDecodeSegmentTriangles);
     RDG_GPU_STAT_SCOPE(GraphBuilder, GPU_AVVDecoderCompute_ComputeDecodeSegmentTriangles);
@@ -395,6 +450,38 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentTriangles(FRDGBuilder& GraphBuilder
 
     uint8_t* data = segment->content->Data;
 
+    // Coarser LODs have their own 32 bit triangles.
+    lod = segment->GetGeometryLOD(lod);
+    if (lod > 0 && segment->geometryLODs[lod - 1].indexCount > 0)
+    {
+        const AVVEncodedSegment::GeometryLOD& geometryLOD = segment->geometryLODs[lod - 1];
+
+        FRDGBufferRef IndexDataBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), geometryLOD.indexCount), TEXT("AVVIndexData"));
+        FRDGBufferUAVRef IndexDataBufferUAV = GraphBuilder.CreateUAV(IndexDataBuffer, PF_R32_UINT);
+        UploadData(GraphBuilder, IndexDataBuffer, &data[geometryLOD.indexDataOffset], geometryLOD.indexCount * sizeof(uint32_t), segment);
+
+        HoloMeshUtilities::ClearUAVUInt(GraphBuilder, mesh->IndexBuffer->GetIndexBufferUAV());
+
+        TShaderMapRef<FAVVDecodeSegmentTris_32_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+        FAVVDecodeSegmentTris_32_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVDecodeSegmentTris_32_CS::FParameters>();
+
+        PassParameters->IndexDataBuffer = IndexDataBufferUAV;
+        PassParameters->IndexBuffer     = mesh->IndexBuffer->GetIndexBufferUAV();
+        PassParameters->gMaxIndexCount  = avvReader.Limits.MaxIndexCount;
+        PassParameters->gIndexCount     = geometryLOD.indexCount;
+
+        FComputeShaderUtils::AddPass(
+            GraphBuilder,
+            RDG_EVENT_NAME("AVVDecoder.SegmentTrisLOD"),
+            ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
+            ComputeShader,
+            PassParameters,
+            FIntVector((geometryLOD.indexCount / 64) + 1, 1, 1)
+        );
+
+        return true;
+    }
+
     // Upload Data
     FRDGBufferRef IndexDataBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32_t), segment->indexDataSize / 4), TEXT("AVVIndexData"));
     FRDGBufferUAVRef IndexDataBufferUAV = GraphBuilder.CreateUAV(IndexDataBuffer, PF_R32_UINT);
@@ -471,7 +558,7 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentTriangles(FRDGBuilder& GraphBuilder
     return true;
 }
 
-bool UAVVDecoderCompute::ComputeDecodeSegmentMotionVectors(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* meshOut)
+bool UAVVDecoderCompute::ComputeDecodeSegmentMotionVectors(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* meshOut, int lod)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoderCompute_ComputeDecodeSegmentMotionVectors);
     RDG_GPU_STAT_SCOPE(GraphBuilder, GPU_AVVDecoderCompute_ComputeDecodeSegmentMotionVectors);
@@ -501,14 +588,14 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentMotionVectors(FRDGBuilder& GraphBui
     TShaderMapRef<FAVVDecodeSegmentMotionVectors_CS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
     FAVVDecodeSegmentMotionVectors_CS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAVVDecodeSegmentMotionVectors_CS::FParameters>();
 
-    PassParameters->gVertexCount = segment->vertexCount;
+    PassParameters->gVertexCount = segment->GetVertexCount(lod);
     PassParameters->gMotionVectorsMin = MotionVectorsMin;
     PassParameters->gMotionVectorsMax = MotionVectorsMax;
     PassParameters->MotionVectorsDataBuffer = BufferUAV;
     PassParameters->DecodedVertexBuffer = DecodedVertexBufferUAV;
     PassParameters->VertexPositionBuffer = meshOut->VertexBuffers->GetPositionBufferUAV();
 
-    int motionVectorDataCount = segment->motionVectorsCount;
+    int motionVectorDataCount = FMath::Min(segment->motionVectorsCount, segment->GetVertexCount(lod));
 
     FComputeShaderUtils::AddPass(
         GraphBuilder,
@@ -522,7 +609,7 @@ bool UAVVDecoderCompute::ComputeDecodeSegmentMotionVectors(FRDGBuilder& GraphBui
     return true;
 }
 
-bool UAVVDecoderCompute::ComputeDecodeFrameColorNormals(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* mesh)
+bool UAVVDecoderCompute::ComputeDecodeFrameColorNormals(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* mesh, bool decodeNormals)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVDecoderCompute_ComputeDecodeFrameColorNormals);
     RDG_GPU_STAT_SCOPE(GraphBuilder, GPU_AVVDecoderCompute_ComputeDecodeFrameColorNormals);
@@ -549,9 +636,10 @@ bool UAVVDecoderCompute::ComputeDecodeFrameColorNormals(FRDGBuilder& GraphBuilde
         PassParameters->VertexColorBuffer   = mesh->VertexBuffers->GetColorBufferUAV();
         PassParameters->VertexTangentBuffer = mesh->VertexBuffers->GetTangentsBufferUAV();
         PassParameters->gVertexCount        = DecodedSegmentVertexCount;
-        PassParameters->gColorCount         = frame->colorCount;
+        PassParameters->gColorCount         = FMath::Min<uint32_t>(frame->colorCount, DecodedSegmentVertexCount);
+        PassParameters->gDecodeNormals      = decodeNormals ? 1 : 0;
 
-        int colorNormalDataCount = frame->colorCount;
+        int colorNormalDataCount = PassParameters->gColorCount;
 
         FComputeShaderUtils::AddPass(
             GraphBuilder,
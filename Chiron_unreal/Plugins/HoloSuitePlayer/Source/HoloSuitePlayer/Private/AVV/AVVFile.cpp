@@ -4,10 +4,16 @@
 #include "AVV/AVVFormat.h"
 #include "AVV/AVVDecoder.h"
 
-#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
 
 #define AVV_READ(DST, SRC, POSITION, TYPE, NUM_ELEMENTS) memcpy(&DST, &SRC[POSITION], sizeof(TYPE) * NUM_ELEMENTS); POSITION += sizeof(TYPE) * NUM_ELEMENTS;
 
+static TAutoConsoleVariable<int32> CVarAVVResidentMaxSizeMB(
+    TEXT("r.AVV.Resident.MaxSizeMB"),
+    64,
+    TEXT("Largest AVV file in megabytes that players with resident playback keep in memory, larger files are streamed."),
+    ECVF_Default);
+
 // Unique AVV Object version id
 const FGuid FAVVFileVersion::GUID(0xEF7A3040, 0x4F8208DF, 0xC2053CA9, 0x5BB981D8);
 // Register AVV custom version with Core
@@ -20,7 +26,7 @@ void FAVVStreamableContainer::Serialize(FArchive& Ar, UAVVFile* Owner, int32 Con
     BulkData.Serialize(Ar, Owner, ContainerIndex, false);
 }
 
-bool FAVVStreamableContainer::Read(uint8_t* outputBuffer, size_t outputBufferSize)
+bool FAVVStreamableContainer::Read(uint8_t* outputBuffer, size_t outputBufferSize, IHoloSuiteIOBackend* backend)
 {
     size_t dataSize = BulkData.GetBulkDataSize();
 
@@ -29,38 +35,11 @@ bool FAVVStreamableContainer::Read(uint8_t* outputBuffer, size_t outputBufferSiz
         return false;
     }
 
-    FBulkDataIORequestCallBack AsyncFileCallBack =
-        [this](bool bWasCancelled, IBulkDataIORequest* Req)
-    {
-        // Do nothing the data is in the buffer.
-    };
-
-    // Loaded in Editor.
-    if (BulkData.IsBulkDataLoaded())
-    {
-        uint8* data = (uint8*)BulkData.Lock(LOCK_READ_ONLY);
-        memcpy(outputBuffer, data, dataSize);
-        BulkData.Unlock();
-        return true;
-    }
-    else 
-    {
-        const EAsyncIOPriorityAndFlags AsyncIOPriority = AIOP_High;
-        IBulkDataIORequest* IORequest = BulkData.CreateStreamingRequest(AsyncIOPriority, &AsyncFileCallBack, outputBuffer);
-
-        if (IORequest)
-        {
-            IORequest->WaitCompletion();
-            // Free AsyncHandle Resources.
-            delete IORequest;
-            IORequest = nullptr;
-        }
-    }
-
-    return true;
+    IHoloSuiteIOBackend& ioBackend = backend ? *backend : HoloSuiteIO::GetBulkDataBackend();
+    return ioBackend.Read(BulkData, outputBuffer);
 }
 
-FAVVIORequestRef FAVVStreamableContainer::ReadAsync(uint8_t* outputBuffer, size_t outputBufferSize)
+FAVVIORequestRef FAVVStreamableContainer::ReadAsync(uint8_t* outputBuffer, size_t outputBufferSize, IHoloSuiteIOBackend* backend, FHoloSuiteIOCallback callback)
 {
     FAVVIORequestRef Result = MakeShared<FAVVIORequest, ESPMode::ThreadSafe>();
     size_t dataSize = BulkData.GetBulkDataSize();
@@ -74,35 +53,9 @@ FAVVIORequestRef FAVVStreamableContainer::ReadAsync(uint8_t* outputBuffer, size_
         return Result;
     }
 
-    // Loaded in Editor.
-    if (BulkData.IsBulkDataLoaded())
-    {
-        Result->Status = FAVVIORequest::EStatus::Waiting;
-        Result->Request = nullptr;
-
-        // This function can get called from a worker thread through AVVReader and multiple
-        // locks from off game thread from players using the same file seems unstable.
-        AsyncTask(ENamedThreads::GameThread, [this, Result, outputBuffer, dataSize]
-        {
-            uint8* data = (uint8*)BulkData.LockReadOnly();
-            memcpy(outputBuffer, data, dataSize);
-            BulkData.Unlock();
-
-            Result->EndTime = FPlatformTime::Seconds();
-            Result->Status = FAVVIORequest::EStatus::Completed;
-        });
-    }
-    else
-    {
-        FBulkDataIORequestCallBack AsyncFileCallBack = [Result](bool bWasCancelled, IBulkDataIORequest* Req)
-        {
-            Result->EndTime = FPlatformTime::Seconds();
-        };
-
-        const EAsyncIOPriorityAndFlags AsyncIOPriority = AIOP_High;
-        Result->Status = FAVVIORequest::EStatus::Waiting;
-        Result->Request = BulkData.CreateStreamingRequest(AsyncIOPriority, &AsyncFileCallBack, outputBuffer);
-    }
+    IHoloSuiteIOBackend& ioBackend = backend ? *backend : HoloSuiteIO::GetBulkDataBackend();
+    Result->Status = FAVVIORequest::EStatus::Waiting;
+    Result->Request = ioBackend.ReadAsync(BulkData, outputBuffer, MoveTemp(callback));
 
     return Result;
 }
@@ -360,13 +313,14 @@ void FStreamableAVVData::ImportSegment(uint8_t* Buffer, SIZE_T SizeInBytes)
                 AVV_READ(frameContainerType, Buffer, readPos, uint32_t, 1);
                 AVV_READ(frameContainerSize, Buffer, readPos, uint32_t, 1);
 
-                if (frameContainerType == AVV_FRAME_TEXTURE_LUMA_BC4)
+                if (frameContainerType == AVV_FRAME_TEXTURE_LUMA_BC4 || frameContainerType == AVV_FRAME_TEXTURE_LUMA_BC4_DELTA)
                 {
+                    // Texture containers are read on their own so they keep their type and size header.
                     FrameTextureContainers.AddDefaulted();
                     uint32_t frameTexIdx = FrameTextureContainers.Num() - 1;
-                    CopyIntoContainer(FrameTextureContainers[frameTexIdx], &Buffer[frameContainerStart], frameContainerSize);
+                    CopyIntoContainer(FrameTextureContainers[frameTexIdx], &Buffer[frameContainerStart], frameContainerSize + 8);
 
-                    MaxFrameTextureSizeBytes = FMath::Max(MaxFrameTextureSizeBytes, (SIZE_T)frameContainerSize);
+                    MaxFrameTextureSizeBytes = FMath::Max(MaxFrameTextureSizeBytes, (SIZE_T)frameContainerSize + 8);
                 }
                 else
                 {
@@ -391,39 +345,13 @@ void FStreamableAVVData::ImportSegment(uint8_t* Buffer, SIZE_T SizeInBytes)
     }
 }
 
-uint8_t* FStreamableAVVData::ReadMetaData()
+uint8_t* FStreamableAVVData::ReadMetaData(IHoloSuiteIOBackend* backend)
 {
     size_t dataSize = MetaData.GetBulkDataSize();
-    
-    FBulkDataIORequestCallBack AsyncFileCallBack =
-        [this](bool bWasCancelled, IBulkDataIORequest* Req)
-    {
-        // Do nothing the data is in the buffer.
-    };
-
     uint8_t* outputBuffer = new uint8_t[dataSize];
-    
-    // Loaded in Editor.
-    if (MetaData.IsBulkDataLoaded())
-    {
-        uint8* data = (uint8*)MetaData.Lock(LOCK_READ_ONLY);
-        memcpy(outputBuffer, data, dataSize);
-        MetaData.Unlock();
-    }
-    // Load on-demand in Runtime.
-    else
-    {
-        const EAsyncIOPriorityAndFlags AsyncIOPriority = AIOP_CriticalPath;
-        IBulkDataIORequest* IORequest = MetaData.CreateStreamingRequest(AsyncIOPriority, &AsyncFileCallBack, outputBuffer);
 
-        if (IORequest)
-        {
-            IORequest->WaitCompletion();
-            // Free AsyncHandle Resources.
-            delete IORequest;
-            IORequest = nullptr;
-        }
-    }
+    IHoloSuiteIOBackend& ioBackend = backend ? *backend : HoloSuiteIO::GetBulkDataBackend();
+    ioBackend.Read(MetaData, outputBuffer);
 
     return outputBuffer;
 }
@@ -456,6 +384,9 @@ bool UAVVFile::ImportFile(const FString& TheFileName)
 
 void UAVVFile::ImportFile(FArchive& Reader)
 {
+    // Readers that are already open keep their copy of the previous data.
+    ResidentIOBackend.Reset();
+
     char headerTag[4];
     uint32_t metaContainerCount;
     uint32_t segmentContainerCount;
@@ -580,4 +511,41 @@ FString UAVVFile::GetPath()
         }
     }
     return SourcePath;
-}
\ No newline at end of file
+}
+
+FHoloSuiteIOBackendRef UAVVFile::GetResidentIOBackend()
+{
+    check(IsInGameThread());
+
+    FHoloSuiteIOBackendRef backend = ResidentIOBackend.Pin();
+    if (backend.IsValid())
+    {
+        return backend;
+    }
+
+    TArray<const FByteBulkData*> payloads;
+    payloads.Add(&StreamableAVVData.MetaData);
+    for (const FAVVStreamableContainer& container : StreamableAVVData.SegmentContainers)
+    {
+        payloads.Add(&container.BulkData);
+    }
+    for (const FAVVStreamableContainer& container : StreamableAVVData.FrameContainers)
+    {
+        payloads.Add(&container.BulkData);
+    }
+    for (const FAVVStreamableContainer& container : StreamableAVVData.FrameTextureContainers)
+    {
+        payloads.Add(&container.BulkData);
+    }
+
+    int64 maxSizeBytes = (int64)FMath::Max(CVarAVVResidentMaxSizeMB.GetValueOnGameThread(), 0) * 1024 * 1024;
+    backend = HoloSuiteIO::CreateResidentBackend(payloads, maxSizeBytes);
+    if (!backend.IsValid())
+    {
+        UE_LOG(LogHoloSuitePlayer, Display, TEXT("AVV file %s is larger than r.AVV.Resident.MaxSizeMB, streaming it instead."), *GetName());
+        return nullptr;
+    }
+
+    ResidentIOBackend = backend;
+    return backend;
+}
@@ -27,15 +27,20 @@ UAVVPlayerComponent::UAVVPlayerComponent(const FObjectInitializer& ObjectInitial
     Reverse                 = false;
     FrameRate               = 30.0f;
     CurrentFrame            = 0;
+    FrameInterpolation      = false;
 
     LOD0ScreenSize          = 1.0f;
     LOD1ScreenSize          = 0.5f;
     LOD2ScreenSize          = 0.25f;
     MinimumLOD              = 0;
     ForceLOD                = -1;
+    LOD0UpdateDivisor       = 1;
+    LOD1UpdateDivisor       = 1;
+    LOD2UpdateDivisor       = 2;
 
     PlaybackDelay           = 0;
     UseCPUDecoder           = false;
+    ResidentPlayback        = false;
     LoadInEditor            = true;
 
     MotionVectors           = true;
@@ -109,15 +114,26 @@ void UAVVPlayerComponent::PostEditChangeProperty(FPropertyChangedEvent& Property
         SetPlaybackParameters(ExternalTiming, PlayOnOpen, Loop, PingPong, Reverse, FrameRate, CurrentFrame);
     }
 
+    if (propertyName == "FrameInterpolation")
+    {
+        SetFrameInterpolation(FrameInterpolation);
+    }
+
     if (propertyName == "LOD0ScreenSize" || propertyName == "LOD1ScreenSize" || propertyName == "LOD2ScreenSize"
         || propertyName == "MinimumLOD" || propertyName == "ForceLOD")
     {
         SetLODParameters(LOD0ScreenSize, LOD1ScreenSize, LOD2ScreenSize, MinimumLOD, ForceLOD);
     }
 
-    if (propertyName == "NumBufferedSequences" || propertyName == "LoadInEditor" || propertyName == "PlaybackDelay" || propertyName == "UseCPUDecoder")
+    if (propertyName == "LOD0UpdateDivisor" || propertyName == "LOD1UpdateDivisor" || propertyName == "LOD2UpdateDivisor")
+    {
+        SetLODUpdateDivisors(LOD0UpdateDivisor, LOD1UpdateDivisor, LOD2UpdateDivisor);
+    }
+
+    if (propertyName == "NumBufferedSequences" || propertyName == "LoadInEditor" || propertyName == "PlaybackDelay" || propertyName == "UseCPUDecoder"
+        || propertyName == "ResidentPlayback")
     {
-        SetDecoderParameters(LoadInEditor, PlaybackDelay, UseCPUDecoder);
+        SetDecoderParameters(LoadInEditor, PlaybackDelay, UseCPUDecoder, ResidentPlayback);
     }
 
     if (propertyName == "MotionVectors" || propertyName == "ResponsiveAA" || propertyName == "ReceiveDecals")
@@ -161,6 +177,10 @@ void UAVVPlayerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
                 UpdateFrame(DeltaTime);
             }
         }
+        else if (FrameInterpolation)
+        {
+            avvDecoder->SetSubFrame(FMath::Clamp(CurrentFrame, 0.0f, (float)(avvDecoder->FrameCount - 1)));
+        }
         else
         {
             int frame = FMath::Clamp((int)CurrentFrame, 0, avvDecoder->FrameCount - 1);
@@ -206,14 +226,19 @@ void UAVVPlayerComponent::SyncWithHoloSuitePlayer(AHoloSuitePlayer* HoloSuitePla
     Reverse             = HoloSuitePlayer->Reverse;
     FrameRate           = HoloSuitePlayer->FrameRate;
     CurrentFrame        = HoloSuitePlayer->CurrentFrame;
+    FrameInterpolation  = HoloSuitePlayer->FrameInterpolation;
     LOD0ScreenSize      = HoloSuitePlayer->LOD0ScreenSize;
     LOD1ScreenSize      = HoloSuitePlayer->LOD1ScreenSize;
     LOD2ScreenSize      = HoloSuitePlayer->LOD2ScreenSize;
     MinimumLOD          = HoloSuitePlayer->MinimumLOD;
     ForceLOD            = HoloSuitePlayer->ForceLOD;
+    LOD0UpdateDivisor   = HoloSuitePlayer->LOD0UpdateDivisor;
+    LOD1UpdateDivisor   = HoloSuitePlayer->LOD1UpdateDivisor;
+    LOD2UpdateDivisor   = HoloSuitePlayer->LOD2UpdateDivisor;
     LoadInEditor        = HoloSuitePlayer->LoadInEditor;
     PlaybackDelay       = HoloSuitePlayer->PlaybackDelay;
     UseCPUDecoder       = HoloSuitePlayer->UseCPUDecoder;
+    ResidentPlayback    = HoloSuitePlayer->ResidentPlayback;
     MotionVectors       = HoloSuitePlayer->MotionVectors;
     ResponsiveAA        = HoloSuitePlayer->ResponsiveAA;
     ReceiveDecals       = HoloSuitePlayer->ReceiveDecals;
@@ -282,7 +307,12 @@ bool UAVVPlayerComponent::LoadAVV()
     avvDecoder->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
 
     avvDecoder->SetRenderingOptions(MotionVectors, ResponsiveAA, ReceiveDecals);
+    avvDecoder->SetSubFramePresentation(FrameInterpolation);
     avvDecoder->SetLODOptions({ LOD0ScreenSize, LOD1ScreenSize, LOD2ScreenSize }, MinimumLOD, ForceLOD);
+    avvDecoder->SetLODUpdateDivisor(0, LOD0UpdateDivisor);
+    avvDecoder->SetLODUpdateDivisor(1, LOD1UpdateDivisor);
+    avvDecoder->SetLODUpdateDivisor(2, LOD2UpdateDivisor);
+    avvDecoder->SetResidentPlayback(ResidentPlayback);
 
     // Set Mesh Material
     if (!MeshMaterial)
@@ -321,6 +351,15 @@ bool UAVVPlayerComponent::LoadAVV()
             avvDecoder->SetHoloMeshSkeleton(nullptr);
         }
 
+        // Rebind instances created against a previous decoder.
+        for (auto& instance : MeshInstances)
+        {
+            if (instance.IsValid())
+            {
+                instance->SetInstanceSource(avvDecoder, instance->GetInstanceFrameOffset());
+            }
+        }
+
         // Load first frame so we display something.
         avvDecoder->SetFrame(0, true);
         OnAVVOpened.Broadcast();
@@ -388,6 +427,16 @@ void UAVVPlayerComponent::SetPlaybackParameters(bool NewExternalTiming, bool New
     bShouldPlay = false;
 }
 
+void UAVVPlayerComponent::SetFrameInterpolation(bool NewFrameInterpolation)
+{
+    FrameInterpolation = NewFrameInterpolation;
+
+    if (avvDecoder)
+    {
+        avvDecoder->SetSubFramePresentation(FrameInterpolation);
+    }
+}
+
 void UAVVPlayerComponent::SetLODParameters(float NewLOD0ScreenSize, float NewLOD1ScreenSize, float NewLOD2ScreenSize, int NewMinimumLOD, int NewForceLOD)
 {
     LOD0ScreenSize = NewLOD0ScreenSize;
@@ -402,11 +451,26 @@ void UAVVPlayerComponent::SetLODParameters(float NewLOD0ScreenSize, float NewLOD
     }
 }
 
-void UAVVPlayerComponent::SetDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder)
+void UAVVPlayerComponent::SetLODUpdateDivisors(int NewLOD0UpdateDivisor, int NewLOD1UpdateDivisor, int NewLOD2UpdateDivisor)
+{
+    LOD0UpdateDivisor = FMath::Max(NewLOD0UpdateDivisor, 1);
+    LOD1UpdateDivisor = FMath::Max(NewLOD1UpdateDivisor, 1);
+    LOD2UpdateDivisor = FMath::Max(NewLOD2UpdateDivisor, 1);
+
+    if (avvDecoder != nullptr)
+    {
+        avvDecoder->SetLODUpdateDivisor(0, LOD0UpdateDivisor);
+        avvDecoder->SetLODUpdateDivisor(1, LOD1UpdateDivisor);
+        avvDecoder->SetLODUpdateDivisor(2, LOD2UpdateDivisor);
+    }
+}
+
+void UAVVPlayerComponent::SetDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder, bool NewResidentPlayback)
 {
     LoadInEditor = NewLoadInEditor;
     PlaybackDelay = NewPlaybackDelay;
     UseCPUDecoder = NewUseCPUDecoder;
+    ResidentPlayback = NewResidentPlayback;
 
     UWorld* world = GetWorld();
     if (!GIsEditor || (world != nullptr && world->IsPlayInEditor()) || LoadInEditor)
@@ -510,6 +574,9 @@ void UAVVPlayerComponent::UpdateFrame(float DeltaTime)
         }
     }
 
+    // Engine frames in between capture frames blend towards the next one by how far the timer is into it.
+    bool subFrame = FrameInterpolation && !Reverse;
+
     if (CurrentFrame != computedFrame)
     {
         CurrentFrame = FMath::Clamp(computedFrame, 0, avvDecoder->FrameCount - 1);
@@ -521,7 +588,15 @@ void UAVVPlayerComponent::UpdateFrame(float DeltaTime)
             bFirstRun = false;
         }
 
-        avvDecoder->SetFrame(CurrentFrame);
+        if (!subFrame)
+        {
+            avvDecoder->SetFrame(CurrentFrame);
+        }
+    }
+
+    if (subFrame)
+    {
+        avvDecoder->SetSubFrame(CurrentFrame + FMath::Frac(FrameTimer * FrameRate));
     }
 }
 
@@ -568,6 +643,31 @@ void UAVVPlayerComponent::AttachActorToSkeleton(AActor* Actor, FName SocketName)
     ActorsToBeAttached.Emplace(Actor, SocketName);
 }
 
+UHoloMeshComponent* UAVVPlayerComponent::CreateMeshInstance(USceneComponent* AttachParent, int FrameOffset)
+{
+    if (avvDecoder == nullptr || AttachParent == nullptr)
+    {
+        return nullptr;
+    }
+
+    UObject* outer = AttachParent->GetOwner() ? (UObject*)AttachParent->GetOwner() : (UObject*)AttachParent;
+    UHoloMeshComponent* instance = NewObject<UHoloMeshComponent>(outer);
+
+    if (AttachParent->GetWorld())
+    {
+        instance->RegisterComponent();
+    }
+    instance->AttachToComponent(AttachParent, FAttachmentTransformRules::KeepRelativeTransform);
+
+    instance->SetRenderingOptions(MotionVectors, ResponsiveAA, ReceiveDecals);
+    instance->SetLODOptions({ LOD0ScreenSize, LOD1ScreenSize, LOD2ScreenSize }, MinimumLOD, ForceLOD);
+    instance->SetInstanceSource(avvDecoder, FrameOffset);
+
+    MeshInstances.RemoveAll([](const TWeakObjectPtr<UHoloMeshComponent>& item) { return !item.IsValid(); });
+    MeshInstances.Add(instance);
+    return instance;
+}
+
 void UAVVPlayerComponent::CreateSkeletalMeshComponent(bool shouldDeleteFirst)
 {
     if (PlayerSkeletalMesh)
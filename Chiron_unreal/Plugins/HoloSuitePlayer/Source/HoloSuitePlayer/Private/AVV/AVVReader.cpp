@@ -8,6 +8,7 @@ DECLARE_CYCLE_STAT(TEXT("AVVReader.Destructor"),                    STAT_AVVRead
 DECLARE_CYCLE_STAT(TEXT("AVVReader.Open"),                          STAT_AVVReader_Open,                        STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.Close"),                         STAT_AVVReader_Close,                       STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.Update"),                        STAT_AVVReader_Update,                      STATGROUP_HoloSuitePlayer);
+DECLARE_CYCLE_STAT(TEXT("AVVReader.Prepare"),                       STAT_AVVReader_Prepare,                     STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.DecodeMetaSkeleton"),            STAT_AVVReader_DecodeMetaSkeleton,          STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.AllocateSegment"),               STAT_AVVReader_AllocateSegment,             STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.PreAllocateSegments"),           STAT_AVVReader_PreAllocateSegments,         STATGROUP_HoloSuitePlayer);
@@ -16,6 +17,7 @@ DECLARE_CYCLE_STAT(TEXT("AVVReader.RequestSegment"),                STAT_AVVRead
 DECLARE_CYCLE_STAT(TEXT("AVVReader.PrepareSegment"),                STAT_AVVReader_PrepareSegment,              STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.PrepareFrame"),                  STAT_AVVReader_PrepareFrame,                STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.PrepareFrameTexture"),           STAT_AVVReader_PrepareFrameTexture,         STATGROUP_HoloSuitePlayer);
+DECLARE_CYCLE_STAT(TEXT("AVVReader.DecodeFrameLuma"),               STAT_AVVReader_DecodeFrameLuma,             STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.GetSegmentAndFrame"),            STAT_AVVReader_GetSegmentAndFrame,          STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("AVVReader.DecodeSkeletonPosRotations"),    STAT_AVVReader_DecodeSkeletonPosRotations,  STATGROUP_HoloSuitePlayer);
 
@@ -28,6 +30,8 @@ DECLARE_CYCLE_STAT(TEXT("AVVReader.DecodeSkeletonPosRotations"),    STAT_AVVRead
 void DecodeSkeletonPosRotations(uint8_t* dataPtr, uint32_t boneCount, AVVSkeleton& skeletonOut);
 
 FAVVReader::FAVVReader()
+    : updateSignal(MakeShared<FAVVReaderSignal, ESPMode::ThreadSafe>())
+    , prepareSignal(MakeShared<FAVVReaderSignal, ESPMode::ThreadSafe>())
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVReader_Constructor);
 
@@ -43,7 +47,7 @@ FAVVReader::~FAVVReader()
     openFile = nullptr;
 }
 
-bool FAVVReader::Open(UAVVFile* avvFile)
+bool FAVVReader::Open(UAVVFile* avvFile, bool resident)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVReader_Open);
 
@@ -66,7 +70,29 @@ bool FAVVReader::Open(UAVVFile* avvFile)
     uint32_t MinorVersion = (streamableData.Version & 0x0000FFFF);
     VersionString = FString::Printf(TEXT("%d.%d"), MajorVersion, MinorVersion);
 
-    uint8_t* data = streamableData.ReadMetaData();
+    IOBackend = resident ? avvFile->GetResidentIOBackend() : nullptr;
+    if (!IOBackend.IsValid())
+    {
+        IOBackend = HoloSuiteIO::CreateDefaultBackend();
+    }
+    if (IOBackend->GetType() == EHoloSuiteIOBackend::Memory)
+    {
+        IOBackend->Preload(streamableData.MetaData);
+        for (const FAVVStreamableContainer& container : streamableData.SegmentContainers)
+        {
+            IOBackend->Preload(container.BulkData);
+        }
+        for (const FAVVStreamableContainer& container : streamableData.FrameContainers)
+        {
+            IOBackend->Preload(container.BulkData);
+        }
+        for (const FAVVStreamableContainer& container : streamableData.FrameTextureContainers)
+        {
+            IOBackend->Preload(container.BulkData);
+        }
+    }
+
+    uint8_t* data = streamableData.ReadMetaData(IOBackend.Get());
     size_t readPos = 0;
 
     uint32_t containerType;
@@ -165,21 +191,105 @@ bool FAVVReader::Open(UAVVFile* avvFile)
 void FAVVReader::Close()
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVReader_Close);
+
+    SetUpdateCallback(nullptr);
+    SetPrepareCallback(nullptr);
+
+    FScopeLock Lock(&CriticalSection);
+    IOBackend.Reset();
 }
 
 void FAVVReader::Update()
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVReader_Update);
 
-    if (!CriticalSection.TryLock())
+    // If we can't lock this then an update is already in progress. It checks for notifications
+    // that arrived in the meantime after unlocking, so there's no value in us waiting for it.
+    while (CriticalSection.TryLock())
     {
-        // If we can't lock this then an update is already in progress and there would
-        // be no value is us waiting for it to finish.
-        return;
+        updateSignal->bPending = false;
+
+        while (ProcessRequests())
+        {
+        }
+
+        CriticalSection.Unlock();
+
+        if (!updateSignal->bPending)
+        {
+            break;
+        }
+    }
+}
+
+void FAVVReader::SetUpdateCallback(TFunction<void()> callback)
+{
+    FScopeLock Lock(&updateSignal->CriticalSection);
+    updateSignal->Callback = MoveTemp(callback);
+
+    // Work that arrived while there was no callback would otherwise wait for the next notification.
+    if (updateSignal->Callback && updateSignal->bPending)
+    {
+        updateSignal->Callback();
+    }
+}
+
+void FAVVReader::Prepare()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AVVReader_Prepare);
+
+    // Same as Update(), a single thread prepares at a time which keeps finished requests in order.
+    while (PrepareCriticalSection.TryLock())
+    {
+        prepareSignal->bPending = false;
+
+        FAVVReaderRequestRef request;
+        while (readRequests.Dequeue(request))
+        {
+            PrepareRequest(request.Get());
+            finishedRequests.Enqueue(request);
+        }
+
+        PrepareCriticalSection.Unlock();
+
+        if (!prepareSignal->bPending)
+        {
+            break;
+        }
     }
+}
+
+void FAVVReader::SetPrepareCallback(TFunction<void()> callback)
+{
+    FScopeLock Lock(&prepareSignal->CriticalSection);
+    prepareSignal->Callback = MoveTemp(callback);
 
-    FScopeLockHold LockHold(&CriticalSection);
+    if (prepareSignal->Callback && prepareSignal->bPending)
+    {
+        prepareSignal->Callback();
+    }
+}
 
+void FAVVReader::PrepareRequest(FAVVReaderRequest* request)
+{
+    if (request->segment != nullptr)
+    {
+        PrepareSegment(request->segment);
+    }
+
+    if (request->frame != nullptr)
+    {
+        PrepareFrame(request->frame);
+
+        if (request->requestedTexture)
+        {
+            PrepareFrameTexture(request->frame);
+        }
+    }
+}
+
+bool FAVVReader::ProcessRequests()
+{
     if (readerState == EAVVReaderState::WaitingIO)
     {
         FAVVReaderRequestRef request;
@@ -197,19 +307,6 @@ void FAVVReader::Update()
                     double ioRequestTime = ioRequest->EndTime - ioRequest->StartTime;
                     GHoloMeshManager.AddIOResult(ioRequest->SizeInBytes, ioRequestTime * 1000.0f);
 
-                    if (ioRequest->Type == FAVVIORequest::EType::Segment)
-                    {
-                        PrepareSegment(request->segment);
-                    }
-                    if (ioRequest->Type == FAVVIORequest::EType::Frame)
-                    {
-                        PrepareFrame(request->frame);
-                    }
-                    if (ioRequest->Type == FAVVIORequest::EType::Texture)
-                    {
-                        PrepareFrameTexture(request->frame);
-                    }
-
                     if (ioRequest->Request != nullptr)
                     {
                         // There are seemingly unstable costs to deleting the finished IORequest,
@@ -233,12 +330,14 @@ void FAVVReader::Update()
                 foundError |= (ioRequest->Status == FAVVIORequest::EStatus::Error);
             }
 
-            // Check if this reader request is completed.
+            // Once every read of this request is in it's handed over to Prepare(), parsing
+            // it here would hold up the reads of the requests behind it.
             if (processedRequests == request->pendingIORequestCount.load())
             {
-                this->finishedRequests.Enqueue(request);
+                this->readRequests.Enqueue(request);
                 this->waitingRequests.Pop();
                 request = nullptr;
+                prepareSignal->Notify();
             }
 
             if (foundError)
@@ -250,10 +349,13 @@ void FAVVReader::Update()
             }
         }
 
-        if (waitingRequests.IsEmpty())
-        { 
-            readerState = EAVVReaderState::Ready;
+        if (!waitingRequests.IsEmpty())
+        {
+            // Reads that are still pending notify updateSignal when they can make progress.
+            return false;
         }
+
+        readerState = EAVVReaderState::Ready;
     }
 
     if (readerState == EAVVReaderState::Ready)
@@ -261,13 +363,18 @@ void FAVVReader::Update()
         FAVVReaderRequestRef request = nullptr;
         if (!pendingRequests.Peek(request))
         {
-            return;
+            return false;
         }
         if (!request.IsValid())
         {
-            return;
+            return false;
         }
 
+        FHoloSuiteIOCallback onIOProgress = [signal = updateSignal]
+        {
+            signal->Notify();
+        };
+
         FStreamableAVVData& streamableData = (FStreamableAVVData&)openFile->GetStreamableData();
 
         request->pendingIORequestCount = 0;
@@ -285,7 +392,7 @@ void FAVVReader::Update()
             if (segmentIdx >= streamableData.SegmentContainers.Num())
             {
                 UE_LOG(LogHoloSuitePlayer, Error, TEXT("Sequence out of bounds: %d"), segmentIdx);
-                return;
+                return false;
             }
 
             FAVVStreamableContainer& container = streamableData.SegmentContainers[segmentIdx];
@@ -294,7 +401,7 @@ void FAVVReader::Update()
             request->segment->Create(streamableData.MaxSegmentSizeBytes);
             request->segment->segmentIndex = segmentIdx;
 
-            FAVVIORequestRef segmentIORequest = container.ReadAsync(request->segment->content->Data, streamableData.MaxSegmentSizeBytes);
+            FAVVIORequestRef segmentIORequest = container.ReadAsync(request->segment->content->Data, streamableData.MaxSegmentSizeBytes, IOBackend.Get(), onIOProgress);
             segmentIORequest->Type = FAVVIORequest::EType::Segment;
             request->IORequests.Add(segmentIORequest);
         }
@@ -307,7 +414,7 @@ void FAVVReader::Update()
             if (request->frameNumber >= streamableData.FrameContainers.Num())
             {
                 UE_LOG(LogHoloSuitePlayer, Error, TEXT("Frame out of bounds: %d"), frameIdx);
-                return;
+                return false;
             }
 
             FAVVStreamableContainer& frameContainer = streamableData.FrameContainers[frameIdx];
@@ -318,7 +425,7 @@ void FAVVReader::Update()
             request->frame->Create(streamableData.MaxFrameSizeBytes, textureSize);
             request->frame->frameIndex = frameIdx;
 
-            FAVVIORequestRef frameIORequest = frameContainer.ReadAsync(request->frame->content->Data, streamableData.MaxFrameSizeBytes);
+            FAVVIORequestRef frameIORequest = frameContainer.ReadAsync(request->frame->content->Data, streamableData.MaxFrameSizeBytes, IOBackend.Get(), onIOProgress);
             frameIORequest->Type = FAVVIORequest::EType::Frame;
             request->IORequests.Add(frameIORequest);
 
@@ -328,11 +435,11 @@ void FAVVReader::Update()
                 if (request->frameNumber >= streamableData.FrameTextureContainers.Num())
                 {
                     UE_LOG(LogHoloSuitePlayer, Error, TEXT("Frame texture out of bounds: %d"), frameIdx);
-                    return;
+                    return false;
                 }
 
                 FAVVStreamableContainer& frameTextureContainer = streamableData.FrameTextureContainers[frameIdx];
-                FAVVIORequestRef textureIORequest = frameTextureContainer.ReadAsync(request->frame->textureContent->Data, streamableData.MaxFrameTextureSizeBytes);
+                FAVVIORequestRef textureIORequest = frameTextureContainer.ReadAsync(request->frame->textureContent->Data, streamableData.MaxFrameTextureSizeBytes, IOBackend.Get(), onIOProgress);
                 textureIORequest->Type = FAVVIORequest::EType::Texture;
                 request->IORequests.Add(textureIORequest);
             }
@@ -343,8 +450,13 @@ void FAVVReader::Update()
             this->waitingRequests.Enqueue(request);
             this->pendingRequests.Pop();
             readerState = EAVVReaderState::WaitingIO;
+
+            // Polled straight away to issue the reads and pick up any that finished already.
+            return true;
         }
     }
+
+    return false;
 }
 
 FAVVReaderRequestRef FAVVReader::GetFinishedRequest()
@@ -361,14 +473,14 @@ FAVVReaderRequestRef FAVVReader::GetFinishedRequest()
     return nullptr;
 }
 
-bool FAVVReader::AddRequest(int requestSegmentIndex, int requestFrameNumber, bool requestTexture, bool blockingRequest)
+bool FAVVReader::AddRequest(int requestSegmentIndex, int requestFrameNumber, EAVVDecodeFlags decodeFlags, bool blockingRequest)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVReader_RequestSegment);
 
     FAVVReaderRequestRef request = MakeShareable(new FAVVReaderRequest());
     request->segmentIndex = requestSegmentIndex;
     request->frameNumber = requestFrameNumber;
-    request->requestedTexture = requestTexture;
+    request->requestedTexture = EnumHasAnyFlags(decodeFlags, EAVVDecodeFlags::Texture);
 
     if (request->segmentIndex > -1 && request->segmentIndex >= SegmentCount)
     {
@@ -389,6 +501,7 @@ bool FAVVReader::AddRequest(int requestSegmentIndex, int requestFrameNumber, boo
     {
         pendingRequests.Enqueue(request);
         activeFrameNumbers.Add(request->frameNumber);
+        updateSignal->Notify();
 
         return true;
     }
@@ -412,7 +525,7 @@ bool FAVVReader::AddRequest(int requestSegmentIndex, int requestFrameNumber, boo
             request->segment = new AVVEncodedSegment();
             request->segment->Create(streamableData.MaxSegmentSizeBytes);
             request->segment->segmentIndex = segmentIdx;
-            container.Read(request->segment->content->Data, streamableData.MaxSegmentSizeBytes);
+            container.Read(request->segment->content->Data, streamableData.MaxSegmentSizeBytes, IOBackend.Get());
 
             PrepareSegment(request->segment);
         }
@@ -435,7 +548,7 @@ bool FAVVReader::AddRequest(int requestSegmentIndex, int requestFrameNumber, boo
             request->frame = new AVVEncodedFrame();
             request->frame->Create(streamableData.MaxFrameSizeBytes, textureSize);
             request->frame->frameIndex = frameIdx;
-            frameContainer.Read(request->frame->content->Data, streamableData.MaxFrameSizeBytes);
+            frameContainer.Read(request->frame->content->Data, streamableData.MaxFrameSizeBytes, IOBackend.Get());
             PrepareFrame(request->frame);
 
             if (request->requestedTexture)
@@ -447,7 +560,7 @@ bool FAVVReader::AddRequest(int requestSegmentIndex, int requestFrameNumber, boo
                 }
 
                 FAVVStreamableContainer& frameTextureContainer = streamableData.FrameTextureContainers[frameIdx];
-                frameTextureContainer.Read(request->frame->textureContent->Data, streamableData.MaxFrameTextureSizeBytes);
+                frameTextureContainer.Read(request->frame->textureContent->Data, streamableData.MaxFrameTextureSizeBytes, IOBackend.Get());
                 PrepareFrameTexture(request->frame);
             }
         }
@@ -559,6 +672,30 @@ void FAVVReader::PrepareSegment(AVVEncodedSegment* segment)
             segment->indexDataSize = containerSize - seqPos;
         }
 
+        if (containerType == AVV_SEGMENT_TRIS_LODS_32)
+        {
+            segment->geometryLODs.clear();
+
+            uint32_t lodCount;
+            AVV_READ(lodCount, seqData, seqPos, uint32_t, 1);
+            for (uint32_t l = 0; l < lodCount && (seqPos + 12) <= containerSize; ++l)
+            {
+                AVVEncodedSegment::GeometryLOD lod;
+                AVV_READ(lod.vertexCount, seqData, seqPos, uint32_t, 1);
+                AVV_READ(lod.compactVertexCount, seqData, seqPos, uint32_t, 1);
+                AVV_READ(lod.indexCount, seqData, seqPos, uint32_t, 1);
+                lod.indexDataOffset = readPos + seqPos;
+
+                // A truncated LOD and any after it are dropped, coarser LODs then fall back to the last complete one.
+                if (((uint64_t)lod.indexCount * sizeof(uint32_t)) > (containerSize - seqPos))
+                {
+                    break;
+                }
+                seqPos += lod.indexCount * sizeof(uint32_t);
+                segment->geometryLODs.push_back(lod);
+            }
+        }
+
         if (containerType == AVV_SEGMENT_UVS_16)
         {
             AVV_READ(segment->uvCount, seqData, seqPos, uint32_t, 1);
@@ -613,6 +750,7 @@ void FAVVReader::PrepareSegment(AVVEncodedSegment* segment)
             segment->texture.multiRes = true;
         }
 
+        // Only the header is parsed, the decoder skips the data itself at LODs without motion vectors.
         if (containerType == AVV_SEGMENT_MOTION_VECTORS)
         {
             AVV_READ(segment->motionVectorsMin, seqData, seqPos, float, 3);
@@ -671,6 +809,11 @@ void FAVVReader::PrepareFrame(AVVEncodedFrame* frame)
             ReadFrameColorsRGB565NormalsOct16(data + readPos, readPos, *frame);
         }
 
+        if (frameContainerType == AVV_FRAME_BOUNDS_AABB_32)
+        {
+            ReadFrameBoundsAABB32(data + readPos, readPos, *frame);
+        }
+
         readPos += frameContainerSize;
     }
 }
@@ -697,6 +840,42 @@ void FAVVReader::PrepareFrameTexture(AVVEncodedFrame* frame)
     {
         ReadFrameTextureLumaBC4(data + readPos, readPos, *frame);
     }
+
+    if (frameContainerType == AVV_FRAME_TEXTURE_LUMA_BC4_DELTA)
+    {
+        ReadFrameTextureLumaBC4Delta(data + readPos, readPos, *frame);
+    }
+
+    DecodeFrameLuma(frame, CPULumaFormat);
+}
+
+void FAVVReader::DecodeFrameLuma(AVVEncodedFrame* frame, EAVVLumaFormat format)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AVVReader_DecodeFrameLuma);
+
+    if (format == EAVVLumaFormat::BC4 || !frame->blockDecode || frame->blockCount == 0 || frame->textureContent == nullptr)
+    {
+        return;
+    }
+
+    if (frame->decodedLumaContent != nullptr)
+    {
+        GHoloMeshManager.FreeBlock(frame->decodedLumaContent);
+    }
+
+    const uint8_t* blocks = &frame->textureContent->Data[frame->lumaDataOffset];
+    if (format == EAVVLumaFormat::R8)
+    {
+        frame->decodedLumaContent = GHoloMeshManager.AllocBlock(frame->blockCount * 16);
+        HoloMeshUtilities::DecodeBC4Blocks(blocks, frame->blockCount, frame->decodedLumaContent->Data);
+    }
+    else
+    {
+        frame->decodedLumaContent = GHoloMeshManager.AllocBlock(frame->blockCount * 8);
+        HoloMeshUtilities::TranscodeBC4BlocksToEAC(blocks, frame->blockCount, frame->decodedLumaContent->Data);
+    }
+
+    frame->decodedLumaFormat = format;
 }
 
 void FAVVReader::ReadFrameAnimMat4x4(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut)
@@ -743,6 +922,15 @@ void FAVVReader::ReadFrameAnimDeltaPos32(uint8_t* frameData, size_t readPos, AVV
     decodedFrameOut.deltaDataSize = decodedFrameOut.deltaPosCount * 4;
 }
 
+void FAVVReader::ReadFrameBoundsAABB32(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut)
+{
+    size_t dataPos = 0;
+
+    AVV_READ(decodedFrameOut.aabbMin, frameData, dataPos, float, 3);
+    AVV_READ(decodedFrameOut.aabbMax, frameData, dataPos, float, 3);
+    decodedFrameOut.hasAABB = true;
+}
+
 void FAVVReader::ReadFrameTextureLuma8(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut)
 {
     uint32_t dataPos = 0;
@@ -762,6 +950,20 @@ void FAVVReader::ReadFrameTextureLumaBC4(uint8_t* frameData, size_t readPos, AVV
     decodedFrameOut.lumaDataSize = decodedFrameOut.blockCount * 8;
     decodedFrameOut.lumaCount = decodedFrameOut.blockCount * 16;
     decodedFrameOut.blockDecode = true;
+    decodedFrameOut.deltaBlocks = false;
+}
+
+void FAVVReader::ReadFrameTextureLumaBC4Delta(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut)
+{
+    uint32_t dataPos = 0;
+
+    AVV_READ(decodedFrameOut.blockCount, frameData, dataPos, uint32_t, 1);
+    decodedFrameOut.blockIndexOffset = readPos + dataPos;
+    decodedFrameOut.lumaDataOffset = decodedFrameOut.blockIndexOffset + (decodedFrameOut.blockCount * 4);
+    decodedFrameOut.lumaDataSize = decodedFrameOut.blockCount * 8;
+    decodedFrameOut.lumaCount = decodedFrameOut.blockCount * 16;
+    decodedFrameOut.blockDecode = true;
+    decodedFrameOut.deltaBlocks = true;
 }
 
 void FAVVReader::ReadFrameColorsRGB565(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut)
@@ -796,6 +998,16 @@ int FAVVReader::GetSegmentIndex(int frameNumber)
     return FrameToSegment[frameNumber];
 }
 
+int FAVVReader::GetSegmentStartFrame(int segmentIndex)
+{
+    if (segmentIndex < 0 || segmentIndex >= sequenceStartFrames.size())
+    {
+        return -1;
+    }
+
+    return sequenceStartFrames[segmentIndex];
+}
+
 bool FAVVReader::DecodeMetaSkeleton(UAVVFile* avvFile, AVVSkeleton* targetSkeleton)
 {
     SCOPE_CYCLE_COUNTER(STAT_AVVReader_DecodeMetaSkeleton);
@@ -0,0 +1,847 @@
+// Copyright 2023 Arcturus Studios Holdings, Inc. All Rights Reserved.
+
+#include "HoloSuiteIO.h"
+#include "HoloSuitePlayerModule.h"
+
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ScopeRWLock.h"
+#if (ENGINE_MAJOR_VERSION == 5)
+#include "Misc/PackagePath.h"
+#endif
+
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarHoloSuiteIOBackend(
+	TEXT("r.HoloSuite.IO.Backend"),
+	0,
+	TEXT("Where AVV and OMS payloads are read from, applies to files opened afterwards.\n")
+	TEXT(" 0: Bulk data streaming requests (default)\n")
+	TEXT(" 1: Package file, memory mapped where supported\n")
+	TEXT(" 2: Copied into memory when the file is opened"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHoloSuiteIOBulkDataPriority(
+	TEXT("r.HoloSuite.IO.BulkData.Priority"),
+	AIOP_High,
+	TEXT("Priority of bulk data streaming reads, 0 (min) to 5 (critical path)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHoloSuiteIOBulkDataQueueDepth(
+	TEXT("r.HoloSuite.IO.BulkData.QueueDepth"),
+	0,
+	TEXT("Bulk data streaming reads in flight at once per open file, 0 is unlimited."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHoloSuiteIOFilePriority(
+	TEXT("r.HoloSuite.IO.File.Priority"),
+	AIOP_High,
+	TEXT("Priority of package file reads that aren't memory mapped, 0 (min) to 5 (critical path)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHoloSuiteIOFileQueueDepth(
+	TEXT("r.HoloSuite.IO.File.QueueDepth"),
+	0,
+	TEXT("Package file reads in flight at once per open file, 0 is unlimited."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHoloSuiteIOFileMapped(
+	TEXT("r.HoloSuite.IO.File.Mapped"),
+	1,
+	TEXT("Memory map package files when the platform supports it, otherwise they're read asynchronously."),
+	ECVF_Default);
+
+static EAsyncIOPriorityAndFlags GetPriority(const TAutoConsoleVariable<int32>& CVar)
+{
+	return (EAsyncIOPriorityAndFlags)FMath::Clamp(CVar.GetValueOnAnyThread(), (int32)AIOP_MIN, (int32)AIOP_MAX);
+}
+
+// Counts the reads a backend has in flight. Shared with its requests so they can outlive it.
+struct FHoloSuiteIOQueue
+{
+	std::atomic<int32> InFlight = { 0 };
+	int32 MaxDepth = 0;
+
+	// Callbacks of requests held back by MaxDepth, called when the next read in flight is released.
+	FCriticalSection WaiterLock;
+	TArray<FHoloSuiteIOCallback> Waiters;
+
+	void AddWaiter(const FHoloSuiteIOCallback& Callback)
+	{
+		FScopeLock Lock(&WaiterLock);
+		Waiters.Add(Callback);
+	}
+
+	bool TryAcquire()
+	{
+		int32 Current = InFlight.load();
+		do
+		{
+			if (MaxDepth > 0 && Current >= MaxDepth)
+			{
+				return false;
+			}
+		} while (!InFlight.compare_exchange_weak(Current, Current + 1));
+		return true;
+	}
+
+	void Release()
+	{
+		InFlight--;
+
+		TArray<FHoloSuiteIOCallback> Woken;
+		{
+			FScopeLock Lock(&WaiterLock);
+			Woken = MoveTemp(Waiters);
+		}
+		for (FHoloSuiteIOCallback& Callback : Woken)
+		{
+			Callback();
+		}
+	}
+};
+typedef TSharedPtr<FHoloSuiteIOQueue, ESPMode::ThreadSafe> FHoloSuiteIOQueueRef;
+
+// Read that finished when it was created: memory copies and reads that couldn't be issued.
+class FHoloSuiteCompletedIORequest : public IHoloSuiteIORequest
+{
+public:
+	FHoloSuiteCompletedIORequest(bool bInSucceeded) : bSucceeded(bInSucceeded) {}
+
+	virtual bool PollCompletion() override { return true; }
+	virtual void WaitCompletion() override {}
+	virtual bool Succeeded() const override { return bSucceeded; }
+
+private:
+	bool bSucceeded;
+};
+
+// Holds the read back until its backend's queue has room.
+class FHoloSuiteQueuedIORequest : public IHoloSuiteIORequest
+{
+public:
+	FHoloSuiteQueuedIORequest(FHoloSuiteIOQueueRef InQueue, FHoloSuiteIOCallback InCallback)
+		: Queue(InQueue)
+		, Callback(MoveTemp(InCallback))
+	{
+	}
+
+	virtual ~FHoloSuiteQueuedIORequest()
+	{
+		// Derived requests wait for their read before this runs.
+		if (bIssued && !bCompleted)
+		{
+			Queue->Release();
+		}
+	}
+
+	virtual bool PollCompletion() override
+	{
+		if (!bIssued)
+		{
+			if (!Queue->TryAcquire())
+			{
+				if (!Callback)
+				{
+					return false;
+				}
+
+				// Registered before trying again so a read released in between isn't missed.
+				Queue->AddWaiter(Callback);
+				if (!Queue->TryAcquire())
+				{
+					return false;
+				}
+			}
+			Issue();
+			bIssued = true;
+		}
+
+		if (!bCompleted && bIssuedCompleted)
+		{
+			Complete();
+		}
+		return bCompleted;
+	}
+
+	virtual void WaitCompletion() override
+	{
+		if (!bIssued)
+		{
+			// Whoever waits is stalled on this read anyway, so it skips the queue.
+			Queue->InFlight++;
+			Issue();
+			bIssued = true;
+		}
+
+		if (!bCompleted)
+		{
+			WaitIssued();
+			Complete();
+		}
+	}
+
+	virtual bool Succeeded() const override { return bSucceeded; }
+
+protected:
+	// Issues the read, which reports back through SetIssuedCompleted, possibly before returning.
+	virtual void Issue() = 0;
+	// Blocks until the read is finished and SetIssuedCompleted has been called.
+	virtual void WaitIssued() = 0;
+
+	// Called once from whichever thread finishes the read. Completion is tracked here rather than by
+	// polling the engine request, which only reports it after its completion callback has returned.
+	void SetIssuedCompleted(bool bInSucceeded)
+	{
+		bSucceeded = bInSucceeded;
+		bIssuedCompleted = true;
+
+		if (Callback)
+		{
+			Callback();
+		}
+	}
+
+	bool IsIssuedCompleted() const { return bIssuedCompleted; }
+
+	// Called by derived destructors so the destination buffer is no longer written to.
+	void WaitIfIssued()
+	{
+		if (bIssued && !bCompleted)
+		{
+			WaitIssued();
+			Complete();
+		}
+	}
+
+	bool bSucceeded = false;
+
+private:
+	void Complete()
+	{
+		bCompleted = true;
+		Queue->Release();
+	}
+
+	FHoloSuiteIOQueueRef Queue;
+	FHoloSuiteIOCallback Callback;
+	bool bIssued = false;
+	bool bCompleted = false;
+	std::atomic<bool> bIssuedCompleted = { false };
+};
+
+class FHoloSuiteBulkDataIORequest : public FHoloSuiteQueuedIORequest
+{
+public:
+	FHoloSuiteBulkDataIORequest(FHoloSuiteIOQueueRef InQueue, FHoloSuiteIOCallback InCallback, const FByteBulkData& InBulkData, uint8* InDest, EAsyncIOPriorityAndFlags InPriority)
+		: FHoloSuiteQueuedIORequest(InQueue, MoveTemp(InCallback))
+		, BulkData(InBulkData)
+		, Dest(InDest)
+		, Priority(InPriority)
+	{
+	}
+
+	virtual ~FHoloSuiteBulkDataIORequest()
+	{
+		WaitIfIssued();
+		if (Request != nullptr)
+		{
+			// The completion callback may still be returning.
+			Request->WaitCompletion();
+			delete Request;
+		}
+	}
+
+protected:
+	virtual void Issue() override
+	{
+		FBulkDataIORequestCallBack OnCompleted = [this](bool bWasCancelled, IBulkDataIORequest*)
+		{
+			SetIssuedCompleted(!bWasCancelled);
+		};
+
+		Request = BulkData.CreateStreamingRequest(Priority, &OnCompleted, Dest);
+		if (Request == nullptr)
+		{
+			SetIssuedCompleted(false);
+		}
+	}
+
+	virtual void WaitIssued() override
+	{
+		if (Request != nullptr)
+		{
+			Request->WaitCompletion();
+			if (!IsIssuedCompleted())
+			{
+				SetIssuedCompleted(!Request->WasCancelled());
+			}
+		}
+	}
+
+private:
+	const FByteBulkData& BulkData;
+	uint8* Dest;
+	EAsyncIOPriorityAndFlags Priority;
+	IBulkDataIORequest* Request = nullptr;
+};
+
+// Payload that's already in memory, as in the editor after an import.
+class FHoloSuiteLoadedBulkDataIORequest : public IHoloSuiteIORequest
+{
+public:
+	FHoloSuiteLoadedBulkDataIORequest(const FByteBulkData& BulkData, uint8* Dest, FHoloSuiteIOCallback Callback)
+		: State(MakeShared<FState, ESPMode::ThreadSafe>())
+	{
+		State->Callback = MoveTemp(Callback);
+
+		// Reads come from worker threads through the readers and multiple locks from off
+		// the game thread from players using the same file seems unstable.
+		AsyncTask(ENamedThreads::GameThread, [State = State, &BulkData, Dest]
+		{
+			FScopeLock Lock(&State->CriticalSection);
+			if (!State->bCancelled)
+			{
+				const uint8* Data = (const uint8*)BulkData.LockReadOnly();
+				FMemory::Memcpy(Dest, Data, BulkData.GetBulkDataSize());
+				BulkData.Unlock();
+			}
+			State->bCompleted = true;
+
+			if (!State->bCancelled && State->Callback)
+			{
+				State->Callback();
+			}
+		});
+	}
+
+	virtual ~FHoloSuiteLoadedBulkDataIORequest()
+	{
+		// Waiting could deadlock on the game thread, the copy is skipped instead.
+		FScopeLock Lock(&State->CriticalSection);
+		State->bCancelled = true;
+	}
+
+	virtual bool PollCompletion() override
+	{
+		return State->bCompleted;
+	}
+
+	virtual void WaitCompletion() override
+	{
+		check(!IsInGameThread());
+		while (!State->bCompleted)
+		{
+			FPlatformProcess::Sleep(0.0f);
+		}
+	}
+
+	virtual bool Succeeded() const override { return true; }
+
+private:
+	struct FState
+	{
+		FCriticalSection CriticalSection;
+		std::atomic<bool> bCompleted = { false };
+		bool bCancelled = false;
+		FHoloSuiteIOCallback Callback;
+	};
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+};
+
+class FHoloSuiteAsyncFileIORequest : public FHoloSuiteQueuedIORequest
+{
+public:
+	FHoloSuiteAsyncFileIORequest(FHoloSuiteIOQueueRef InQueue, FHoloSuiteIOCallback InCallback, TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe> InHandle,
+		int64 InOffset, int64 InSize, uint8* InDest, EAsyncIOPriorityAndFlags InPriority)
+		: FHoloSuiteQueuedIORequest(InQueue, MoveTemp(InCallback))
+		, Handle(InHandle)
+		, Offset(InOffset)
+		, Size(InSize)
+		, Dest(InDest)
+		, Priority(InPriority)
+	{
+	}
+
+	virtual ~FHoloSuiteAsyncFileIORequest()
+	{
+		WaitIfIssued();
+		if (Request != nullptr)
+		{
+			// The completion callback may still be returning.
+			Request->WaitCompletion();
+			delete Request;
+		}
+	}
+
+protected:
+	virtual void Issue() override
+	{
+		FAsyncFileCallBack OnCompleted = [this](bool bWasCancelled, IAsyncReadRequest* InRequest)
+		{
+			SetIssuedCompleted(!bWasCancelled && InRequest->GetReadResults() != nullptr);
+		};
+
+		Request = Handle->ReadRequest(Offset, Size, Priority, &OnCompleted, Dest);
+		if (Request == nullptr)
+		{
+			SetIssuedCompleted(false);
+		}
+	}
+
+	virtual void WaitIssued() override
+	{
+		if (Request != nullptr)
+		{
+			Request->WaitCompletion();
+			if (!IsIssuedCompleted())
+			{
+				SetIssuedCompleted(Request->GetReadResults() != nullptr);
+			}
+		}
+	}
+
+private:
+	TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe> Handle;
+	int64 Offset;
+	int64 Size;
+	uint8* Dest;
+	EAsyncIOPriorityAndFlags Priority;
+	IAsyncReadRequest* Request = nullptr;
+};
+
+class FHoloSuiteBulkDataIOBackend : public IHoloSuiteIOBackend
+{
+public:
+	FHoloSuiteBulkDataIOBackend()
+		: Queue(MakeShared<FHoloSuiteIOQueue, ESPMode::ThreadSafe>())
+	{
+	}
+
+	virtual EHoloSuiteIOBackend GetType() const override { return EHoloSuiteIOBackend::BulkData; }
+
+	virtual IHoloSuiteIORequest* ReadAsync(const FByteBulkData& BulkData, uint8* Dest, FHoloSuiteIOCallback Callback) override
+	{
+		if (BulkData.IsBulkDataLoaded())
+		{
+			return new FHoloSuiteLoadedBulkDataIORequest(BulkData, Dest, MoveTemp(Callback));
+		}
+
+		Queue->MaxDepth = Settings.MaxQueueDepth;
+		return new FHoloSuiteBulkDataIORequest(Queue, MoveTemp(Callback), BulkData, Dest, Settings.Priority);
+	}
+
+	virtual bool Read(const FByteBulkData& BulkData, uint8* Dest) override
+	{
+		if (BulkData.IsBulkDataLoaded())
+		{
+			const uint8* Data = (const uint8*)BulkData.LockReadOnly();
+			FMemory::Memcpy(Dest, Data, BulkData.GetBulkDataSize());
+			BulkData.Unlock();
+			return true;
+		}
+
+		IBulkDataIORequest* Request = BulkData.CreateStreamingRequest(AIOP_CriticalPath, nullptr, Dest);
+		if (Request == nullptr)
+		{
+			return false;
+		}
+
+		Request->WaitCompletion();
+		bool bSucceeded = !Request->WasCancelled();
+		delete Request;
+		return bSucceeded;
+	}
+
+private:
+	FHoloSuiteIOQueueRef Queue;
+};
+
+class FHoloSuiteFileIOBackend : public IHoloSuiteIOBackend
+{
+public:
+	FHoloSuiteFileIOBackend()
+		: Queue(MakeShared<FHoloSuiteIOQueue, ESPMode::ThreadSafe>())
+		, bMapped(CVarHoloSuiteIOFileMapped.GetValueOnAnyThread() > 0)
+	{
+	}
+
+	virtual ~FHoloSuiteFileIOBackend()
+	{
+		// Requests keep their handle alive, only the mappings are released here.
+		for (TPair<FString, FMappedFile>& Pair : MappedFiles)
+		{
+			delete Pair.Value.Region;
+			delete Pair.Value.Handle;
+		}
+	}
+
+	virtual EHoloSuiteIOBackend GetType() const override { return EHoloSuiteIOBackend::File; }
+
+	virtual IHoloSuiteIORequest* ReadAsync(const FByteBulkData& BulkData, uint8* Dest, FHoloSuiteIOCallback Callback) override
+	{
+		FString Filename;
+		int64 Offset = 0;
+		if (!GetFileLocation(BulkData, Filename, Offset))
+		{
+			return BulkDataBackend.ReadAsync(BulkData, Dest, MoveTemp(Callback));
+		}
+
+		const int64 Size = BulkData.GetBulkDataSize();
+		if (const uint8* Mapped = GetMappedData(Filename, Offset, Size))
+		{
+			FMemory::Memcpy(Dest, Mapped, Size);
+			return new FHoloSuiteCompletedIORequest(true);
+		}
+
+		TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe> Handle = GetAsyncHandle(Filename);
+		if (!Handle.IsValid())
+		{
+			return BulkDataBackend.ReadAsync(BulkData, Dest, MoveTemp(Callback));
+		}
+
+		Queue->MaxDepth = Settings.MaxQueueDepth;
+		return new FHoloSuiteAsyncFileIORequest(Queue, MoveTemp(Callback), Handle, Offset, Size, Dest, Settings.Priority);
+	}
+
+	virtual bool Read(const FByteBulkData& BulkData, uint8* Dest) override
+	{
+		FString Filename;
+		int64 Offset = 0;
+		if (!GetFileLocation(BulkData, Filename, Offset))
+		{
+			return BulkDataBackend.Read(BulkData, Dest);
+		}
+
+		const int64 Size = BulkData.GetBulkDataSize();
+		if (const uint8* Mapped = GetMappedData(Filename, Offset, Size))
+		{
+			FMemory::Memcpy(Dest, Mapped, Size);
+			return true;
+		}
+
+		TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe> Handle = GetAsyncHandle(Filename);
+		if (!Handle.IsValid())
+		{
+			return BulkDataBackend.Read(BulkData, Dest);
+		}
+
+		FHoloSuiteAsyncFileIORequest Request(MakeShared<FHoloSuiteIOQueue, ESPMode::ThreadSafe>(), nullptr, Handle, Offset, Size, Dest, AIOP_CriticalPath);
+		Request.WaitCompletion();
+		return Request.Succeeded();
+	}
+
+private:
+	struct FMappedFile
+	{
+		IMappedFileHandle* Handle = nullptr;
+		IMappedFileRegion* Region = nullptr;
+	};
+
+	// Finds where the payload sits in the file it was saved to. Fails for payloads that
+	// aren't stored as plain bytes in a loose file, or that are loaded in memory and may
+	// have been changed since, as in the editor after an import.
+	static bool GetFileLocation(const FByteBulkData& BulkData, FString& OutFilename, int64& OutOffset)
+	{
+		if (BulkData.IsBulkDataLoaded() || BulkData.IsStoredCompressedOnDisk())
+		{
+			return false;
+		}
+
+#if (ENGINE_MAJOR_VERSION == 5)
+		if (BulkData.IsUsingIODispatcher() || !BulkData.CanLoadFromDisk())
+		{
+			return false;
+		}
+
+		const FPackagePath& PackagePath = BulkData.GetPackagePath();
+		if (PackagePath.IsEmpty())
+		{
+			return false;
+		}
+		OutFilename = PackagePath.GetLocalFullPath(BulkData.GetPackageSegment());
+#else
+		OutFilename = BulkData.GetFilename();
+#endif
+
+		OutOffset = BulkData.GetBulkDataOffsetInFile();
+		return !OutFilename.IsEmpty() && OutOffset >= 0;
+	}
+
+	const uint8* GetMappedData(const FString& Filename, int64 Offset, int64 Size)
+	{
+		if (!bMapped)
+		{
+			return nullptr;
+		}
+
+		FScopeLock Lock(&CriticalSection);
+
+		FMappedFile* MappedFile = MappedFiles.Find(Filename);
+		if (MappedFile == nullptr)
+		{
+			// Failures are cached too so the file isn't opened again for every read.
+			MappedFile = &MappedFiles.Add(Filename);
+			MappedFile->Handle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename);
+			if (MappedFile->Handle != nullptr)
+			{
+				MappedFile->Region = MappedFile->Handle->MapRegion(0, MappedFile->Handle->GetFileSize());
+			}
+		}
+
+		if (MappedFile->Region == nullptr || Offset + Size > MappedFile->Region->GetMappedSize())
+		{
+			return nullptr;
+		}
+		return MappedFile->Region->GetMappedPtr() + Offset;
+	}
+
+	TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe> GetAsyncHandle(const FString& Filename)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe>* Handle = AsyncHandles.Find(Filename);
+		if (Handle == nullptr)
+		{
+			Handle = &AsyncHandles.Add(Filename, TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe>(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*Filename)));
+		}
+		return *Handle;
+	}
+
+	FHoloSuiteIOQueueRef Queue;
+	FHoloSuiteBulkDataIOBackend BulkDataBackend;
+	bool bMapped;
+
+	FCriticalSection CriticalSection;
+	TMap<FString, FMappedFile> MappedFiles;
+	TMap<FString, TSharedPtr<IAsyncReadFileHandle, ESPMode::ThreadSafe>> AsyncHandles;
+};
+
+class FHoloSuiteMemoryIOBackend : public IHoloSuiteIOBackend
+{
+public:
+	virtual EHoloSuiteIOBackend GetType() const override { return EHoloSuiteIOBackend::Memory; }
+
+	virtual IHoloSuiteIORequest* ReadAsync(const FByteBulkData& BulkData, uint8* Dest, FHoloSuiteIOCallback Callback) override
+	{
+		return new FHoloSuiteCompletedIORequest(Read(BulkData, Dest));
+	}
+
+	virtual bool Read(const FByteBulkData& BulkData, uint8* Dest) override
+	{
+		{
+			FRWScopeLock Lock(PayloadLock, SLT_ReadOnly);
+			if (const TArray64<uint8>* Payload = Payloads.Find(&BulkData))
+			{
+				FMemory::Memcpy(Dest, Payload->GetData(), Payload->Num());
+				return true;
+			}
+		}
+
+		UE_LOG(LogHoloSuitePlayer, Warning, TEXT("HoloSuite IO: payload wasn't preloaded into memory, reading it from bulk data."));
+		return HoloSuiteIO::GetBulkDataBackend().Read(BulkData, Dest);
+	}
+
+	virtual void Preload(const FByteBulkData& BulkData) override
+	{
+		FRWScopeLock Lock(PayloadLock, SLT_Write);
+		if (Payloads.Contains(&BulkData))
+		{
+			return;
+		}
+
+		TArray64<uint8> Payload;
+		Payload.SetNumUninitialized(BulkData.GetBulkDataSize());
+		if (HoloSuiteIO::GetBulkDataBackend().Read(BulkData, Payload.GetData()))
+		{
+			Payloads.Add(&BulkData, MoveTemp(Payload));
+		}
+	}
+
+private:
+	FRWLock PayloadLock;
+	TMap<const FByteBulkData*, TArray64<uint8>> Payloads;
+};
+
+class FHoloSuiteResidentIOBackend : public IHoloSuiteIOBackend
+{
+public:
+	FHoloSuiteResidentIOBackend(TArrayView<const FByteBulkData* const> Payloads, int64 SizeBytes)
+	{
+		Data.SetNumUninitialized(SizeBytes);
+
+		// Payloads on disk are read in the background, ones already in memory are copied directly
+		// since their async path needs the game thread this is running on.
+		int64 Offset = 0;
+		for (const FByteBulkData* Payload : Payloads)
+		{
+			const int64 Size = Payload->GetBulkDataSize();
+			if (Size <= 0 || Ranges.Contains(Payload))
+			{
+				continue;
+			}
+
+			uint8* Dest = Data.GetData() + Offset;
+			if (Payload->IsBulkDataLoaded())
+			{
+				HoloSuiteIO::GetBulkDataBackend().Read(*Payload, Dest);
+			}
+			else
+			{
+				Requests.Add(HoloSuiteIO::GetBulkDataBackend().ReadAsync(*Payload, Dest));
+			}
+
+			Ranges.Add(Payload, TPair<int64, int64>(Offset, Size));
+			Offset += Size;
+		}
+
+		IsLoaded();
+	}
+
+	virtual ~FHoloSuiteResidentIOBackend()
+	{
+		// Requests write into Data, deleting them waits for any that are still in flight.
+		for (IHoloSuiteIORequest* Request : Requests)
+		{
+			delete Request;
+		}
+	}
+
+	virtual EHoloSuiteIOBackend GetType() const override { return EHoloSuiteIOBackend::Resident; }
+
+	virtual IHoloSuiteIORequest* ReadAsync(const FByteBulkData& BulkData, uint8* Dest, FHoloSuiteIOCallback Callback) override
+	{
+		if (!IsLoaded())
+		{
+			return HoloSuiteIO::GetBulkDataBackend().ReadAsync(BulkData, Dest, MoveTemp(Callback));
+		}
+		return new FHoloSuiteCompletedIORequest(Read(BulkData, Dest));
+	}
+
+	virtual bool Read(const FByteBulkData& BulkData, uint8* Dest) override
+	{
+		// Ranges isn't modified after construction so reads don't need a lock.
+		const TPair<int64, int64>* Range = Ranges.Find(&BulkData);
+		if (Range != nullptr && IsLoaded())
+		{
+			FMemory::Memcpy(Dest, Data.GetData() + Range->Key, Range->Value);
+			return true;
+		}
+		return HoloSuiteIO::GetBulkDataBackend().Read(BulkData, Dest);
+	}
+
+private:
+	// Polls the reads filling Data, until they're all in every read is streamed instead. Stays
+	// false if any of them failed.
+	bool IsLoaded()
+	{
+		if (bLoaded)
+		{
+			return true;
+		}
+
+		FScopeLock Lock(&LoadLock);
+		if (bFailed || bLoaded)
+		{
+			return bLoaded;
+		}
+
+		for (int32 Index = Requests.Num() - 1; Index >= 0; --Index)
+		{
+			if (Requests[Index]->PollCompletion())
+			{
+				bFailed |= !Requests[Index]->Succeeded();
+				delete Requests[Index];
+				Requests.RemoveAtSwap(Index);
+			}
+		}
+
+		if (bFailed)
+		{
+			UE_LOG(LogHoloSuitePlayer, Warning, TEXT("HoloSuite IO: failed to make payloads resident, they'll be streamed instead."));
+		}
+		else if (Requests.Num() == 0)
+		{
+			bLoaded = true;
+		}
+		return bLoaded;
+	}
+
+	TArray64<uint8> Data;
+	// Offset and size of each payload in Data.
+	TMap<const FByteBulkData*, TPair<int64, int64>> Ranges;
+
+	// Reads into Data that haven't been seen to finish, guarded by LoadLock.
+	FCriticalSection LoadLock;
+	TArray<IHoloSuiteIORequest*> Requests;
+	bool bFailed = false;
+	std::atomic<bool> bLoaded = { false };
+};
+
+namespace HoloSuiteIO
+{
+	FHoloSuiteIOBackendRef CreateBackend(EHoloSuiteIOBackend Type)
+	{
+		FHoloSuiteIOBackendRef Backend;
+		switch (Type)
+		{
+			case EHoloSuiteIOBackend::File:
+				Backend = MakeShared<FHoloSuiteFileIOBackend, ESPMode::ThreadSafe>();
+				Backend->Settings.Priority = GetPriority(CVarHoloSuiteIOFilePriority);
+				Backend->Settings.MaxQueueDepth = FMath::Max(CVarHoloSuiteIOFileQueueDepth.GetValueOnAnyThread(), 0);
+				break;
+
+			case EHoloSuiteIOBackend::Memory:
+				Backend = MakeShared<FHoloSuiteMemoryIOBackend, ESPMode::ThreadSafe>();
+				break;
+
+			default:
+				Backend = MakeShared<FHoloSuiteBulkDataIOBackend, ESPMode::ThreadSafe>();
+				Backend->Settings.Priority = GetPriority(CVarHoloSuiteIOBulkDataPriority);
+				Backend->Settings.MaxQueueDepth = FMath::Max(CVarHoloSuiteIOBulkDataQueueDepth.GetValueOnAnyThread(), 0);
+				break;
+		}
+		return Backend;
+	}
+
+	FHoloSuiteIOBackendRef CreateDefaultBackend()
+	{
+		int32 Type = FMath::Clamp(CVarHoloSuiteIOBackend.GetValueOnAnyThread(), 0, (int32)EHoloSuiteIOBackend::Memory);
+		return CreateBackend((EHoloSuiteIOBackend)Type);
+	}
+
+	FHoloSuiteIOBackendRef CreateResidentBackend(TArrayView<const FByteBulkData* const> Payloads, int64 MaxSizeBytes)
+	{
+		int64 SizeBytes = 0;
+		for (const FByteBulkData* Payload : Payloads)
+		{
+			SizeBytes += FMath::Max<int64>(Payload->GetBulkDataSize(), 0);
+		}
+
+		if (SizeBytes > MaxSizeBytes)
+		{
+			return nullptr;
+		}
+
+		return MakeShared<FHoloSuiteResidentIOBackend, ESPMode::ThreadSafe>(Payloads, SizeBytes);
+	}
+
+	IHoloSuiteIOBackend& GetBulkDataBackend()
+	{
+		static FHoloSuiteBulkDataIOBackend Backend;
+		return Backend;
+	}
+
+	const TCHAR* LexToString(EHoloSuiteIOBackend Type)
+	{
+		switch (Type)
+		{
+			case EHoloSuiteIOBackend::File:     return TEXT("File");
+			case EHoloSuiteIOBackend::Memory:   return TEXT("Memory");
+			case EHoloSuiteIOBackend::Resident: return TEXT("Resident");
+			default:                            return TEXT("BulkData");
+		}
+	}
+}
@@ -74,16 +74,21 @@ AHoloSuitePlayer::AHoloSuitePlayer(const FObjectInitializer& ObjectInitializer)
     Mute                    = false;
     FrameRate               = 30.0f;
     CurrentFrame            = 0;
+    FrameInterpolation      = false;
 
     // Level of Detail (LOD)
     MinimumLOD              = 0;
     ForceLOD                = -1;
+    LOD0UpdateDivisor       = 1;
+    LOD1UpdateDivisor       = 1;
+    LOD2UpdateDivisor       = 2;
 
     // Decoder
     MaxBufferedSequences    = 20;
     LoadInEditor            = true;
     PlaybackDelay           = 0;
     UseCPUDecoder           = false;
+    ResidentPlayback        = false;
     bSupportsCompute        = false;
 
     // Skeleton
@@ -219,6 +224,11 @@ void AHoloSuitePlayer::PostEditChangeProperty(FPropertyChangedEvent& PropertyCha
         }
     }
 
+    if (propertyName == "FrameInterpolation")
+    {
+        SetFrameInterpolation(FrameInterpolation);
+    }
+
     if (propertyName == "LOD0ScreenSize" || propertyName == "LOD1ScreenSize" || propertyName == "LOD2ScreenSize"
         || propertyName == "MinimumLOD" || propertyName == "ForceLOD")
     {
@@ -228,12 +238,20 @@ void AHoloSuitePlayer::PostEditChangeProperty(FPropertyChangedEvent& PropertyCha
         }
     }
 
+    if (propertyName == "LOD0UpdateDivisor" || propertyName == "LOD1UpdateDivisor" || propertyName == "LOD2UpdateDivisor")
+    {
+        if (PlayerType == EPlayerType::AVV)
+        {
+            AVVPlayerComponent->SetLODUpdateDivisors(LOD0UpdateDivisor, LOD1UpdateDivisor, LOD2UpdateDivisor);
+        }
+    }
+
     if (propertyName == "NumBufferedSequences" || propertyName == "LoadInEditor" || propertyName == "PlaybackDelay"
-        || propertyName == "UseCPUDecoder")
+        || propertyName == "UseCPUDecoder" || propertyName == "ResidentPlayback")
     {
         if (PlayerType == EPlayerType::AVV)
         {
-            AVVPlayerComponent->SetDecoderParameters(LoadInEditor, PlaybackDelay, UseCPUDecoder);
+            AVVPlayerComponent->SetDecoderParameters(LoadInEditor, PlaybackDelay, UseCPUDecoder, ResidentPlayback);
         }
         else if (PlayerType == EPlayerType::OMS)
         {
@@ -688,6 +706,21 @@ void AHoloSuitePlayer::SetAVVPlaybackParameters(bool NewExternalTiming, bool New
     }
 }
 
+void AHoloSuitePlayer::SetFrameInterpolation(bool NewFrameInterpolation)
+{
+    UE_LOG(LogHoloSuitePlayer, Display, TEXT("HoloSuitePlayer: SetFrameInterpolation"));
+
+    FrameInterpolation = NewFrameInterpolation;
+    if (PlayerType == EPlayerType::AVV && AVVPlayerComponent)
+    {
+        AVVPlayerComponent->SetFrameInterpolation(FrameInterpolation);
+    }
+    else if (PlayerType == EPlayerType::OMS && OMSPlayerComponent)
+    {
+        OMSPlayerComponent->SetFrameInterpolation(FrameInterpolation);
+    }
+}
+
 void AHoloSuitePlayer::SetAVVLODParameters(float NewLOD0ScreenSize, float NewLOD1ScreenSize, float NewLOD2ScreenSize, int NewMinimumLOD, int NewForceLOD)
 {
     UE_LOG(LogHoloSuitePlayer, Display, TEXT("HoloSuitePlayer: SetAVVLODParameters"));
@@ -714,6 +747,30 @@ void AHoloSuitePlayer::SetAVVLODParameters(float NewLOD0ScreenSize, float NewLOD
     }
 }
 
+void AHoloSuitePlayer::SetAVVLODUpdateDivisors(int NewLOD0UpdateDivisor, int NewLOD1UpdateDivisor, int NewLOD2UpdateDivisor)
+{
+    UE_LOG(LogHoloSuitePlayer, Display, TEXT("HoloSuitePlayer: SetAVVLODUpdateDivisors"));
+
+    if (PlayerType == EPlayerType::AVV)
+    {
+        LOD0UpdateDivisor = NewLOD0UpdateDivisor;
+        LOD1UpdateDivisor = NewLOD1UpdateDivisor;
+        LOD2UpdateDivisor = NewLOD2UpdateDivisor;
+        if (AVVPlayerComponent)
+        {
+            AVVPlayerComponent->SetLODUpdateDivisors(LOD0UpdateDivisor, LOD1UpdateDivisor, LOD2UpdateDivisor);
+        }
+    }
+    else if (PlayerType == EPlayerType::OMS)
+    {
+        UE_LOG(LogHoloSuitePlayer, Error, TEXT("HoloSuitePlayer: SetAVVLODUpdateDivisors should only be used for AVV playback."));
+    }
+    else
+    {
+        UE_LOG(LogHoloSuitePlayer, Error, TEXT("HoloSuitePlayer: Please configure your source volumetric asset prior to setting any parameters."));
+    }
+}
+
 void AHoloSuitePlayer::SetOMSDecoderParameters(bool NewUseCPUDecoder, int NewNumBufferedSequences)
 {
     UE_LOG(LogHoloSuitePlayer, Display, TEXT("HoloSuitePlayer: SetOMSDecoderParameters"));
@@ -739,7 +796,7 @@ void AHoloSuitePlayer::SetOMSDecoderParameters(bool NewUseCPUDecoder, int NewNum
     }
 }
 
-void AHoloSuitePlayer::SetAVVDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder)
+void AHoloSuitePlayer::SetAVVDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder, bool NewResidentPlayback)
 {
     UE_LOG(LogHoloSuitePlayer, Display, TEXT("HoloSuitePlayer: SetAVVDecoderParameters"));
 
@@ -748,9 +805,10 @@ void AHoloSuitePlayer::SetAVVDecoderParameters(bool NewLoadInEditor, int NewPlay
         LoadInEditor = NewLoadInEditor;
         PlaybackDelay = NewPlaybackDelay;
         UseCPUDecoder = NewUseCPUDecoder;
+        ResidentPlayback = NewResidentPlayback;
         if (AVVPlayerComponent)
         {
-            AVVPlayerComponent->SetDecoderParameters(LoadInEditor, PlaybackDelay, UseCPUDecoder);
+            AVVPlayerComponent->SetDecoderParameters(LoadInEditor, PlaybackDelay, UseCPUDecoder, ResidentPlayback);
         }
     }
     else if (PlayerType == EPlayerType::OMS)
@@ -16,6 +16,65 @@ DECLARE_CYCLE_STAT(TEXT("OMSDecoder.ReadbackTextureDecode"),    STAT_OMSDecoder_
 DECLARE_CYCLE_STAT(TEXT("OMSDecoder.ComputeTextureDecode"),     STAT_OMSDecoder_ComputeTextureDecode,   STATGROUP_HoloSuitePlayer);
 DECLARE_CYCLE_STAT(TEXT("OMSDecoder.Update_RenderThread"),      STAT_OMSDecoder_Update_RenderThread,    STATGROUP_HoloSuitePlayer);
 
+static TAutoConsoleVariable<bool> CVarOMSRobustFrameNumberDecode(
+    TEXT("r.OMS.RobustFrameNumberDecode"),
+    false,
+    TEXT("Majority votes over every pixel of the frame number cells when decoding on the CPU, for heavily compressed videos."),
+    ECVF_Default);
+
+// Frames between the stamped frame number being decoded, the ones in between are predicted from the media player time.
+static TAutoConsoleVariable<int32> CVarOMSFrameNumberVerifyInterval(
+    TEXT("r.OMS.FrameNumberVerifyInterval"),
+    30,
+    TEXT("Number of video frames between decoding the frame number stamped into the video. Frames in between are mapped from the media player's presentation time, which avoids a GPU readback per frame. 0 decodes every frame."),
+    ECVF_Default);
+
+void FOMSFrameSync::Reset()
+{
+    FrameOffset = 0;
+    LastPrediction = -1;
+    FramesSinceVerification = 0;
+    bVerified = false;
+}
+
+int FOMSFrameSync::PredictFrame(FTimespan Time, float FrameRate)
+{
+    return FMath::RoundToInt(Time.GetTotalSeconds() * FrameRate);
+}
+
+bool FOMSFrameSync::NeedsVerification(int Prediction, int Interval)
+{
+    // Seeks, loops and stalls can change the offset so they're verified straight away.
+    bool bDiscontinuity = LastPrediction < 0 || Prediction < LastPrediction || Prediction > LastPrediction + 2;
+
+    // Counts the video frames presented rather than calls, ticks faster than the video see the same frame again.
+    if (!bDiscontinuity)
+    {
+        FramesSinceVerification += Prediction - LastPrediction;
+    }
+    LastPrediction = Prediction;
+
+    return !bVerified || bDiscontinuity || FramesSinceVerification >= Interval;
+}
+
+void FOMSFrameSync::Verify(int Prediction, int DecodedFrameNumber)
+{
+    FramesSinceVerification = 0;
+    if (DecodedFrameNumber < 0)
+    {
+        return;
+    }
+
+    int NewOffset = DecodedFrameNumber - Prediction;
+    if (bVerified && NewOffset != FrameOffset)
+    {
+        UE_LOG(LogHoloSuitePlayer, Verbose, TEXT("OMSDecoder: Frame sync drifted from %d to %d frames."), FrameOffset, NewOffset);
+    }
+
+    FrameOffset = NewOffset;
+    bVerified = true;
+}
+
 UOMSDecoder::UOMSDecoder(const FObjectInitializer& ObjectInitializer)
     : UHoloMeshComponent(ObjectInitializer)
 {
@@ -43,6 +102,7 @@ bool UOMSDecoder::OpenOMS(UOMSFile* NewOMSFile, UMaterialInterface* NewMeshMater
     SCOPE_CYCLE_COUNTER(STAT_OMSDecoder_OpenOMS);
 
     ClearData();
+    ClearCollisionProxies();
 
     OMSFile = NewOMSFile;
    
@@ -53,11 +113,29 @@ bool UOMSDecoder::OpenOMS(UOMSFile* NewOMSFile, UMaterialInterface* NewMeshMater
     OMSHeader = new oms_header_t();
     OMSStreamableData->ReadHeaderSync(OMSHeader);
 
+    IOBackend = HoloSuiteIO::CreateDefaultBackend();
+    if (IOBackend->GetType() == EHoloSuiteIOBackend::Memory)
+    {
+        for (const FOMSStreamableChunk& chunk : OMSStreamableData->Chunks)
+        {
+            IOBackend->Preload(chunk.BulkData);
+        }
+    }
+
     // Build Lookup Table.
     for (uint32_t frameIndex = 0; frameIndex < OMSHeader->frame_count; frameIndex++)
     {
         std::pair<int, int> entry = std::make_pair(OMSStreamableData->FrameToSequenceIndex[frameIndex], OMSStreamableData->FrameToSequenceFrameOffset[frameIndex]);
         frameLookupTable.Add(entry);
+
+        if (entry.second == 0)
+        {
+            if (sequenceStartFrames.Num() <= entry.first)
+            {
+                sequenceStartFrames.SetNumZeroed(entry.first + 1);
+            }
+            sequenceStartFrames[entry.first] = frameIndex;
+        }
     }
 
     // Validate Max Number of Buffered Sequences.
@@ -92,6 +170,7 @@ void UOMSDecoder::Configure(UOMSPlayerComponent* NewPlayerComponent, bool NewUse
     {
         bUseCPUDecoder = !UOMSDecoder::CheckComputeSupport();
     }
+    bSSDRBlendSupported = UOMSDecoder::CheckComputeSupport();
     
     ValidateMaxBufferedSequences();
 }
@@ -174,7 +253,7 @@ void UOMSDecoder::Update()
         if (nextDecodedSequence > -1)
         {
             //UE_LOG(LogHoloSuitePlayer, Warning, TEXT("Requesting Work for Segment: %d"), nextDecodedSequence.load());
-            GHoloMeshManager.AddWorkRequest(RegisteredGUID, nextDecodedSequence, -1);
+            GHoloMeshManager.AddWorkRequest(RegisteredGUID, nextDecodedSequence, -1, EHoloMeshWorkType::IO);
             MeshDecoderState = EMeshDecoderState::Waiting;
 
             AdvanceNextSequence();
@@ -199,7 +278,13 @@ void UOMSDecoder::UpdateMeshMaterial(bool write, bool frameTexture, bool boneTex
 
     if (boneTexture)
     {
-        HoloMesh[index].Material->SetTextureParameterValue(FName("SSDRBoneTexture"), Cast<UTexture>(HoloMesh[index].SSDRBoneTexture.GetTexture()));
+        FHoloMesh& mesh = HoloMesh[index];
+        UTexture* ssdrTexture = mesh.SSDRFrameTextures.IsValidIndex(mesh.SSDRFrame) ? mesh.SSDRFrameTextures[mesh.SSDRFrame].GetTexture() : mesh.SSDRBoneTexture.GetTexture();
+        if (mesh.SSDRBlend > 0.0f && mesh.SSDRBlendTexture.GetRenderTarget() != nullptr)
+        {
+            ssdrTexture = mesh.SSDRBlendTexture.GetRenderTarget();
+        }
+        mesh.Material->SetTextureParameterValue(FName("SSDRBoneTexture"), ssdrTexture);
         return;
     }
 
@@ -217,6 +302,102 @@ void UOMSDecoder::UpdateMeshMaterial(bool write, bool frameTexture, bool boneTex
     }
 }
 
+void UOMSDecoder::SetSSDRBlend(int fromFrame, float blend)
+{
+    FHoloMesh& mesh = HoloMesh[ReadIndex];
+    int toFrame = fromFrame + 1;
+    if (!bSSDRBlendSupported || !mesh.SSDRFrameTextures.IsValidIndex(fromFrame) || !mesh.SSDRFrameTextures.IsValidIndex(toFrame))
+    {
+        blend = 0.0f;
+    }
+
+    if (blend == mesh.SSDRBlend && (blend <= 0.0f || fromFrame == mesh.SSDRBlendFrame))
+    {
+        return;
+    }
+
+    mesh.SSDRBlendFrame = fromFrame;
+    mesh.SSDRBlend = blend;
+
+    if (blend > 0.0f)
+    {
+        FHoloMeshDataTexture& fromTexture = mesh.SSDRFrameTextures[fromFrame];
+        FHoloMeshDataTexture& toTexture = mesh.SSDRFrameTextures[toFrame];
+        if (mesh.SSDRBlendTexture.GetRenderTarget() == nullptr || mesh.SSDRBlendTexture.TextureWidth != fromTexture.SrcWidth)
+        {
+            mesh.SSDRBlendTexture.Create(fromTexture.SrcWidth, 1, RTF_RGBA32f, TextureFilter::TF_Nearest);
+        }
+
+        // Only the frame textures and a weight go to the render thread, the matrices stay on the GPU.
+        {
+            FScopeLock Lock(&SSDRBlendLock);
+            PendingSSDRBlend.FromTexture = OMS_GET_RESOURCE(fromTexture.GetTexture());
+            PendingSSDRBlend.ToTexture = OMS_GET_RESOURCE(toTexture.GetTexture());
+            PendingSSDRBlend.BlendTexture = mesh.SSDRBlendTexture.RenderTargetResource;
+            PendingSSDRBlend.TexelCount = fromTexture.SrcWidth;
+            PendingSSDRBlend.Blend = blend;
+            bSSDRBlendPending = true;
+        }
+        GHoloMeshManager.AddUpdateRequest(RegisteredGUID, -1, -1, -1);
+    }
+
+    UpdateMeshMaterial(false, false, true, false, false, 0.0f);
+}
+
+void UOMSDecoder::BlendSSDRFrames_RenderThread(FRDGBuilder& GraphBuilder)
+{
+    FSSDRBlendRequest request;
+    {
+        FScopeLock Lock(&SSDRBlendLock);
+        if (!bSSDRBlendPending)
+        {
+            return;
+        }
+        request = PendingSSDRBlend;
+        bSSDRBlendPending = false;
+    }
+
+    if (request.FromTexture == nullptr || request.ToTexture == nullptr || request.BlendTexture == nullptr
+        || !request.FromTexture->TextureRHI || !request.ToTexture->TextureRHI)
+    {
+        return;
+    }
+
+    FTexture2DRHIRef BlendTextureRHI = request.BlendTexture->GetRenderTargetTexture();
+    if (!BlendTextureRHI.IsValid())
+    {
+        return;
+    }
+
+    if (SSDRBlendUAVTexture != BlendTextureRHI)
+    {
+        SSDRBlendUAV = RHICreateUnorderedAccessView(BlendTextureRHI, 0);
+        SSDRBlendUAVTexture = BlendTextureRHI;
+    }
+
+    TShaderMapRef<FSSDRBlendCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+    if (!ComputeShader.IsValid() || !SSDRBlendUAV.IsValid())
+    {
+        return;
+    }
+    FSSDRBlendCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FSSDRBlendCS::FParameters>();
+
+    PassParameters->FromTexture     = request.FromTexture->TextureRHI;
+    PassParameters->ToTexture       = request.ToTexture->TextureRHI;
+    PassParameters->BlendTextureOut = SSDRBlendUAV;
+    PassParameters->gBlend          = request.Blend;
+    PassParameters->gTexelCount     = request.TexelCount;
+
+    FComputeShaderUtils::AddPass(
+        GraphBuilder,
+        RDG_EVENT_NAME("OMSDecoder.SSDRBlend"),
+        ERDGPassFlags::Compute | ERDGPassFlags::NeverCull,
+        ComputeShader,
+        PassParameters,
+        FIntVector((request.TexelCount / 64) + 1, 1, 1)
+    );
+}
+
 void UOMSDecoder::ClearData()
 {
     if (OMSHeader != nullptr)
@@ -230,10 +411,42 @@ void UOMSDecoder::ClearData()
     freeQueue.Empty();
     decodedSequences.Empty();
     frameLookupTable.Empty();
+    sequenceStartFrames.Empty();
+    {
+        FScopeLock Lock(&readSequencesLock);
+        readSequences.Empty();
+    }
+    {
+        FScopeLock Lock(&collisionHullsLock);
+        collisionHulls.Empty();
+    }
+    {
+        FScopeLock Lock(&SSDRBlendLock);
+        bSSDRBlendPending = false;
+    }
+    FrameSync.Reset();
 
     OMSFile = nullptr;
 }
 
+bool UOMSDecoder::GetFrameBounds(int sequenceIndex, int frameIndex, FBox& boundsOut)
+{
+    if (OMSFile == nullptr || !sequenceStartFrames.IsValidIndex(sequenceIndex))
+    {
+        return false;
+    }
+
+    FStreamableOMSData& OMSStreamableData = (FStreamableOMSData&)OMSFile->GetStreamableData();
+    int contentFrameNumber = sequenceStartFrames[sequenceIndex] + frameIndex;
+    if (!OMSStreamableData.FrameBounds.IsValidIndex(contentFrameNumber) || !OMSStreamableData.FrameBounds[contentFrameNumber].IsValid)
+    {
+        return false;
+    }
+
+    boundsOut = OMSStreamableData.FrameBounds[contentFrameNumber];
+    return true;
+}
+
 int UOMSDecoder::GetFrameCount()
 {
     if (frameLookupTable.Num() == 0)
@@ -371,41 +584,96 @@ FDecodedOMSSequenceRef UOMSDecoder::GetSequence(int index, bool waitForSequence)
 }
 
 // Read and decode requested OMS sequence from a worker thread.
-void UOMSDecoder::DoThreadedWork(int sequenceIndex, int frameIndex)
+void UOMSDecoder::DoThreadedWork(int sequenceIndex, int frameIndex, EHoloMeshWorkType workType)
 {
     SCOPE_CYCLE_COUNTER(STAT_OMSDecoder_DoThreadedWork);
 
-    // Empty the free queue.
-    freeQueue.Empty();
+    if (workType == EHoloMeshWorkType::IO)
+    {
+        // Empty the free queue.
+        freeQueue.Empty();
+
+        if (sequenceIndex >= OMSHeader->sequence_count)
+        {
+            MeshDecoderState = EMeshDecoderState::Idle;
+            return;
+        }
+
+        FDecodedOMSSequenceRef readRequest = MakeShareable(new FDecodedOMSSequence());
+        readRequest->sequenceIndex = sequenceIndex;
+        readRequest->sequence = oms_alloc_sequence(0, 0, 0, 0, 0, 0, 0);
+        readRequest->holoMesh = new FHoloMesh();
+
+        // The IO thread only issues the read, its completion queues the decode work request
+        // that parses it. Reads that finish straight away don't call back so they're queued here.
+        FGuid decoderGUID = RegisteredGUID;
+        FHoloSuiteIOCallback onReadFinished = [decoderGUID, sequenceIndex]
+        {
+            GHoloMeshManager.AddWorkRequest(decoderGUID, sequenceIndex, -1, EHoloMeshWorkType::Decode);
+        };
+
+        FStreamableOMSData* OMSStreamableData = &(FStreamableOMSData&)OMSFile->GetStreamableData();
+        FHoloSuiteIOBackendRef ioBackend = IOBackend;
+
+        bool readFinished;
+        {
+            FScopeLock Lock(&readSequencesLock);
+            readRequest->readRequest = OMSStreamableData->Chunks[sequenceIndex].ReadSequenceAsync(readRequest->readData, ioBackend.Get(), onReadFinished);
+            readFinished = readRequest->readRequest == nullptr || readRequest->readRequest->PollCompletion();
+            readSequences.Add(sequenceIndex, readRequest);
+        }
 
-    if (sequenceIndex >= OMSHeader->sequence_count)
+        if (readFinished)
+        {
+            onReadFinished();
+        }
+        return;
+    }
+
+    // Reads can call back more than once, only the first decode work request after the read
+    // finished takes the sequence and the rest find nothing to do.
+    FDecodedOMSSequenceRef decodedSequence;
     {
-        MeshDecoderState = EMeshDecoderState::Idle;
+        FScopeLock Lock(&readSequencesLock);
+        FDecodedOMSSequenceRef* readRequest = readSequences.Find(sequenceIndex);
+        if (readRequest == nullptr || ((*readRequest)->readRequest != nullptr && !(*readRequest)->readRequest->PollCompletion()))
+        {
+            return;
+        }
+        readSequences.RemoveAndCopyValue(sequenceIndex, decodedSequence);
+    }
+
+    if (decodedSequence->readRequest != nullptr && !decodedSequence->readRequest->Succeeded())
+    {
+        UE_LOG(LogHoloSuitePlayer, Error, TEXT("Failed to read OMS sequence %d."), sequenceIndex);
+        MeshDecoderState = EMeshDecoderState::Error;
         return;
     }
 
-    FDecodedOMSSequenceRef decodedSequence = MakeShareable(new FDecodedOMSSequence());
-    decodedSequence->sequenceIndex = sequenceIndex;
-    decodedSequence->sequence = oms_alloc_sequence(0, 0, 0, 0, 0, 0, 0);
-    decodedSequence->holoMesh = new FHoloMesh();
+    FStreamableOMSData* OMSStreamableData = &(FStreamableOMSData&)OMSFile->GetStreamableData();
+    bool decoded = OMSStreamableData->Chunks[sequenceIndex].DecodeSequence(decodedSequence->readData, OMSHeader, decodedSequence->sequence);
+    decodedSequence->ReleaseRead();
+
+    if (!decoded)
+    {
+        UE_LOG(LogHoloSuitePlayer, Error, TEXT("Failed to decode OMS sequence %d."), sequenceIndex);
+        MeshDecoderState = EMeshDecoderState::Error;
+        return;
+    }
 
     oms_sequence_t* sequence = decodedSequence->sequence;
     FHoloMesh* meshOut = decodedSequence->holoMesh;
 
-    FStreamableOMSData* OMSStreamableData = &(FStreamableOMSData&)OMSFile->GetStreamableData();
-    OMSStreamableData->Chunks[sequenceIndex].ReadSequenceSync(OMSHeader, sequence);
-
     bool includeRetargetData = OMSHeader->has_retarget_data; // TODO: check a decoder flag if retarget is enabled
 
-    // We round up to the nearest 65k in the case of vertices and 60k in indices. This means the vast
-    // majority of the vertex buffer and index buffer sizes will be the same between the sequences.
-    // This allows an optimization of easily reusing the existing allocated gpu buffers.
-    int roundedVertexCount = ((sequence->vertex_count / (UINT16_MAX + 1)) + 1) * (UINT16_MAX + 1);
-    int roundedIndexCount = ((sequence->index_count / 60000) + 1) * 60000;
+    // Capacity is rounded up to buckets so the player's GPU buffers are reused whenever the next
+    // sequence fits, only the used counts are uploaded and drawn.
+    uint32 vertexCapacity = FHoloMeshVertexBuffers::GetBucketCapacity(sequence->vertex_count);
+    uint32 indexCapacity = FHoloMeshIndexBuffer::GetBucketCapacity(sequence->index_count);
 
-    meshOut->VertexBuffers->Create(roundedVertexCount, 7);
+    meshOut->VertexBuffers->Create(sequence->vertex_count, 7, false, false, true, vertexCapacity);
     bool use32Bit = sequence->vertex_count > (UINT16_MAX + 1);
-    meshOut->IndexBuffer->Create(roundedIndexCount, use32Bit);
+    meshOut->IndexBuffer->Create(sequence->index_count, use32Bit, false, indexCapacity);
 
     auto PositionData = meshOut->VertexBuffers->GetPositionData();
     FPositionVertex* Positions = (FPositionVertex*)PositionData->GetDataPointer();
@@ -466,6 +734,28 @@ void UOMSDecoder::DoThreadedWork(int sequenceIndex, int frameIndex)
         }
     }
 
+    // Proxy collision hull, cooked by the component the first time this sequence is shown.
+    if (CollisionMode == EHoloMeshCollisionMode::Proxy)
+    {
+        bool hullCached = false;
+        {
+            FScopeLock Lock(&collisionHullsLock);
+            if (const TArray<FVector>* cachedHull = collisionHulls.Find(sequenceIndex))
+            {
+                decodedSequence->collisionHull = *cachedHull;
+                hullCached = true;
+            }
+        }
+
+        if (!hullCached)
+        {
+            HoloMeshUtilities::ComputeHullPoints(&Positions[0].Position, sequence->vertex_count, decodedSequence->collisionHull);
+
+            FScopeLock Lock(&collisionHullsLock);
+            collisionHulls.Add(sequenceIndex, decodedSequence->collisionHull);
+        }
+    }
+
     // Triangles
     FHoloMeshIndexBuffer::IndexWriter Indices(meshOut->IndexBuffer);
     if (sequence->vertex_count > (UINT16_MAX + 1))
@@ -478,9 +768,6 @@ void UOMSDecoder::DoThreadedWork(int sequenceIndex, int frameIndex)
         Indices.Write(indices, sequence->index_count);
     }
 
-    // Write zeros into the unused index spots.
-    Indices.Zero(sequence->index_count, roundedIndexCount - sequence->index_count);
-
     // Retargeting
     if (includeRetargetData)
     {
@@ -551,6 +838,8 @@ void UOMSDecoder::DecodeFrameNumber()
         bUseFastScrubbing = false; // if fast scrubbing is enabled but fast scrubbing frame decode isn't executed (i.e. the game has begun), then the actor needs to know that the texture will be available on the rendertarget or on the cachedframetexture
     }
 
+    PredictTextureFrame(&DecodedTextureFrames[WriteFrameIdx]);
+
     if (bUseCPUDecoder)
     {
         ReadbackTextureDecode(MPMaterial);
@@ -583,6 +872,11 @@ std::pair<uint32_t, UTexture*> UOMSDecoder::GetFrame()
     FDecodedOMSTextureFrame* ReadFrame = &DecodedTextureFrames[WriteFrameIdx];
     if (bNewTextureFrameReady)
     {
+        if (ReadFrame->bDecodeFrameNumber && ReadFrame->PredictedFrameNumber >= 0)
+        {
+            FrameSync.Verify(ReadFrame->PredictedFrameNumber, ReadFrame->FrameNumber);
+        }
+
         if (ReadFrame->FrameNumber < frameLookupTable.Num())
         {
             ReadFrameIdx = WriteFrameIdx;
@@ -619,6 +913,29 @@ void UOMSDecoder::FastScrubbingTextureDecode()
     }
 }
 
+bool UOMSDecoder::PredictTextureFrame(FDecodedOMSTextureFrame* WriteFrame)
+{
+    WriteFrame->PredictedFrameNumber = -1;
+    WriteFrame->bDecodeFrameNumber = true;
+
+    int Interval = CVarOMSFrameNumberVerifyInterval.GetValueOnGameThread();
+    if (Interval <= 0 || ActorComponent->MediaPlayer == nullptr)
+    {
+        return true;
+    }
+
+    // Media time advances at the video's own frame rate regardless of the playback rate.
+    float VideoFrameRate = ActorComponent->MediaPlayer->GetVideoTrackFrameRate(INDEX_NONE, INDEX_NONE);
+    if (VideoFrameRate <= 0.0f)
+    {
+        return true;
+    }
+
+    WriteFrame->PredictedFrameNumber = FOMSFrameSync::PredictFrame(ActorComponent->MediaPlayer->GetTime(), VideoFrameRate);
+    WriteFrame->bDecodeFrameNumber = FrameSync.NeedsVerification(WriteFrame->PredictedFrameNumber, Interval);
+    return WriteFrame->bDecodeFrameNumber;
+}
+
 void UOMSDecoder::ReadbackTextureDecode(UMaterialInterface* sourceMaterial)
 {
     SCOPE_CYCLE_COUNTER(STAT_OMSDecoder_ReadbackTextureDecode);
@@ -693,37 +1010,36 @@ void UOMSDecoder::ReadbackTextureDecode(UMaterialInterface* sourceMaterial)
             return;
         }
 
+        if (!WriteFrame->bDecodeFrameNumber)
+        {
+            WriteFrame->FrameNumber = WriteFrame->PredictedFrameNumber + FrameSync.FrameOffset;
+            bNewTextureFrameReady = true;
+            return;
+        }
+
         TArray<FColor> pixels;
 
+        // The robust decode reads the whole 4x4 cell instead of its top rows.
+        bool bRobust = CVarOMSRobustFrameNumberDecode.GetValueOnGameThread();
+
         int xReadStart = textureResource->GetSizeXY().X - 100;
         int yReadStart = textureResource->GetSizeXY().Y - 4;
         int xReadEnd = textureResource->GetSizeXY().X - 2;
-        int yReadEnd = textureResource->GetSizeXY().Y - 2;
+        int yReadEnd = bRobust ? textureResource->GetSizeXY().Y : textureResource->GetSizeXY().Y - 2;
 
 #if PLATFORM_ANDROID
         if (!OMSUtilities::IsMobileHDREnabled())
         {
             xReadStart = textureResource->GetSizeXY().X - 100;
-            yReadStart = 2;
+            yReadStart = bRobust ? 0 : 2;
             xReadEnd = xReadStart + 96;
-            yReadEnd = yReadStart + 2;
+            yReadEnd = bRobust ? 4 : yReadStart + 2;
         }
 #endif
 
         if (textureResource->ReadPixels(pixels, FReadSurfaceDataFlags(RCM_UNorm, CubeFace_MAX), FIntRect(xReadStart, yReadStart, xReadEnd, yReadEnd)))
         {
-            unsigned char* pixelData = new unsigned char[96 * 4];
-
-            for (int i = 0; i < 96; ++i)
-            {
-                pixelData[(i * 4) + 0] = pixels[i].R;
-                pixelData[(i * 4) + 1] = pixels[i].G;
-                pixelData[(i * 4) + 2] = pixels[i].B;
-                pixelData[(i * 4) + 3] = pixels[i].A;
-            }
-
-            WriteFrame->FrameNumber = OMSUtilities::DecodeBinaryPixels(pixelData);
-            delete[] pixelData;
+            WriteFrame->FrameNumber = OMSUtilities::DecodeFrameNumber(pixels.GetData(), xReadEnd - xReadStart, yReadEnd - yReadStart, bRobust);
             bNewTextureFrameReady = true;
             return;
         }
@@ -774,7 +1090,7 @@ void UOMSDecoder::ComputeTextureDecode(UMaterialInterface* sourceMaterial)
         WriteFrame->TextureFormat = inputTexRef->GetFormat();
     }
 
-    WriteFrame->FrameNumber = -1;
+    WriteFrame->FrameNumber = WriteFrame->bDecodeFrameNumber ? -1 : WriteFrame->PredictedFrameNumber + FrameSync.FrameOffset;
     WriteFrame->SourceTexture = InputTexture;
 
     TextureDecoderState = ETextureDecoderState::Reading;
@@ -785,7 +1101,9 @@ void UOMSDecoder::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpdate
 {
     SCOPE_CYCLE_COUNTER(STAT_OMSDecoder_Update_RenderThread);
 
-    if (TextureDecoderState == ETextureDecoderState::Waiting)
+    BlendSSDRFrames_RenderThread(GraphBuilder);
+
+    if (TextureDecoderState == ETextureDecoderState::Waiting && DecodedTextureFrames[WriteFrameIdx].bDecodeFrameNumber)
     {
         FDecodedOMSTextureFrame* WriteFrame = &DecodedTextureFrames[WriteFrameIdx];
         if (WriteFrame->FrameNumberReadback->IsReady())
@@ -841,6 +1159,7 @@ void UOMSDecoder::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpdate
     HoloMeshUtilities::CopyTexture(GraphBuilder, FIntVector(WriteFrame->TextureSize.X, WriteFrame->TextureSize.Y, 1), SrcTextureRef, FIntVector::ZeroValue, DestTextureRef, WriteTextureRef, FIntVector::ZeroValue);
 
     // Read Frame Number
+    if (WriteFrame->bDecodeFrameNumber)
     {
         uint32_t frameNumberInputData[4];
         frameNumberInputData[0] = 0; // Output frame number.
@@ -876,6 +1195,12 @@ void UOMSDecoder::Update_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpdate
     }
 #endif
 
+    // Predicted frames only need the copy, their frame number was set on the game thread.
+    if (!WriteFrame->bDecodeFrameNumber)
+    {
+        bNewTextureFrameReady = true;
+    }
+
     TextureDecoderState = ETextureDecoderState::Waiting;
 }
 
@@ -25,69 +25,78 @@ void FOMSStreamableChunk::Serialize(FArchive& Ar, UOMSFile* Owner, int32 ChunkIn
     BulkData.Serialize(Ar, Owner, ChunkIndex, false);
 }
 
-void FOMSStreamableChunk::ReadSequenceSync(oms_header_t* header, oms_sequence_t* sequence)
+// Sequences are decoded into a single block from the engine allocator instead of one malloc per array.
+static void* OMSSequenceArenaAlloc(size_t Size, void* UserData)
 {
-    if (header == nullptr)
+    return FMemory::Malloc(Size, 16);
+}
+
+static void OMSSequenceArenaFree(void* Ptr, void* UserData)
+{
+    FMemory::Free(Ptr);
+}
+
+static oms_allocator_t OMSSequenceArenaAllocator = { OMSSequenceArenaAlloc, OMSSequenceArenaFree, nullptr };
+
+IHoloSuiteIORequest* FOMSStreamableChunk::ReadSequenceAsync(uint8*& outData, IHoloSuiteIOBackend* backend, FHoloSuiteIOCallback callback)
+{
+    outData = nullptr;
+
+    int64 sizebytes = BulkData.GetBulkDataSize();
+    if (sizebytes <= 0)
     {
-        return;
+        return nullptr;
     }
 
-    if (sequence == nullptr)
+    // Allocate a temporary buffer to store the data with extra 4 bytes 
+    // on the end to support OMSFile's that come before on FixMissingTail.
+    outData = (uint8*)FMemory::Malloc(sizebytes + 4);
+
+    IHoloSuiteIOBackend& ioBackend = backend ? *backend : HoloSuiteIO::GetBulkDataBackend();
+    return ioBackend.ReadAsync(BulkData, outData, MoveTemp(callback));
+}
+
+void FOMSStreamableChunk::ReadSequenceSync(oms_header_t* header, oms_sequence_t* sequence, IHoloSuiteIOBackend* backend)
+{
+    if (header == nullptr || sequence == nullptr)
     {
         return;
     }
 
-    CriticalSection.Lock();
-
-    int64 sizebytes = BulkData.GetBulkDataSize();
-    if (sizebytes > 0)
+    uint8* data = nullptr;
+    IHoloSuiteIORequest* request = ReadSequenceAsync(data, backend);
+    if (request != nullptr)
     {
-        // Loaded in Editor.
-        if (BulkData.IsBulkDataLoaded())
+        request->WaitCompletion();
+        if (request->Succeeded())
         {
-            uint8* data = (uint8*)BulkData.Lock(LOCK_READ_ONLY);
-            oms_read_sequence(data, 0, sizebytes, header, sequence);
-            BulkData.Unlock();
+            DecodeSequence(data, header, sequence);
         }
-        // Load on-demand in Runtime.
-        else
-        {
-            FBulkDataIORequestCallBack AsyncFileCallBack =
-                [this, sizebytes, header, sequence](bool bWasCancelled, IBulkDataIORequest* Req)
-            {
-                if (dataBuffer != nullptr)
-                {
-                    uint32_t sequenceSize;
-                    memcpy(&sequenceSize, dataBuffer, sizeof(uint32_t));
+        delete request;
+    }
 
-                    // FixMissingTail
-                    if ((sequenceSize + 4) > sizebytes)
-                    {
-                        UE_LOG(LogHoloSuitePlayer, Warning, TEXT("OMS data is out of date and should be reimported."));
-                    }
+    FMemory::Free(data);
+}
 
-                    oms_read_sequence(dataBuffer, 0, sizebytes, header, sequence);
-                    FMemory::Free(dataBuffer);
-                }
-            };
+bool FOMSStreamableChunk::DecodeSequence(uint8* data, oms_header_t* header, oms_sequence_t* sequence)
+{
+    if (data == nullptr || header == nullptr || sequence == nullptr)
+    {
+        return false;
+    }
 
-            const EAsyncIOPriorityAndFlags AsyncIOPriority = AIOP_CriticalPath;
+    int64 sizebytes = BulkData.GetBulkDataSize();
 
-            // Allocate a temporary buffer to store the data with extra 4 bytes 
-            // on the end to support OMSFile's that come before on FixMissingTail.
-            dataBuffer = (uint8_t*)FMemory::Malloc(sizebytes + 4);
-            IBulkDataIORequest* IORequest = BulkData.CreateStreamingRequest(AsyncIOPriority, &AsyncFileCallBack, dataBuffer);
+    uint32_t sequenceSize;
+    memcpy(&sequenceSize, data, sizeof(uint32_t));
 
-            if (IORequest) 
-            {
-                IORequest->WaitCompletion();
-                // Free AsyncHandle Resources.
-                delete IORequest;
-                IORequest = nullptr;
-            }
-        }
+    // FixMissingTail
+    if ((sequenceSize + 4) > sizebytes)
+    {
+        UE_LOG(LogHoloSuitePlayer, Warning, TEXT("OMS data is out of date and should be reimported."));
     }
-    CriticalSection.Unlock();
+
+    return oms_read_sequence_arena(data, 0, sizebytes, header, sequence, &OMSSequenceArenaAllocator) != (size_t)OMS_READ_ERROR;
 }
 
 void FStreamableOMSData::Serialize(FArchive& Ar, UOMSFile* Owner)
@@ -98,6 +107,11 @@ void FStreamableOMSData::Serialize(FArchive& Ar, UOMSFile* Owner)
     Ar << FrameToSequenceIndex;
     Ar << FrameToSequenceFrameOffset;
 
+    if (Ar.CustomVer(FOMSFileVersion::GUID) >= FOMSFileVersion::FrameBounds)
+    {
+        Ar << FrameBounds;
+    }
+
     BulkData.Serialize(Ar, Owner, INDEX_NONE, false);
 
     if (Ar.IsLoading())
@@ -208,14 +222,27 @@ void UOMSFile::ImportFile(FArchive& Reader)
             {
                 StreamableOMSData.FrameToSequenceIndex.Add(sequenceIndex);
                 StreamableOMSData.FrameToSequenceFrameOffset.Add(frameIndex);
+                StreamableOMSData.FrameBounds.Add(FBox(ForceInit));
             }
         }
         else
         {
+            // Skinning every frame is too slow for playback so it's done once here.
+            oms_compute_frame_aabbs(&sequence);
+
             for (int frameIndex = 0; frameIndex < sequence.ssdr_frame_count; ++frameIndex)
             {
                 StreamableOMSData.FrameToSequenceIndex.Add(sequenceIndex);
                 StreamableOMSData.FrameToSequenceFrameOffset.Add(frameIndex);
+
+                FBox frameBounds(ForceInit);
+                if (sequence.extras.frame_aabbs != nullptr)
+                {
+                    const oms_aabb_t& aabb = sequence.extras.frame_aabbs[frameIndex];
+                    frameBounds = FBox(FVector(aabb.min.x * 100.0f, aabb.min.z * 100.0f, aabb.min.y * 100.0f),
+                        FVector(aabb.max.x * 100.0f, aabb.max.z * 100.0f, aabb.max.y * 100.0f));
+                }
+                StreamableOMSData.FrameBounds.Add(frameBounds);
             }
         }
 
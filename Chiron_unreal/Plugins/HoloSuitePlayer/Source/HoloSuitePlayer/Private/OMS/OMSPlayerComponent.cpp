@@ -43,6 +43,8 @@ UOMSPlayerComponent::UOMSPlayerComponent(const FObjectInitializer& ObjectInitial
     frameTimer                          = 0.0f;
     sourceFrameRate                     = -1.0f;
     currentFrameRate                    = -1.0f;
+    ssdrBlendTimer                      = 0.0f;
+    FrameInterpolation                  = false;
     lastDecodedFrameNumber              = -1;
     lastSkippedFrameNumber              = -1;
     FrameCount                          = -1;
@@ -118,6 +120,11 @@ void UOMSPlayerComponent::PostEditChangeProperty(FPropertyChangedEvent& Property
         SetPlaybackParameters(PlayOnOpen, Loop, Mute, FrameRate);
     }
 
+    if (propertyName == "FrameInterpolation")
+    {
+        SetFrameInterpolation(FrameInterpolation);
+    }
+
     if (propertyName == "ResponsiveAA" || propertyName == "ReceiveDecals")
     {
         if (Decoder)
@@ -252,6 +259,8 @@ void UOMSPlayerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
         // Attempt to update the mesh. If the sequence is not available we'll try again next tick.
         if (TrySetFrame(newFrameNumber))
         {
+            ssdrBlendTimer = 0.0f;
+
             // Skeleton + Retargeting.
             if (SkeletonManager && activeSequence > -1 && activeFrame > -1)
             {
@@ -323,6 +332,8 @@ void UOMSPlayerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
         lastSkippedFrameNumber = -1;
     }
 
+    BlendSSDRFrames(DeltaTime);
+
     frameTimer += DeltaTime;
     if (frameTimer > (1.0f / FrameRate))
     {
@@ -359,6 +370,7 @@ void UOMSPlayerComponent::SyncWithHoloSuitePlayer(AHoloSuitePlayer* HoloSuitePla
     Loop                        = HoloSuitePlayer->Loop;
     Mute                        = HoloSuitePlayer->Mute;
     FrameRate                   = HoloSuitePlayer->FrameRate;
+    FrameInterpolation          = HoloSuitePlayer->FrameInterpolation;
     UseCPUDecoder               = HoloSuitePlayer->UseCPUDecoder;
     MaxBufferedSequences        = HoloSuitePlayer->MaxBufferedSequences;
     ResponsiveAA                = HoloSuitePlayer->ResponsiveAA;
@@ -493,9 +505,11 @@ bool UOMSPlayerComponent::LoadSequence(int index, bool waitForSequence)
 
     // Update bounding box.
     writeMesh->LocalBox = DecodedSequence->holoMesh->LocalBox;
+    writeMesh->bFrameBounds = false;
 
     // Update buffers.
     writeMesh->UpdateFromSource(DecodedSequence->holoMesh);
+    UploadSSDRFrames(writeMesh, DecodedSequence->sequence);
 
     ERHIFeatureLevel::Type FeatureLevel;
     if (GetWorld())
@@ -509,6 +523,7 @@ bool UOMSPlayerComponent::LoadSequence(int index, bool waitForSequence)
     writeMesh->InitOrUpdate(FeatureLevel);
     writeMesh->Update();
     Decoder->UpdateHoloMesh();
+    Decoder->SetCollisionProxy(index, DecodedSequence->collisionHull);
 
     // This should be the only place that sets this variable other than construct/unload.
     activeSequence = index;
@@ -539,17 +554,32 @@ bool UOMSPlayerComponent::LoadSequenceFrame(int index, bool sequenceUpdated)
     {
         holoMesh->SSDRBoneTexture.Create(512);
         holoMesh->SSDRBoneTexture.SetToIdentity();
+        holoMesh->SSDRBoneTexture.Update();
     }
 
-    // Upload SSDR data.
-    if (DecodedSequence->sequence->ssdr_frame_count > 1)
+    // SSDR frames were uploaded with the sequence, only the bound texture changes here.
+    if (DecodedSequence->sequence->ssdr_frame_count > 1 && holoMesh->SSDRFrameTextures.IsValidIndex(activeFrame))
     {
-        holoMesh->SSDRBoneTexture.SetData(0, DecodedSequence->sequence->ssdr_bone_count * 4, DecodedSequence->sequence->ssdr_frames[activeFrame].matrices[0].m);
-        holoMesh->SSDRBoneTexture.Update();
+        holoMesh->SSDRFrame = activeFrame;
     }
     else 
     {
-        holoMesh->SSDRBoneTexture.SetToIdentity();
+        holoMesh->SSDRFrame = -1;
+    }
+    holoMesh->SSDRBlendFrame = -1;
+    holoMesh->SSDRBlend = 0.0f;
+
+    // Tight bounds for the frame, the swap updates them when the sequence changed.
+    FBox frameBounds;
+    if (GetSSDRFrameBounds(activeFrame, frameBounds))
+    {
+        holoMesh->LocalBox = frameBounds;
+        holoMesh->bFrameBounds = true;
+
+        if (!sequenceUpdated)
+        {
+            Decoder->UpdateLocalBounds();
+        }
     }
 
     if (holoMesh->Material != nullptr)
@@ -560,6 +590,103 @@ bool UOMSPlayerComponent::LoadSequenceFrame(int index, bool sequenceUpdated)
     return true;
 }
 
+void UOMSPlayerComponent::UploadSSDRFrames(FHoloMesh* holoMesh, oms_sequence_t* sequence)
+{
+    holoMesh->SSDRFrame = -1;
+    if (sequence->ssdr_frame_count <= 1)
+    {
+        return;
+    }
+
+    // Four texels per bone matrix. Textures stay at the original 512 texel width
+    // and only grow for rigs with more than 128 bones.
+    uint32 width = FMath::Max(512u, FMath::RoundUpToPowerOfTwo(sequence->ssdr_bone_count * 4));
+
+    if (holoMesh->SSDRFrameTextures.Num() < sequence->ssdr_frame_count)
+    {
+        holoMesh->SSDRFrameTextures.SetNum(sequence->ssdr_frame_count);
+    }
+
+    for (int frame = 0; frame < sequence->ssdr_frame_count; ++frame)
+    {
+        FHoloMeshDataTexture& frameTexture = holoMesh->SSDRFrameTextures[frame];
+        if (!frameTexture.IsValid() || frameTexture.SrcWidth != width)
+        {
+            frameTexture.Create(width);
+            frameTexture.SetToIdentity();
+        }
+
+        frameTexture.SetData(0, sequence->ssdr_bone_count * 4, sequence->ssdr_frames[frame].matrices[0].m);
+        frameTexture.Update();
+    }
+}
+
+void UOMSPlayerComponent::BlendSSDRFrames(float DeltaTime)
+{
+    ssdrBlendTimer += DeltaTime;
+
+    if (Decoder == nullptr || !DecodedSequence.IsValid() || DecodedSequence->sequenceIndex != activeSequence)
+    {
+        return;
+    }
+
+    // The geometry is held to the video frame that's shown: it blends in from the previous frame over
+    // the first half of it and out towards the next over the second half, so it's never more than half
+    // a frame away from the texture. The timer restarts whenever a new video frame is shown.
+    FHoloMesh* holoMesh = Decoder->GetHoloMesh(false);
+    int blendFrame = holoMesh->SSDRFrame;
+    float blend = 0.0f;
+    if (FrameInterpolation && bIsPlaying && holoMesh->SSDRFrame > -1)
+    {
+        float position = holoMesh->SSDRFrame + FMath::Clamp(ssdrBlendTimer * FrameRate, 0.0f, 1.0f) - 0.5f;
+        blendFrame = FMath::FloorToInt(position);
+        blend = position - blendFrame;
+
+        if (!holoMesh->SSDRFrameTextures.IsValidIndex(blendFrame) || !holoMesh->SSDRFrameTextures.IsValidIndex(blendFrame + 1))
+        {
+            blendFrame = holoMesh->SSDRFrame;
+            blend = 0.0f;
+        }
+    }
+
+    bool blendFrameChanged = blend > 0.0f && blendFrame != holoMesh->SSDRBlendFrame;
+    bool blendToggled = (blend > 0.0f) != (holoMesh->SSDRBlend > 0.0f);
+    Decoder->SetSSDRBlend(blendFrame, blend);
+
+    // The blended mesh lies somewhere in between both frames.
+    if (blendFrameChanged || blendToggled)
+    {
+        FBox bounds;
+        if (GetSSDRFrameBounds(blend > 0.0f ? blendFrame : holoMesh->SSDRFrame, bounds))
+        {
+            FBox nextBounds;
+            if (blend > 0.0f && GetSSDRFrameBounds(blendFrame + 1, nextBounds))
+            {
+                bounds += nextBounds;
+            }
+
+            holoMesh->LocalBox = bounds;
+            holoMesh->bFrameBounds = true;
+            Decoder->UpdateLocalBounds();
+        }
+    }
+}
+
+bool UOMSPlayerComponent::GetSSDRFrameBounds(int frame, FBox& boundsOut)
+{
+    if (Decoder == nullptr || !DecodedSequence.IsValid() || DecodedSequence->sequence == nullptr)
+    {
+        return false;
+    }
+
+    if (frame < 0 || frame >= DecodedSequence->sequence->ssdr_frame_count)
+    {
+        return false;
+    }
+
+    return Decoder->GetFrameBounds(DecodedSequence->sequenceIndex, frame, boundsOut);
+}
+
 void UOMSPlayerComponent::LoadMediaPlayer()
 {
     SCOPE_CYCLE_COUNTER(STAT_OMSPlayerComponent_LoadMediaPlayer);
@@ -649,6 +776,11 @@ void UOMSPlayerComponent::SetPlaybackParameters(bool NewPlayOnOpen, bool NewLoop
     }
 }
 
+void UOMSPlayerComponent::SetFrameInterpolation(bool NewFrameInterpolation)
+{
+    FrameInterpolation = NewFrameInterpolation;
+}
+
 void UOMSPlayerComponent::SetRenderingParameters(bool NewResponsiveAA, bool NewReceiveDecals)
 {
     ResponsiveAA = NewResponsiveAA;
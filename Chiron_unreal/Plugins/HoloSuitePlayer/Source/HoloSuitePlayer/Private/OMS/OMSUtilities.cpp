@@ -5,8 +5,6 @@
 #include "OMS/OMSPlayerComponent.h"
 #include "RenderGraphUtils.h"
 
-#include <string>
-
 UTexture* OMSUtilities::GetMediaPlayerTexture(UMaterialInterface* sourceMaterial)
 {
     UTexture* result = nullptr;
@@ -36,62 +34,69 @@ UTexture* OMSUtilities::GetMediaPlayerTexture(UMaterialInterface* sourceMaterial
     return result;
 }
 
-int OMSUtilities::DecodeBinaryPixels(unsigned char* pixelBlock)
-{
-    // Binary data is encoded in the image as 3 rows of 8 4x4 bits. Image data is returned
-    // as a single long array, with every 4 elements being (RGBA) for a pixel. This translates
-    // to 128 pixels per row and 16 pixels per bit. Each row is offset by 512 pixels. The loops
-    // below parse that data.
+// Frame numbers are 24 cells of 4x4 pixels, a cell is set when its pixels are white.
+#define OMS_FRAME_NUMBER_BITS 24
+#define OMS_FRAME_NUMBER_CELL_SIZE 4
+#define OMS_FRAME_NUMBER_THRESHOLD 128
 
+int OMSUtilities::DecodeBinaryPixels(const unsigned char* pixelBlock)
+{
     if (!pixelBlock)
     {
         return 0;
     }
 
-    std::string rBinaryString = "";
-
-    for (int i = 0; i < 128; i += 16)
+    // Every cell is 16 bytes of RGBA, the first two pixels of it are tested.
+    uint32 value = 0;
+    for (int bit = 0; bit < OMS_FRAME_NUMBER_BITS; ++bit)
     {
-        if (static_cast<int>(pixelBlock[i]) > 128 && static_cast<int>(pixelBlock[i + 1]) > 128 && static_cast<int>(pixelBlock[i + 2]) > 128 &&
-            static_cast<int>(pixelBlock[i + 4]) > 128 && static_cast<int>(pixelBlock[i + 5]) > 128 && static_cast<int>(pixelBlock[i + 6]) > 128)
-        {
-            rBinaryString += "1";
-        }
-        else
-        {
-            rBinaryString += "0";
-        }
+        const unsigned char* cell = &pixelBlock[bit * OMS_FRAME_NUMBER_CELL_SIZE * 4];
+        uint32 set = (uint32)(cell[0] > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[1] > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[2] > OMS_FRAME_NUMBER_THRESHOLD) &
+                     (uint32)(cell[4] > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[5] > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[6] > OMS_FRAME_NUMBER_THRESHOLD);
+        value = (value << 1) | set;
     }
 
-    std::string gBinaryString = "";
-    for (int i = 128; i < 256; i += 16)
+    return (int)value;
+}
+
+int OMSUtilities::DecodeFrameNumber(const FColor* pixels, int stride, int cellRows, bool bRobust)
+{
+    if (!pixels || stride < OMS_FRAME_NUMBER_BITS * OMS_FRAME_NUMBER_CELL_SIZE || cellRows <= 0)
     {
-        if (static_cast<int>(pixelBlock[i]) > 128 && static_cast<int>(pixelBlock[i + 1]) > 128 && static_cast<int>(pixelBlock[i + 2]) > 128 &&
-            static_cast<int>(pixelBlock[i + 4]) > 128 && static_cast<int>(pixelBlock[i + 5]) > 128 && static_cast<int>(pixelBlock[i + 6]) > 128)
-        {
-            gBinaryString += "1";
-        }
-        else
-        {
-            gBinaryString += "0";
-        }
+        return 0;
     }
 
-    std::string bBinaryString = "";
-    for (int i = 256; i < 256 + 128; i += 16)
+    cellRows = FMath::Min(cellRows, OMS_FRAME_NUMBER_CELL_SIZE);
+
+    uint32 value = 0;
+    for (int bit = 0; bit < OMS_FRAME_NUMBER_BITS; ++bit)
     {
-        if (static_cast<int>(pixelBlock[i]) > 128 && static_cast<int>(pixelBlock[i + 1]) > 128 && static_cast<int>(pixelBlock[i + 2]) > 128 &&
-            static_cast<int>(pixelBlock[i + 4]) > 128 && static_cast<int>(pixelBlock[i + 5]) > 128 && static_cast<int>(pixelBlock[i + 6]) > 128)
+        const FColor* cell = &pixels[bit * OMS_FRAME_NUMBER_CELL_SIZE];
+        uint32 set;
+
+        if (bRobust)
         {
-            bBinaryString += "1";
+            uint32 votes = 0;
+            for (int y = 0; y < cellRows; ++y)
+            {
+                const FColor* row = &cell[y * stride];
+                for (int x = 0; x < OMS_FRAME_NUMBER_CELL_SIZE; ++x)
+                {
+                    votes += (uint32)(row[x].R > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(row[x].G > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(row[x].B > OMS_FRAME_NUMBER_THRESHOLD);
+                }
+            }
+            set = (uint32)(votes * 2 > (uint32)(cellRows * OMS_FRAME_NUMBER_CELL_SIZE));
         }
         else
         {
-            bBinaryString += "0";
+            set = (uint32)(cell[0].R > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[0].G > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[0].B > OMS_FRAME_NUMBER_THRESHOLD) &
+                  (uint32)(cell[1].R > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[1].G > OMS_FRAME_NUMBER_THRESHOLD) & (uint32)(cell[1].B > OMS_FRAME_NUMBER_THRESHOLD);
         }
+
+        value = (value << 1) | set;
     }
 
-    return std::stoi(rBinaryString, 0, 2) * 65536 + std::stoi(gBinaryString, 0, 2) * 256 + std::stoi(bBinaryString, 0, 2);
+    return (int)value;
 }
 
 bool OMSUtilities::IsMobileHDREnabled()
@@ -54,8 +54,8 @@ size_t oms_read_header(uint8_t* buffer, size_t buffer_offset, size_t buffer_size
 
     READ(header_out->version, buffer, position, int, 1);
 
-    // Check if the file version matches the lib version.
-    if (header_out->version != OMS_VERSION)
+    // Check if the file version is one the lib can read.
+    if (header_out->version < OMS_MIN_VERSION || header_out->version > OMS_VERSION)
     {
         return OMS_BAD_VERSION;
     }
@@ -63,6 +63,12 @@ size_t oms_read_header(uint8_t* buffer, size_t buffer_offset, size_t buffer_size
     READ(header_out->sequence_count, buffer, position, int, 1);
     READ(header_out->has_retarget_data, buffer, position, bool, 1);
     READ(header_out->compression_level, buffer, position, uint8_t, 1);
+
+    header_out->retarget_keyframe_compression = false;
+    if (header_out->version >= OMS_RETARGET_KEYFRAME_VERSION)
+    {
+        READ(header_out->retarget_keyframe_compression, buffer, position, bool, 1);
+    }
     READ(header_out->frame_count, buffer, position, uint32_t, 1);
 
     int sequenceTableEntrySize = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint64_t);
@@ -101,9 +107,51 @@ size_t oms_bytes_per_index(int vertex_count)
     }
 }
 
-size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in, oms_sequence_t* sequence_out)
+// Bump allocator over the single block backing an arena read sequence. A NULL arena falls back
+// to one malloc per array, which is what oms_read_sequence uses.
+typedef struct oms_arena_t {
+    uint8_t* data;
+    size_t size;
+    size_t position;
+
+    // Blocks handed out once the arena ran out, each starts with a pointer to the one before it.
+    // The read still needs somewhere to write but the sequence is failed afterwards.
+    void* overflow;
+} oms_arena_t;
+
+#define OMS_ARENA_ALIGNMENT 16
+
+static size_t oms_arena_align(size_t size)
+{
+    return (size + OMS_ARENA_ALIGNMENT - 1) & ~((size_t)OMS_ARENA_ALIGNMENT - 1);
+}
+
+static void* oms_arena_alloc(oms_arena_t* arena, size_t size)
+{
+    if (arena == NULL)
+    {
+        return malloc(size);
+    }
+
+    size_t alignedSize = oms_arena_align(size);
+    if (alignedSize > arena->size - arena->position)
+    {
+        void** block = (void**)malloc(OMS_ARENA_ALIGNMENT + size);
+        *block = arena->overflow;
+        arena->overflow = block;
+        return (uint8_t*)block + OMS_ARENA_ALIGNMENT;
+    }
+
+    void* result = &arena->data[arena->position];
+    arena->position += alignedSize;
+    return result;
+}
+
+static size_t oms_read_sequence_internal(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in, oms_sequence_t* sequence_out, oms_arena_t* arena)
 {
     size_t position = buffer_offset;
+    sequence_out->extras.arena = NULL;
+    sequence_out->extras.frame_aabbs = NULL;
 
     int sequenceSize = 0;
     READ(sequenceSize, buffer_in, position, int, 1);
@@ -168,7 +216,7 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
 
     // Read Vertices
     READ(sequence_out->vertex_count, buffer, position, int, 1);
-    sequence_out->vertices = (oms_vec3_t*)malloc(sizeof(oms_vec3_t) * sequence_out->vertex_count);
+    sequence_out->vertices = (oms_vec3_t*)oms_arena_alloc(arena, sizeof(oms_vec3_t) * sequence_out->vertex_count);
 
     // Vertex Dequantization
     float xMin = 0.0f, xMult = 0.0f, yMin = 0.0f, yMult = 0.0f, zMin = 0.0f, zMult = 0.0f;
@@ -241,7 +289,7 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
 
     // Normals
     READ(sequence_out->normal_count, buffer, position, int, 1);
-    sequence_out->normals = (oms_vec3_t*)malloc(sizeof(oms_vec3_t) * sequence_out->normal_count);
+    sequence_out->normals = (oms_vec3_t*)oms_arena_alloc(arena, sizeof(oms_vec3_t) * sequence_out->normal_count);
     for (int i = 0; i < sequence_out->normal_count; ++i)
     {
         uint16_t compressedNormals[3];
@@ -254,7 +302,7 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
 
     // UVs
     sequence_out->uv_count = sequence_out->vertex_count;
-    sequence_out->uvs = (oms_vec2_t*)malloc(sizeof(oms_vec2_t) * sequence_out->vertex_count);
+    sequence_out->uvs = (oms_vec2_t*)oms_arena_alloc(arena, sizeof(oms_vec2_t) * sequence_out->vertex_count);
     int sizeOfUVs = 0;
     READ(sizeOfUVs, buffer, position, int, 1);
 
@@ -308,7 +356,7 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
     READ(sequence_out->index_count, buffer, position, int, 1);
 
     size_t bpi = oms_bytes_per_index(sequence_out->vertex_count);
-    sequence_out->indices = malloc(bpi * sequence_out->index_count);
+    sequence_out->indices = oms_arena_alloc(arena, bpi * sequence_out->index_count);
     memcpy(sequence_out->indices, &buffer[position], bpi * sequence_out->index_count);
     position += bpi * sequence_out->index_count;
 
@@ -318,9 +366,9 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
 
     if (boneWeightCount > 0)
     {
-        sequence_out->ssdr_bone_indices = (oms_vec4_t*)malloc(sizeof(oms_vec4_t) * boneWeightCount);
-        sequence_out->ssdr_bone_weights = (oms_vec4_t*)malloc(sizeof(oms_vec4_t) * boneWeightCount);
-        sequence_out->extras.ssdr_weights_packed = (int*)malloc(sizeof(int) * boneWeightCount);
+        sequence_out->ssdr_bone_indices = (oms_vec4_t*)oms_arena_alloc(arena, sizeof(oms_vec4_t) * boneWeightCount);
+        sequence_out->ssdr_bone_weights = (oms_vec4_t*)oms_arena_alloc(arena, sizeof(oms_vec4_t) * boneWeightCount);
+        sequence_out->extras.ssdr_weights_packed = (int*)oms_arena_alloc(arena, sizeof(int) * boneWeightCount);
 
         // Unpack the bone data into usable indices and weights
         for (int i = 0; i < boneWeightCount; ++i)
@@ -381,11 +429,11 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
 
     if (sequence_out->ssdr_frame_count > 1)
     {
-        sequence_out->ssdr_frames = (oms_ssdr_frame_t*)malloc(sizeof(oms_ssdr_frame_t) * sequence_out->ssdr_frame_count);
+        sequence_out->ssdr_frames = (oms_ssdr_frame_t*)oms_arena_alloc(arena, sizeof(oms_ssdr_frame_t) * sequence_out->ssdr_frame_count);
 
         for (int i = 0; i < sequence_out->ssdr_frame_count; ++i)
         {
-            sequence_out->ssdr_frames[i].matrices = (oms_matrix4x4_t*)malloc(sizeof(oms_matrix4x4_t) * sequence_out->ssdr_bone_count);
+            sequence_out->ssdr_frames[i].matrices = (oms_matrix4x4_t*)oms_arena_alloc(arena, sizeof(oms_matrix4x4_t) * sequence_out->ssdr_bone_count);
             READ(sequence_out->ssdr_frames[i].matrices[0], buffer, position, oms_matrix4x4_t, sequence_out->ssdr_bone_count);
         }
     }
@@ -398,13 +446,13 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
     if (header_in->compression_level == OMS_COMPRESSION_DELTA)
     {
         READ(sequence_out->delta_frame_count, buffer, position, int, 1);
-        sequence_out->delta_frames = (oms_delta_frame_t*)malloc(sizeof(oms_delta_frame_t) * sequence_out->delta_frame_count);
+        sequence_out->delta_frames = (oms_delta_frame_t*)oms_arena_alloc(arena, sizeof(oms_delta_frame_t) * sequence_out->delta_frame_count);
 
         if (sequence_out->delta_frame_count > 0)
         {
             for (int f = 0; f < sequence_out->delta_frame_count; ++f)
             {
-                sequence_out->delta_frames[f].vertices = (oms_vec3_t*)malloc(sizeof(oms_vec3_t) * sequence_out->vertex_count);
+                sequence_out->delta_frames[f].vertices = (oms_vec3_t*)oms_arena_alloc(arena, sizeof(oms_vec3_t) * sequence_out->vertex_count);
 
                 int sizeOfDeltaVertices = 0;
                 READ(sizeOfDeltaVertices, buffer, position, int, 1);
@@ -485,8 +533,9 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
         float boneWeightMult = 1.0f / ((1 << 11) - 1);
         float smallBoneWeightMult = 0.5f / ((1 << 10) - 1); // For bones with weights in [0, 0.5]
 
-        sequence_out->retarget_data.weights = (oms_vec4_t*)malloc(sizeof(oms_vec4_t) * sequence_out->vertex_count);
-        sequence_out->retarget_data.indices = (oms_vec4_t*)malloc(sizeof(oms_vec4_t) * sequence_out->vertex_count);
+        sequence_out->retarget_data.weights = (oms_vec4_t*)oms_arena_alloc(arena, sizeof(oms_vec4_t) * sequence_out->vertex_count);
+        sequence_out->retarget_data.indices = (oms_vec4_t*)oms_arena_alloc(arena, sizeof(oms_vec4_t) * sequence_out->vertex_count);
+        sequence_out->retarget_data.keyframes = NULL;
 
         for (int i = 0; i < sequence_out->ssdr_frame_count; ++i)
         {
@@ -495,17 +544,22 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
             {
                 READ(sequence_out->retarget_data.bone_count, buffer, position, int, 1);
 
-                sequence_out->retarget_data.bone_names = (char**)malloc(sizeof(char*) * sequence_out->retarget_data.bone_count);
-                sequence_out->retarget_data.bone_parents = (int*)malloc(sizeof(int) * sequence_out->retarget_data.bone_count);
-                sequence_out->retarget_data.bone_positions = (oms_vec3_t**)malloc(sizeof(oms_vec3_t*) * sequence_out->ssdr_frame_count);
-                sequence_out->retarget_data.bone_rotations = (oms_quaternion_t**)malloc(sizeof(oms_quaternion_t*) * sequence_out->ssdr_frame_count);
+                sequence_out->retarget_data.bone_names = (char**)oms_arena_alloc(arena, sizeof(char*) * sequence_out->retarget_data.bone_count);
+                sequence_out->retarget_data.bone_parents = (int*)oms_arena_alloc(arena, sizeof(int) * sequence_out->retarget_data.bone_count);
+                sequence_out->retarget_data.bone_positions = (oms_vec3_t**)oms_arena_alloc(arena, sizeof(oms_vec3_t*) * sequence_out->ssdr_frame_count);
+                sequence_out->retarget_data.bone_rotations = (oms_quaternion_t**)oms_arena_alloc(arena, sizeof(oms_quaternion_t*) * sequence_out->ssdr_frame_count);
+
+                if (header_in->retarget_keyframe_compression)
+                {
+                    sequence_out->retarget_data.keyframes = (uint8_t**)oms_arena_alloc(arena, sizeof(uint8_t*) * sequence_out->ssdr_frame_count);
+                }
 
                 for (int n = 0; n < sequence_out->retarget_data.bone_count; ++n)
                 {
                     int stringSize = 0;
                     READ(stringSize, buffer, position, int, 1);
 
-                    sequence_out->retarget_data.bone_names[n] = (char*)malloc(stringSize + 1);
+                    sequence_out->retarget_data.bone_names[n] = (char*)oms_arena_alloc(arena, stringSize + 1);
                     READ(sequence_out->retarget_data.bone_names[n][0], buffer, position, char, stringSize);
                     sequence_out->retarget_data.bone_names[n][stringSize] = '\0';
 
@@ -514,29 +568,38 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
             }
 
             // Local position and rotation for each bone.
-            sequence_out->retarget_data.bone_positions[i] = (oms_vec3_t*)malloc(sizeof(oms_vec3_t) * sequence_out->retarget_data.bone_count);
-            sequence_out->retarget_data.bone_rotations[i] = (oms_quaternion_t*)malloc(sizeof(oms_quaternion_t) * sequence_out->retarget_data.bone_count);
+            sequence_out->retarget_data.bone_positions[i] = (oms_vec3_t*)oms_arena_alloc(arena, sizeof(oms_vec3_t) * sequence_out->retarget_data.bone_count);
+            sequence_out->retarget_data.bone_rotations[i] = (oms_quaternion_t*)oms_arena_alloc(arena, sizeof(oms_quaternion_t) * sequence_out->retarget_data.bone_count);
+            if (header_in->retarget_keyframe_compression)
+            {
+                sequence_out->retarget_data.keyframes[i] = (uint8_t*)oms_arena_alloc(arena, sizeof(uint8_t) * sequence_out->retarget_data.bone_count);
+            }
+
             for (int n = 0; n < sequence_out->retarget_data.bone_count; ++n)
             {
                 bool posKeyFrame = true;
                 bool rotKeyFrame = true;
 
-                bool anim_keyframe_compression = false;
-                if (anim_keyframe_compression)
+                if (header_in->retarget_keyframe_compression)
                 {
-                    uint8_t keyframe = sequence_out->retarget_data.keyframes[i][n];
+                    uint8_t keyframe = 0;
+                    READ(keyframe, buffer, position, uint8_t, 1);
+                    sequence_out->retarget_data.keyframes[i][n] = keyframe;
+
                     posKeyFrame = (keyframe & kOMSKeyframePositionMask);
                     rotKeyFrame = (keyframe & kOMSKeyframeRotationMask);
                 }
-                else
-                {
-                    sequence_out->retarget_data.keyframes = NULL;
-                }
 
+                // Channels without a key hold the previous frame's value. Frames are expanded here
+                // so looking up a bone during playback stays a plain array access.
                 if (posKeyFrame)
                 {
                     READ(sequence_out->retarget_data.bone_positions[i][n], buffer, position, oms_vec3_t, 1);
                 }
+                else if (i > 0)
+                {
+                    sequence_out->retarget_data.bone_positions[i][n] = sequence_out->retarget_data.bone_positions[i - 1][n];
+                }
                 else
                 {
                     sequence_out->retarget_data.bone_positions[i][n].x = 0.0f;
@@ -548,11 +611,16 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
                 {
                     READ(sequence_out->retarget_data.bone_rotations[i][n], buffer, position, oms_quaternion_t, 1);
                 }
+                else if (i > 0)
+                {
+                    sequence_out->retarget_data.bone_rotations[i][n] = sequence_out->retarget_data.bone_rotations[i - 1][n];
+                }
                 else
                 {
                     sequence_out->retarget_data.bone_rotations[i][n].x = 0.0f;
                     sequence_out->retarget_data.bone_rotations[i][n].y = 0.0f;
                     sequence_out->retarget_data.bone_rotations[i][n].z = 0.0f;
+                    sequence_out->retarget_data.bone_rotations[i][n].w = 1.0f;
                 }
             }
         }
@@ -621,6 +689,77 @@ size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer
     return sequenceSize + 4;
 }
 
+size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in, oms_sequence_t* sequence_out)
+{
+    return oms_read_sequence_internal(buffer_in, buffer_offset, buffer_size, header_in, sequence_out, NULL);
+}
+
+size_t oms_read_sequence_arena(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in, oms_sequence_t* sequence_out, oms_allocator_t* allocator)
+{
+    size_t arenaSize = oms_get_sequence_arena_size(buffer_in, buffer_offset, buffer_size, header_in);
+    if (arenaSize == (size_t)OMS_READ_ERROR)
+    {
+        return OMS_READ_ERROR;
+    }
+
+    // Compressed sequences can't be sized before they're inflated.
+    if (arenaSize == 0)
+    {
+        return oms_read_sequence_internal(buffer_in, buffer_offset, buffer_size, header_in, sequence_out, NULL);
+    }
+
+    oms_arena_t arena;
+    arena.data = (uint8_t*)(allocator != NULL ? allocator->alloc_func(arenaSize, allocator->user_data) : malloc(arenaSize));
+    arena.size = arenaSize;
+    arena.position = 0;
+    arena.overflow = NULL;
+
+    if (arena.data == NULL)
+    {
+        return OMS_READ_ERROR;
+    }
+
+    size_t result = oms_read_sequence_internal(buffer_in, buffer_offset, buffer_size, header_in, sequence_out, &arena);
+
+    // The sequence didn't match the size it was measured at, nothing it points to can be trusted.
+    if (arena.overflow != NULL)
+    {
+        while (arena.overflow != NULL)
+        {
+            void* previous = *(void**)arena.overflow;
+            free(arena.overflow);
+            arena.overflow = previous;
+        }
+
+        if (allocator != NULL && allocator->free_func != NULL)
+        {
+            allocator->free_func(arena.data, allocator->user_data);
+        }
+        else
+        {
+            free(arena.data);
+        }
+
+        memset(sequence_out, 0, sizeof(oms_sequence_t));
+        return OMS_READ_ERROR;
+    }
+
+    sequence_out->extras.arena = arena.data;
+    sequence_out->extras.arena_size = arena.size;
+    if (allocator != NULL)
+    {
+        sequence_out->extras.arena_allocator = *allocator;
+    }
+    else
+    {
+        sequence_out->extras.arena_allocator.alloc_func = NULL;
+        sequence_out->extras.arena_allocator.free_func = NULL;
+        sequence_out->extras.arena_allocator.user_data = NULL;
+    }
+
+    return result;
+}
+
 void oms_copy_keyframe(oms_sequence_t* src_seq, oms_sequence_t* dst_seq, bool discard_normals)
 {
     dst_seq->aabb = src_seq->aabb;
@@ -890,21 +1029,26 @@ size_t oms_get_header_write_size(oms_header_t* header_in)
     // Sequence Count:    int, 4 bytes
     // Retarget Data:     bool, 1 byte
     // Compression Level: unsigned byte, 1 byte.
+    // Retarget Keyframe: bool, 1 byte (version 11+)
     // Frame count:       uint32_t, 4 bytes
     // Sequence Table:    28 * (Sequence Count)
 
-    return 14 + (28 * header_in->sequence_count);
+    size_t fixedSize = (header_in->version >= OMS_RETARGET_KEYFRAME_VERSION) ? 15 : 14;
+    return fixedSize + (28 * header_in->sequence_count);
 }
 
 size_t oms_get_header_read_size(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size)
 {
-    // Skip past version.
-    size_t position = buffer_offset + 4;
+    size_t position = buffer_offset;
+
+    int version;
+    READ(version, buffer_in, position, int, 1);
 
     int sequenceCount;
     READ(sequenceCount, buffer_in, position, int, 1);
 
-    return 14 + (28 * sequenceCount);
+    size_t fixedSize = (version >= OMS_RETARGET_KEYFRAME_VERSION) ? 15 : 14;
+    return fixedSize + (28 * sequenceCount);
 }
 
 oms_vec3_t get_quantizer_multiplier(oms_header_t* header_in, oms_sequence_t* sequence_in)
@@ -973,6 +1117,165 @@ size_t oms_get_sequence_read_size(uint8_t* buffer_in, size_t buffer_offset, size
     return sequence_size + 4;
 }
 
+// Bounds checked reads for oms_get_sequence_arena_size, a count past the end of the buffer or
+// a negative one fails the sequence.
+static bool oms_arena_read_count(uint8_t* buffer_in, size_t* position, size_t end, int* count_out)
+{
+    if (*position > end || end - *position < sizeof(int))
+    {
+        return false;
+    }
+
+    memcpy(count_out, &buffer_in[*position], sizeof(int));
+    *position += sizeof(int);
+    return *count_out >= 0;
+}
+
+static bool oms_arena_skip(size_t* position, size_t end, size_t count, size_t element_size)
+{
+    if (*position > end || (element_size > 0 && count > (end - *position) / element_size))
+    {
+        return false;
+    }
+
+    *position += count * element_size;
+    return true;
+}
+
+#define OMS_ARENA_READ_COUNT(DST) if (!oms_arena_read_count(buffer_in, &position, end, &DST)) { return OMS_READ_ERROR; }
+#define OMS_ARENA_SKIP(COUNT, ELEMENT_SIZE) if (!oms_arena_skip(&position, end, (size_t)(COUNT), (ELEMENT_SIZE))) { return OMS_READ_ERROR; }
+
+size_t oms_get_sequence_arena_size(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in)
+{
+    if (header_in->compression_level == OMS_COMPRESSION_GZIP || header_in->compression_level == OMS_COMPRESSION_ZSTD)
+    {
+        return 0;
+    }
+
+    // Mirrors the allocations made in oms_read_sequence_internal, skipping over the encoded data.
+    // The buffer isn't trusted yet, every read and skip is checked against its end.
+    size_t position = buffer_offset;
+    size_t end = buffer_offset + buffer_size;
+    size_t result = 0;
+
+    // Sequence Size and AABB
+    OMS_ARENA_SKIP(1, sizeof(int) + sizeof(oms_aabb_t));
+
+    // Vertices
+    int vertexCount = 0;
+    OMS_ARENA_READ_COUNT(vertexCount);
+    OMS_ARENA_SKIP(6, sizeof(float));
+
+    int sizeOfVertices = 0;
+    OMS_ARENA_READ_COUNT(sizeOfVertices);
+    OMS_ARENA_SKIP(sizeOfVertices, 1);
+    result += oms_arena_align(sizeof(oms_vec3_t) * vertexCount);
+
+    // Normals
+    int normalCount = 0;
+    OMS_ARENA_READ_COUNT(normalCount);
+    OMS_ARENA_SKIP(normalCount, sizeof(uint16_t) * 3);
+    result += oms_arena_align(sizeof(oms_vec3_t) * normalCount);
+
+    // UVs
+    int sizeOfUVs = 0;
+    OMS_ARENA_READ_COUNT(sizeOfUVs);
+    OMS_ARENA_SKIP(sizeOfUVs, 1);
+    result += oms_arena_align(sizeof(oms_vec2_t) * vertexCount);
+
+    // Indices
+    int indexCount = 0;
+    OMS_ARENA_READ_COUNT(indexCount);
+    OMS_ARENA_SKIP(indexCount, oms_bytes_per_index(vertexCount));
+    size_t indexSize = oms_bytes_per_index(vertexCount) * indexCount;
+    result += oms_arena_align(indexSize);
+
+    // SSDR Bone Weights and Indices
+    int boneWeightCount = 0;
+    OMS_ARENA_READ_COUNT(boneWeightCount);
+    if (boneWeightCount > 0)
+    {
+        OMS_ARENA_SKIP(boneWeightCount, sizeof(uint8_t) * 4 + sizeof(int));
+        result += oms_arena_align(sizeof(oms_vec4_t) * boneWeightCount) * 2;
+        result += oms_arena_align(sizeof(int) * boneWeightCount);
+    }
+
+    // SSDR Frame Data
+    int ssdrFrameCount = 0;
+    int ssdrBoneCount = 0;
+    OMS_ARENA_READ_COUNT(ssdrFrameCount);
+    OMS_ARENA_READ_COUNT(ssdrBoneCount);
+    if (ssdrFrameCount > 1)
+    {
+        size_t matrixSize = sizeof(oms_matrix4x4_t) * ssdrBoneCount;
+        OMS_ARENA_SKIP(ssdrFrameCount, matrixSize);
+        result += oms_arena_align(sizeof(oms_ssdr_frame_t) * ssdrFrameCount);
+        result += oms_arena_align(matrixSize) * ssdrFrameCount;
+    }
+
+    // Delta Compression Data
+    if (header_in->compression_level == OMS_COMPRESSION_DELTA)
+    {
+        int deltaFrameCount = 0;
+        OMS_ARENA_READ_COUNT(deltaFrameCount);
+        result += oms_arena_align(sizeof(oms_delta_frame_t) * deltaFrameCount);
+
+        for (int f = 0; f < deltaFrameCount; ++f)
+        {
+            int sizeOfDeltaVertices = 0;
+            OMS_ARENA_READ_COUNT(sizeOfDeltaVertices);
+            OMS_ARENA_SKIP(sizeOfDeltaVertices, 1);
+            result += oms_arena_align(sizeof(oms_vec3_t) * vertexCount);
+        }
+    }
+
+    // Retargetting Data, always last so the per frame bone data doesn't need to be skipped.
+    if (header_in->has_retarget_data)
+    {
+        result += oms_arena_align(sizeof(oms_vec4_t) * vertexCount) * 2;
+
+        if (ssdrFrameCount > 0)
+        {
+            int boneCount = 0;
+            OMS_ARENA_READ_COUNT(boneCount);
+            result += oms_arena_align(sizeof(char*) * boneCount);
+            result += oms_arena_align(sizeof(int) * boneCount);
+            result += oms_arena_align(sizeof(oms_vec3_t*) * ssdrFrameCount);
+            result += oms_arena_align(sizeof(oms_quaternion_t*) * ssdrFrameCount);
+            if (header_in->retarget_keyframe_compression)
+            {
+                result += oms_arena_align(sizeof(uint8_t*) * ssdrFrameCount);
+                result += oms_arena_align(sizeof(uint8_t) * boneCount) * ssdrFrameCount;
+            }
+
+            for (int n = 0; n < boneCount; ++n)
+            {
+                int stringSize = 0;
+                OMS_ARENA_READ_COUNT(stringSize);
+                OMS_ARENA_SKIP(stringSize, 1);
+                OMS_ARENA_SKIP(1, sizeof(int));
+                result += oms_arena_align(stringSize + 1);
+            }
+
+            result += (oms_arena_align(sizeof(oms_vec3_t) * boneCount) + oms_arena_align(sizeof(oms_quaternion_t) * boneCount)) * ssdrFrameCount;
+        }
+    }
+
+    return result;
+}
+
+// Keyframe flags written for a retarget bone. The first frame of a sequence is always keyed so
+// sequences decode independently, sequences without keyframe data key every frame.
+static uint8_t oms_get_retarget_keyframe(oms_sequence_t* sequence_in, int frame, int bone)
+{
+    if (frame == 0 || sequence_in->retarget_data.keyframes == NULL)
+    {
+        return kOMSKeyframePositionMask | kOMSKeyframeRotationMask;
+    }
+
+    return sequence_in->retarget_data.keyframes[frame][bone];
+}
+
 size_t oms_get_sequence_write_size(oms_header_t* header_in, oms_sequence_t* sequence_in)
 {
     size_t result = 0;
@@ -1142,10 +1445,9 @@ size_t oms_get_sequence_write_size(oms_header_t* header_in, oms_sequence_t* sequ
                 bool posKeyFrame = true;
                 bool rotKeyFrame = true;
 
-                bool anim_keyframe_compression = false;
-                if (false)
+                if (header_in->retarget_keyframe_compression)
                 {
-                    uint8_t keyframe = sequence_in->retarget_data.keyframes[i][j];
+                    uint8_t keyframe = oms_get_retarget_keyframe(sequence_in, i, j);
                     posKeyFrame = (keyframe & kOMSKeyframePositionMask);
                     rotKeyFrame = (keyframe & kOMSKeyframeRotationMask);
 
@@ -1183,6 +1485,10 @@ size_t oms_write_header(uint8_t* buffer, size_t buffer_offset, size_t buffer_siz
     WRITE(buffer, buffer_size, position, header_in->sequence_count, int, 1);
     WRITE(buffer, buffer_size, position, header_in->has_retarget_data, bool, 1);
     WRITE(buffer, buffer_size, position, header_in->compression_level, uint8_t, 1);
+    if (header_in->version >= OMS_RETARGET_KEYFRAME_VERSION)
+    {
+        WRITE(buffer, buffer_size, position, header_in->retarget_keyframe_compression, bool, 1);
+    }
     WRITE(buffer, buffer_size, position, header_in->frame_count, uint32_t, 1);
 
     for (int i = 0; i < header_in->sequence_count; i++)
@@ -1480,10 +1786,10 @@ size_t oms_write_sequence(uint8_t* buffer_out, size_t buffer_offset, size_t buff
                 bool posKeyFrame = true;
                 bool rotKeyFrame = true;
 
-                if (options != NULL && options->anim_keyframe_compression)
+                if (header_in->retarget_keyframe_compression)
                 {
-                    uint8_t keyframe = sequence_in->retarget_data.keyframes[i][j];
-                    WRITE(buffer, buffer_size, position, keyframe, uint8_t, 1);
+                    uint8_t keyframe = oms_get_retarget_keyframe(sequence_in, i, j);
+                    WRITE(buffer, buffer_sequence_size, position, keyframe, uint8_t, 1);
 
                     posKeyFrame = (keyframe & kOMSKeyframePositionMask);
                     rotKeyFrame = (keyframe & kOMSKeyframeRotationMask);
@@ -1665,6 +1971,9 @@ oms_sequence_t* oms_alloc_sequence(int vertex_count,
     sequence->ssdr_frame_count = frame_count;
     sequence->ssdr_bone_count = ssdr_bone_count;
     sequence->extras.ssdr_weights_packed = NULL;
+    sequence->extras.arena = NULL;
+    sequence->extras.arena_size = 0;
+    sequence->extras.frame_aabbs = NULL;
     if (frame_count > 1)
     {
         sequence->ssdr_bone_indices = (oms_vec4_t*)malloc(sizeof(oms_vec4_t) * vertex_count);
@@ -1691,6 +2000,29 @@ oms_sequence_t* oms_alloc_sequence(int vertex_count,
 
 void oms_free_sequence(oms_sequence_t* sequence)
 {
+    if (sequence->extras.frame_aabbs != NULL)
+    {
+        free(sequence->extras.frame_aabbs);
+        sequence->extras.frame_aabbs = NULL;
+    }
+
+    // Every array lives in the arena, release it in one go.
+    if (sequence->extras.arena != NULL)
+    {
+        if (sequence->extras.arena_allocator.free_func != NULL)
+        {
+            sequence->extras.arena_allocator.free_func(sequence->extras.arena, sequence->extras.arena_allocator.user_data);
+        }
+        else
+        {
+            free(sequence->extras.arena);
+        }
+
+        sequence->extras.arena = NULL;
+        sequence->extras.arena_size = 0;
+        return;
+    }
+
     if (sequence->vertex_count > 0)
     {
         free(sequence->vertices);
@@ -1829,6 +2161,48 @@ void oms_set_retarget_bone_name(oms_sequence_t* sequence, int bone, char* name)
     memcpy(sequence->retarget_data.bone_names[bone], name, len);
 }
 
+void oms_compute_retarget_keyframes(oms_sequence_t* sequence, float position_tolerance, float rotation_tolerance)
+{
+    oms_retarget_data_t* retarget = &sequence->retarget_data;
+    if (retarget->bone_count <= 0 || retarget->keyframes == NULL)
+    {
+        return;
+    }
+
+    for (int n = 0; n < retarget->bone_count; ++n)
+    {
+        // Compare against the last keyed value rather than the previous frame so error can't accumulate.
+        int lastPosKey = 0;
+        int lastRotKey = 0;
+
+        for (int f = 0; f < sequence->ssdr_frame_count; ++f)
+        {
+            uint8_t keyframe = 0;
+
+            oms_vec3_t* pos = &retarget->bone_positions[f][n];
+            oms_vec3_t* keyPos = &retarget->bone_positions[lastPosKey][n];
+            float posError = fmaxf(fabsf(pos->x - keyPos->x), fmaxf(fabsf(pos->y - keyPos->y), fabsf(pos->z - keyPos->z)));
+            if (f == 0 || posError > position_tolerance)
+            {
+                keyframe |= kOMSKeyframePositionMask;
+                lastPosKey = f;
+            }
+
+            // q and -q are the same rotation.
+            oms_quaternion_t* rot = &retarget->bone_rotations[f][n];
+            oms_quaternion_t* keyRot = &retarget->bone_rotations[lastRotKey][n];
+            float dot = rot->x * keyRot->x + rot->y * keyRot->y + rot->z * keyRot->z + rot->w * keyRot->w;
+            if (f == 0 || (1.0f - fabsf(dot)) > rotation_tolerance)
+            {
+                keyframe |= kOMSKeyframeRotationMask;
+                lastRotKey = f;
+            }
+
+            retarget->keyframes[f][n] = keyframe;
+        }
+    }
+}
+
 void oms_sequence_compute_aabb(oms_sequence_t* sequence)
 {
     oms_aabb_t* result = &sequence->aabb;
@@ -1854,6 +2228,75 @@ void oms_sequence_compute_aabb(oms_sequence_t* sequence)
     }
 }
 
+void oms_compute_frame_aabbs(oms_sequence_t* sequence)
+{
+    if (sequence->ssdr_frame_count <= 1 || sequence->ssdr_bone_count <= 0 || sequence->ssdr_frames == NULL)
+    {
+        return;
+    }
+
+    if (sequence->extras.frame_aabbs == NULL)
+    {
+        sequence->extras.frame_aabbs = (oms_aabb_t*)malloc(sizeof(oms_aabb_t) * sequence->ssdr_frame_count);
+    }
+
+    uint8_t num_bones_per_vertex = 4;
+    float* bone_indices = (float*)sequence->ssdr_bone_indices;
+    float* bone_weights = (float*)sequence->ssdr_bone_weights;
+
+    for (int f = 0; f < sequence->ssdr_frame_count; ++f)
+    {
+        oms_aabb_t* result = &sequence->extras.frame_aabbs[f];
+        result->min.x = FLT_MAX;
+        result->min.y = FLT_MAX;
+        result->min.z = FLT_MAX;
+
+        result->max.x = -FLT_MAX;
+        result->max.y = -FLT_MAX;
+        result->max.z = -FLT_MAX;
+
+        oms_matrix4x4_t* matrices = sequence->ssdr_frames[f].matrices;
+        for (int i = 0; i < sequence->vertex_count; i++)
+        {
+            oms_vec4_t new_position;
+            new_position.x = 0.0;
+            new_position.y = 0.0;
+            new_position.z = 0.0;
+            new_position.w = 0.0;
+
+            // Same blend as oms_apply_skinning.
+            for (int j = 0; j < num_bones_per_vertex; j++)
+            {
+                float weight = bone_weights[i * num_bones_per_vertex + j];
+                if (weight == 0.0f)
+                {
+                    continue;
+                }
+
+                int bone_index = bone_indices[i * num_bones_per_vertex + j];
+                if (bone_index < 0 || bone_index >= sequence->ssdr_bone_count)
+                {
+                    continue;
+                }
+
+                oms_vec4_t vertex_transformation;
+                oms_matrix4x4_t_oms_vec3_t_mult(&matrices[bone_index], &sequence->vertices[i], &vertex_transformation, 1.0);
+                vertex_transformation = oms_vec4_t_scalar_mult(&vertex_transformation, weight);
+
+                new_position = oms_vec4_t_add(&new_position, &vertex_transformation);
+            }
+
+            result->min.x = new_position.x < result->min.x ? new_position.x : result->min.x;
+            result->min.y = new_position.y < result->min.y ? new_position.y : result->min.y;
+            result->min.z = new_position.z < result->min.z ? new_position.z : result->min.z;
+
+            result->max.x = new_position.x > result->max.x ? new_position.x : result->max.x;
+            result->max.y = new_position.y > result->max.y ? new_position.y : result->max.y;
+            result->max.z = new_position.z > result->max.z ? new_position.z : result->max.z;
+        }
+    }
+}
+
 void rot_matrix_to_quaternion(oms_matrix4x4_t* mat, oms_quaternion_t* result)
 {
     float t = mat->m[0] + mat->m[5] + mat->m[10];
@@ -19,14 +19,56 @@ struct FAVVSequenceData : PropertyTemplate::FSectionData
 	FGuid SpawnableGUID;
 };
 
+// Number of frames warmed from the section's start frame during preroll.
+static const int AVVPreRollPrefetchFrames = 3;
+
+// Frames either side of the evaluated frame requested while scrubbing.
+static const int AVVScrubPrefetchRadius = 2;
+
+// Update player to current spawned instance if using Spawnable AVV
+static void ResolveSpawnedPlayer(FAVVSequenceData& SectionData, const FMovieSceneEvaluationOperand& Operand, IMovieScenePlayer& Player)
+{
+	if (SectionData.SpawnableGUID.IsValid())
+	{
+		UObject* SpawnedObject = Player.GetSpawnRegister().FindSpawnedObject(SectionData.SpawnableGUID, Operand.SequenceID).Get();
+		SectionData.Player = Cast<AHoloSuitePlayer>(SpawnedObject);
+	}
+}
+
 struct FAVVPreRollExecutionToken : IMovieSceneExecutionToken
 {
 	float SequenceTime;
-	FAVVPreRollExecutionToken(float InSequenceTime) : SequenceTime(InSequenceTime) {}
+	double DisplayRate;
+	int StartFrameOffset;
+
+	FAVVPreRollExecutionToken(float InSequenceTime, double InDisplayRate, int InStartFrameOffset)
+		: SequenceTime(InSequenceTime), DisplayRate(InDisplayRate), StartFrameOffset(InStartFrameOffset)
+	{}
 
 	virtual void Execute(const FMovieSceneContext& Context, const FMovieSceneEvaluationOperand& Operand, FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
 	{
-		//
+		FAVVSequenceData& SectionData = PersistentData.GetSectionData<FAVVSequenceData>();
+		ResolveSpawnedPlayer(SectionData, Operand, Player);
+
+		if (!SectionData.Player)
+		{
+			return;
+		}
+
+		UAVVPlayerComponent* AVVPlayerComponent = SectionData.Player->GetAVVPlayerComponent();
+		if (AVVPlayerComponent == nullptr)
+		{
+			return;
+		}
+
+		// Warm the decoder with the frames the section will start on so the first
+		// evaluated frame doesn't have to wait on segment and frame reads.
+		UAVVDecoder* AVVDecoder = AVVPlayerComponent->GetDecoder();
+		if (AVVDecoder)
+		{
+			int32 FrameNumber = StartFrameOffset + FMath::RoundToInt(SequenceTime * DisplayRate);
+			AVVDecoder->Prefetch(FrameNumber, AVVPreRollPrefetchFrames, AVVPlayerComponent->Loop);
+		}
 	}
 };
 
@@ -35,9 +77,10 @@ struct FAVVExecutionToken : IMovieSceneExecutionToken
 	float SectionTime;
 	double DisplayRate;
 	int StartFrameOffset;
+	bool bScrubbing;
 
-	FAVVExecutionToken(float InSectionTime, double InDisplayRate, int InStartFrameOffset) 
-		: SectionTime(InSectionTime), DisplayRate(InDisplayRate), StartFrameOffset(InStartFrameOffset) 
+	FAVVExecutionToken(float InSectionTime, double InDisplayRate, int InStartFrameOffset, bool bInScrubbing) 
+		: SectionTime(InSectionTime), DisplayRate(InDisplayRate), StartFrameOffset(InStartFrameOffset), bScrubbing(bInScrubbing)
 	{}
 
 	~FAVVExecutionToken()
@@ -46,13 +89,7 @@ struct FAVVExecutionToken : IMovieSceneExecutionToken
 	virtual void Execute(const FMovieSceneContext& Context, const FMovieSceneEvaluationOperand& Operand, FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
 	{
 		FAVVSequenceData& SectionData = PersistentData.GetSectionData<FAVVSequenceData>();
-
-		// Update player to current spawned instance if using Spawnable AVV
-		if (SectionData.SpawnableGUID.IsValid())
-		{
-			UObject* SpawnedObject = Player.GetSpawnRegister().FindSpawnedObject(SectionData.SpawnableGUID, Operand.SequenceID).Get();
-			SectionData.Player = Cast<AHoloSuitePlayer>(SpawnedObject);
-		}
+		ResolveSpawnedPlayer(SectionData, Operand, Player);
 
 		if (SectionData.Player)
 		{
@@ -72,6 +109,13 @@ struct FAVVExecutionToken : IMovieSceneExecutionToken
 				{
 					FrameNumber = FrameNumber % FrameCount;
 				}
+
+				// Scrubbing can move in either direction so request the frames around
+				// the evaluated frame rather than only the ones ahead of it.
+				if (bScrubbing)
+				{
+					AVVDecoder->Prefetch(FrameNumber - AVVScrubPrefetchRadius, AVVScrubPrefetchRadius * 2 + 1, AVVPlayerComponent->Loop);
+				}
 			}
 
 			SectionData.Player->CurrentFrame = FrameNumber;
@@ -131,7 +175,9 @@ void FAVVSectionTemplate::Evaluate(const FMovieSceneEvaluationOperand& Operand,
 		const float SegmentTime =
 			Context.HasPreRollEndTime() ? FFrameTime::FromDecimal((FFrameTime(Context.GetPreRollEndFrame()) - FFrameTime(Params.SectionStartTime)).AsDecimal()) / Context.GetFrameRate() : 0.f;
 
-		ExecutionTokens.Add(FAVVPreRollExecutionToken(SegmentTime));
+		const double DisplayRate = Params.MovieScene->GetDisplayRate().AsDecimal();
+
+		ExecutionTokens.Add(FAVVPreRollExecutionToken(SegmentTime, DisplayRate, Params.StartFrameOffset));
 	}
 	else
 	{
@@ -139,6 +185,8 @@ void FAVVSectionTemplate::Evaluate(const FMovieSceneEvaluationOperand& Operand,
 
 		const double DisplayRate = Params.MovieScene->GetDisplayRate().AsDecimal();
 
-		ExecutionTokens.Add(FAVVExecutionToken(SegmentTime, DisplayRate, Params.StartFrameOffset));
+		const bool bScrubbing = Context.GetStatus() == EMovieScenePlayerStatus::Scrubbing;
+
+		ExecutionTokens.Add(FAVVExecutionToken(SegmentTime, DisplayRate, Params.StartFrameOffset, bScrubbing));
 	}
 }
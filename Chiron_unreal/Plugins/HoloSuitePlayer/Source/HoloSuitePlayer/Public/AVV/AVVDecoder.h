@@ -40,16 +40,30 @@ public:
     void Configure(bool immediateMode);
     void SetCachingDirection(bool reversedCaching) { bReversedCaching = reversedCaching; }
 
+    // Keeps the whole file in memory instead of streaming it, applies to the next OpenAVV.
+    void SetResidentPlayback(bool residentPlayback) { bResidentPlayback = residentPlayback; }
+
     virtual bool OpenAVV(UAVVFile* AVVFile, UMaterialInterface* NewMeshMaterial);
     virtual void Close();
 
     // When force is set to true frame will update even if it's currently on the requested frame.
     virtual void SetFrame(int frameIndex, bool force = false);
+
+    // Presents a fractional frame by blending positions from the frame before it to the one after
+    // it, only the latter is decoded. Falls back to SetFrame of the frame before it unless sub frame
+    // presentation is enabled and positions can be interpolated.
+    void SetSubFrame(float frame);
+    void SetSubFramePresentation(bool subFramePresentation) { bSubFramePresentation = subFramePresentation; }
     virtual void Update(float DeltaTime);
 
+    // Issues segment and frame reads for frameCount frames starting at frameNumber without
+    // changing the displayed frame. The data is held in the cache until playback reaches it.
+    // Frames past either end wrap around when looping and are dropped otherwise.
+    void Prefetch(int frameNumber, int frameCount = 1, bool loop = false);
+
     // Called by HoloMeshManager when a work request is executed. Executes
     // on a worker thread, not game or render thread.
-    virtual void DoThreadedWork(int sequenceIndex, int frameIndex) override;
+    virtual void DoThreadedWork(int sequenceIndex, int frameIndex, EHoloMeshWorkType workType) override;
 
     // Pull read data from AVVReader and push into data cache.
     void UpdateDataCache();
@@ -58,6 +72,8 @@ public:
     // Called by the manager to flush out any excess memory usage.
     virtual void FreeUnusedMemory() override;
 
+    virtual void FreeDecodedFrameCache() override;
+
     virtual UMaterialInterface* GetMaterial(int32 ElementIndex) const override;
 
     // Will update mesh material and recreate render proxy.
@@ -66,18 +82,55 @@ public:
     // Checks if source AVV file contains skeleton data.
     bool HasSkeletonData();
 
+    // Configures which optional streams are read and decoded at a given LOD.
+    void SetLODDecodeFlags(int LOD, EAVVDecodeFlags DecodeFlags);
+
+    // Decode flags for the finest LOD this decoder or any of its instances is drawn at.
+    EAVVDecodeFlags GetDecodeFlags();
+
+    // Decodes only every Divisor-th frame of a segment at a given LOD, the frames in between are
+    // presented by interpolating positions from the two decoded around them. Delta coded luma
+    // misses the skipped frames' blocks, so it's best kept to LODs that don't decode textures.
+    void SetLODUpdateDivisor(int LOD, int Divisor);
+
+    // Update divisor for the finest LOD this decoder or any of its instances is drawn at, 1 where
+    // positions can't be interpolated.
+    int GetUpdateDivisor();
+
+    // Geometry LOD segments are decoded at for the finest LOD this decoder or any of its instances
+    // is drawn at, 0 decodes the full mesh. See AVV_SEGMENT_TRIS_LODS_32.
+    int GetGeometryLOD();
+
+    // True if the segment is decoded but at another geometry LOD than the one now wanted, it's
+    // read again to switch (Game Thread).
+    bool IsSegmentLODStale(int segmentIndex);
+
+    // True while frames are presented in between decoded ones, by update divisor or sub frame.
+    bool IsInterpolating();
+
     // Decoding functions that are shared between both CPU and Compute decoders.
     void UpdateTextureBlockMap(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment);
     void DecodeFrameAnimation(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* meshOut);
     void DecodeFrameTexture(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* meshOut);
 
 protected:
+    // Drives the reader and CPU decoding functions directly, see HoloSuitePlayerEditor.
+    friend class UHoloSuiteBenchmarkCommandlet;
+
     bool bInitialized;
     bool bImmediateMode;
     bool bUseBC4HardwareDecoding;
 
+    // Anything but BC4 decodes luma on the reader's worker threads and uploads the result into
+    // BC4Texture instead of running AVVLumaDecodeCS. Picked from r.AVV.CPULumaDecode on open.
+    EAVVLumaFormat LumaFormat = EAVVLumaFormat::BC4;
+
     FAVVReader avvReader;
 
+    // Set while a work request to update or prepare avvReader is queued, so notifications don't queue more than one.
+    std::atomic<bool> bReaderUpdateQueued = { false };
+    std::atomic<bool> bReaderPrepareQueued = { false };
+
     // Tracks the state of the data as it moves from CPU to GPU
     enum class EDecoderState
     {
@@ -105,21 +158,101 @@ protected:
     DecodingState RequestedState;
     DecodingState PendingState;
     DecodingState CurrentState;
+    DecodingState PrefetchState;
+    int PrefetchFrameCount = 0;
 
     bool bReversedCaching = false;
+    bool bResidentPlayback = false;
     FAVVDataCache DataCache;
 
+    // Per LOD decode profile, see SetLODDecodeFlags.
+    EAVVDecodeFlags LODDecodeFlags[HOLOMESH_MAX_LODS];
+
+    // Per LOD update divisor, see SetLODUpdateDivisor.
+    int LODUpdateDivisors[HOLOMESH_MAX_LODS];
+
+    // Frame last presented on the decoded meshes, behind CurrentState while it's interpolated towards it.
+    float PresentedFrame = -1.0f;
+
+    // Fractional frame to present once RequestedState is decoded, -1 presents RequestedState itself.
+    float RequestedPresentFrame = -1.0f;
+    bool bSubFramePresentation = false;
+
+    // The meshes were last presented in between decoded frames or with motion, see PresentFrame.
+    bool bFrameInterpolated = false;
+    bool bPresentedMotion = false;
+
+    // Frame and vertex count last animated into a mesh, the next frame can only be interpolated
+    // from them if it lands in the same mesh and segment (Render Thread).
+    int LastAnimatedFrame = -1;
+    int LastAnimatedVertexCount = 0;
+
     std::atomic<int> DecodedSegmentIndex = { -1 };
     int DecodedSegmentVertexCount = 0;
     AVVEncodedTextureInfo DecodedSegmentTextureInfo = {};
 
+    // Geometry LOD the current segment is decoded at and how many it has, written with the update
+    // request that decodes it (Game Thread). The render thread decodes it again if DecodedSegmentLOD differs.
+    std::atomic<int> SegmentLOD = { 0 };
+    int SegmentLODCount = 1;
+    int DecodedSegmentLOD = 0;
+
     // Data Containers
     TRefCountPtr<FRDGPooledBuffer> AnimDataBuffer;
     TRefCountPtr<FRDGPooledBuffer> DecodedVertexBuffer;
     TRefCountPtr<FRDGPooledBuffer> TextureBlockMapBuffer;
 
+    // Mesh and frame the luma texture was last decoded into, delta frames build on top of it.
+    FHoloMesh* LumaMesh = nullptr;
+    int LumaFrameNumber = -1;
+    int LumaSegmentIndex = -1;
+
+    // Set while delta frames are applied to a texture that missed the frames before them (Render Thread).
+    bool bLumaIncomplete = false;
+
+    // LOD the decoded frame cache is filled at. Coarser LODs skip streams finer ones draw so
+    // frames are only captured at this LOD and it's refilled if a finer one is needed.
+    std::atomic<int> DecodedFrameCacheLOD = { -1 };
+
+    // CPU decoded luma keeps a copy of every mip (Render Thread). Delta frames are applied to it
+    // and each target mesh only uploads the region changed since it was last written, decoded
+    // meshes alternate so that's the last two frames' blocks.
+    struct FLumaMirrorLevel
+    {
+        TArray<uint8> Luma;
+        TArray<uint8> Mask;
+        int BlocksX = 0;
+        int BlocksY = 0;
+
+        // Region each mesh is missing, a mesh without an entry is missing all of it.
+        TMap<FHoloMesh*, FIntRect> Dirty;
+    };
+    FLumaMirrorLevel LumaMirror[3];
+    int LumaMirrorLevelCount = 0;
+    uint32_t LumaLevelEnds[3] = {};
+    TArray<uint32> LumaBlockMap;
+
     virtual void InitDecoder(UMaterialInterface* NewMeshMaterial);
 
+    // Binds the cached copy of frameNumber if the whole clip is in the decoded frame cache (Game Thread)
+    bool BindCachedFrame(int frameNumber);
+
+    // Frame decoded to present frameNumber: the next one on its segment's update divisor grid,
+    // or the segment's last frame.
+    int GetUpdateFrame(int frameNumber);
+
+    // Positions are interpolated from the previous position buffer while playing forward.
+    bool CanInterpolate();
+
+    // Moves the decoded meshes to frame, interpolating if it's in between decoded frames (Game Thread)
+    void PresentFrame(float frame);
+
+    // Called as frameNumber is handed to the render thread for decoding (Game Thread)
+    void PrepareFrameCapture(int frameNumber);
+
+    // Whether the frame that was just decoded can go into the decoded frame cache (Render Thread)
+    bool CanCaptureDecodedFrame();
+
     // Used for immediate mode decoding, will execute all steps to decoding a frame immediately.
     // This includes blocking on the segment data request if necessary.
     void SetFrameImmediate(int frameNumber);
@@ -127,8 +260,16 @@ protected:
     // Update Bounding Box (Game Thread)
     void UpdateBoundingBox(AVVEncodedSegment* segment, FHoloMesh* meshOut);
 
-    bool ShouldRequestTexture();
+    // Applies the frame's own bounds if it has them, returns false otherwise. While interpolating they
+    // also cover previousFrame, which the mesh is drawn from until the frame is reached (Game Thread)
+    bool UpdateFrameBoundingBox(AVVEncodedFrame* frame, FHoloMesh* meshOut, AVVEncodedFrame* previousFrame = nullptr);
+
+    // Swaps proxy collision to the segment's bounding box (Game Thread)
+    void UpdateCollisionProxy(int segmentIndex, AVVEncodedSegment* segment);
+
     void ApplyTextures(FHoloMesh* Mesh, AVVEncodedSegment* segment = nullptr);
     void ClearTextures(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* meshOut);
+    void CopyLumaTextures(FRDGBuilder& GraphBuilder, FHoloMesh* sourceMesh, FHoloMesh* meshOut);
+    void UploadFrameLuma(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* meshOut);
     void UploadData(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, void* DataPtr, uint32_t SizeInBytes, AVVEncodedSegment* SourceSegment = nullptr, AVVEncodedFrame* SourceFrame = nullptr);
 };
\ No newline at end of file
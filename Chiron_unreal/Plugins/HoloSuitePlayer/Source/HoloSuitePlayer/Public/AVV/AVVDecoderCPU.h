@@ -29,6 +29,8 @@ public:
     virtual void Update(float DeltaTime) override;
 
 protected:
+    friend class UHoloSuiteBenchmarkCommandlet;
+
     // Locally decoded data
     uint8_t* DecodedVertexData;
     std::atomic<bool> RequiresSwap{ false };
@@ -38,7 +40,7 @@ protected:
     virtual void RequestCulled_RenderThread(FHoloMeshUpdateRequest request) override;
 
     // Decoding Functions
-    bool CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segment);
+    bool CPUDecodeMesh(FHoloMesh* meshOut, AVVEncodedSegment* segment, int lod = 0);
     bool CPUDecodeFrameColors(FHoloMesh* meshOut, AVVEncodedFrame* frame);
-    bool CPUDecodeFrameColorsNormals(FHoloMesh* meshOut, AVVEncodedFrame* frame);
+    bool CPUDecodeFrameColorsNormals(FHoloMesh* meshOut, AVVEncodedFrame* frame, bool decodeNormals = true);
 };
\ No newline at end of file
@@ -27,8 +27,8 @@ public:
     virtual void Close() override;
     virtual void Update(float DeltaTime) override;
 
-    // In compute decoding we always use the same single holomesh.
-    virtual FHoloMesh* GetHoloMesh(bool write = false) override { return &HoloMesh[0]; }
+    // In compute decoding we always use the same single holomesh, unless a cached frame is bound.
+    virtual FHoloMesh* GetHoloMesh(bool write = false) override { return (!write && DecodedFrameMesh != nullptr) ? DecodedFrameMesh : &HoloMesh[0]; }
     virtual FHoloMesh* GetHoloMesh(int index) override { return UAVVDecoder::GetHoloMesh(index); }
 
 protected:
@@ -38,9 +38,9 @@ protected:
     virtual void EndFrame_RenderThread(FRDGBuilder& GraphBuilder, FHoloMeshUpdateRequest request) override;
 
     // Decoding Functions
-    bool ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh);
-    bool ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh);
-    bool ComputeDecodeSegmentTriangles(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh);
-    bool ComputeDecodeSegmentMotionVectors(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh);
-    bool ComputeDecodeFrameColorNormals(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* mesh);
+    bool ComputeDecodeSegmentVertices(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh, int lod = 0);
+    bool ComputeDecodeSegmentUVNormals(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh, int lod = 0);
+    bool ComputeDecodeSegmentTriangles(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh, int lod = 0);
+    bool ComputeDecodeSegmentMotionVectors(FRDGBuilder& GraphBuilder, AVVEncodedSegment* segment, FHoloMesh* mesh, int lod = 0);
+    bool ComputeDecodeFrameColorNormals(FRDGBuilder& GraphBuilder, AVVEncodedFrame* frame, FHoloMesh* mesh, bool decodeNormals = true);
 };
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include <thread>
 
 #include "HoloSuiteFile.h"
+#include "HoloSuiteIO.h"
 #include "HoloSuitePlayerModule.h"
 
 #include "AVVFile.generated.h"
@@ -40,11 +41,16 @@ struct HOLOSUITEPLAYER_API FAVVIORequest
         Processed
     } Status = EStatus::None;
 
-    IBulkDataIORequest* Request = nullptr;
+    IHoloSuiteIORequest* Request = nullptr;
     double StartTime = 0.0;
     double EndTime = 0.0;
     size_t SizeInBytes = 0;
 
+    ~FAVVIORequest()
+    {
+        delete Request;
+    }
+
     bool PollCompletion()
     {
         if (Request == nullptr)
@@ -56,8 +62,9 @@ struct HOLOSUITEPLAYER_API FAVVIORequest
         {
             if (Request->PollCompletion())
             {
-                Status = FAVVIORequest::EStatus::Completed;
-                return true;
+                EndTime = FPlatformTime::Seconds();
+                Status = Request->Succeeded() ? FAVVIORequest::EStatus::Completed : FAVVIORequest::EStatus::Error;
+                return (Status == FAVVIORequest::EStatus::Completed);
             }
         }
 
@@ -96,10 +103,11 @@ public:
 
     // Read data into provided buffer. Return false if buffer too small or other failure.
     // This function will block until the read is finished.
-    bool Read(uint8_t* outputBuffer, size_t outputBufferSize);
+    // Reads go through the shared bulk data backend when no backend is given.
+    bool Read(uint8_t* outputBuffer, size_t outputBufferSize, IHoloSuiteIOBackend* backend = nullptr);
 
-    // Async read of data into provided buffer.
-    FAVVIORequestRef ReadAsync(uint8_t* outputBuffer, size_t outputBufferSize);
+    // Async read of data into provided buffer, callback is passed on to IHoloSuiteIOBackend::ReadAsync.
+    FAVVIORequestRef ReadAsync(uint8_t* outputBuffer, size_t outputBufferSize, IHoloSuiteIOBackend* backend = nullptr, FHoloSuiteIOCallback callback = nullptr);
 };
 
 /**
@@ -154,7 +162,7 @@ public:
 
     // Read metadata content. Caller is responsible for disposal.
     // This function will block until the read is finished.
-    uint8_t* ReadMetaData();
+    uint8_t* ReadMetaData(IHoloSuiteIOBackend* backend = nullptr);
 };
 
 // Custom serialization version for UAVVObject.
@@ -204,9 +212,18 @@ public:
 
     FString GetPath() override;
 
+    // Returns a backend serving every container of this file from one contiguous allocation,
+    // shared by all readers that hold it. It's filled in the background and streams reads until
+    // then, so opening doesn't wait for it. Returns nullptr if the file is larger than
+    // r.AVV.Resident.MaxSizeMB. Call on the game thread.
+    FHoloSuiteIOBackendRef GetResidentIOBackend();
+
 private:
 
     // Internal bulk data.
     FStreamableAVVData StreamableAVVData;
 
+    // Released once the last resident reader closes.
+    TWeakPtr<IHoloSuiteIOBackend, ESPMode::ThreadSafe> ResidentIOBackend;
+
 };
\ No newline at end of file
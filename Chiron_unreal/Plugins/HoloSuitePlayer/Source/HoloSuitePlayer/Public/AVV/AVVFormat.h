@@ -22,6 +22,7 @@
 #define AVV_TEXTURE                (1 << 17)
 #define AVV_SKELETON               (1 << 18)
 #define AVV_MOTION_VECTORS         (1 << 19)
+#define AVV_BOUNDS                 (1 << 20)
 
 // Meta Container Types
 #define AVV_META_SEGMENT_TABLE                     (0x01 | AVV_META_CONTAINER)
@@ -37,6 +38,7 @@
 #define AVV_SEGMENT_UVS_16                         (0x01 | AVV_VERTEX_UVS | AVV_SEGMENT_CONTAINER)
 #define AVV_SEGMENT_TRIS_16                        (0x01 | AVV_TRIS | AVV_SEGMENT_CONTAINER)
 #define AVV_SEGMENT_TRIS_32                        (0x02 | AVV_TRIS | AVV_SEGMENT_CONTAINER)
+#define AVV_SEGMENT_TRIS_LODS_32                   (0x03 | AVV_TRIS | AVV_SEGMENT_CONTAINER)
 #define AVV_SEGMENT_TEXTURE_TRIS_16                (0x01 | AVV_TEXTURE | AVV_SEGMENT_CONTAINER)
 #define AVV_SEGMENT_TEXTURE_TRIS_32                (0x02 | AVV_TEXTURE | AVV_SEGMENT_CONTAINER)
 #define AVV_SEGMENT_TEXTURE_BLOCKS_32              (0x03 | AVV_TEXTURE | AVV_SEGMENT_CONTAINER)
@@ -50,8 +52,10 @@
 #define AVV_FRAME_ANIM_DELTA_POS_32                (0x03 | AVV_VERTEX_ANIM | AVV_FRAME_CONTAINER)
 #define AVV_FRAME_TEXTURE_LUMA_8                   (0x01 | AVV_TEXTURE | AVV_FRAME_CONTAINER)
 #define AVV_FRAME_TEXTURE_LUMA_BC4                 (0x02 | AVV_TEXTURE | AVV_FRAME_CONTAINER)
+#define AVV_FRAME_TEXTURE_LUMA_BC4_DELTA           (0x03 | AVV_TEXTURE | AVV_FRAME_CONTAINER)
 #define AVV_FRAME_COLORS_RGB_565                   (0x01 | AVV_VERTEX_COLORS | AVV_FRAME_CONTAINER)
 #define AVV_FRAME_COLORS_RGB_565_NORMALS_OCT_16    (0x01 | AVV_VERTEX_COLORS | AVV_VERTEX_NORMALS | AVV_FRAME_CONTAINER)
+#define AVV_FRAME_BOUNDS_AABB_32                   (0x01 | AVV_BOUNDS | AVV_FRAME_CONTAINER)
 
 #include "HoloMeshComponent.h"
 #include "HoloMeshManager.h"
@@ -98,6 +102,14 @@ struct AVVSkeleton
     }
 };
 
+// What luma blocks are turned into on the CPU before upload, see r.AVV.CPULumaDecode.
+enum class EAVVLumaFormat : uint8_t
+{
+    BC4,    // Left as BC4 for the GPU to decode.
+    R8,     // 16 bytes per block, 4 rows of 4 texels.
+    EAC     // 8 byte ETC2 EAC R11 blocks.
+};
+
 struct AVVEncodedFrame
 {
     uint32_t frameIndex;
@@ -115,6 +127,11 @@ struct AVVEncodedFrame
     float deltaAABBMin[3];
     float deltaAABBMax[3];
 
+    // Bounds of the animated frame from AVV_FRAME_BOUNDS_AABB_32, in the same space as the segment AABB.
+    bool hasAABB = false;
+    float aabbMin[3];
+    float aabbMax[3];
+
     uint32_t colorCount = 0;
     uint32_t normalCount = 0;
     uint32_t colorDataOffset = 0;
@@ -127,8 +144,21 @@ struct AVVEncodedFrame
     bool blockDecode = false;
     uint32_t blockCount = 0;
 
+    // AVV_FRAME_TEXTURE_LUMA_BC4_DELTA only carries the blocks that changed since the previous
+    // frame. blockCount is the number of changed blocks and each one has an index into the
+    // segment's texture block map, sorted ascending.
+    bool deltaBlocks = false;
+    uint32_t blockIndexOffset = 0;
+
+    // Luma blocks decoded on the reader's worker thread, in the same order as the BC4 blocks.
+    FHoloMemoryBlockRef decodedLumaContent = nullptr;
+    EAVVLumaFormat decodedLumaFormat = EAVVLumaFormat::BC4;
+
     AVVSkeleton skeleton;
 
+    FHoloMeshVec3 GetAABBMin() { return FHoloMeshVec3(aabbMin[0], aabbMin[1], aabbMin[2]); }
+    FHoloMeshVec3 GetAABBMax() { return FHoloMeshVec3(aabbMax[0], aabbMax[1], aabbMax[2]); }
+
     void Create(SIZE_T SizeInBytes, SIZE_T TextureSizeInBytes)
     {
         content = GHoloMeshManager.AllocBlock(SizeInBytes);
@@ -145,6 +175,10 @@ struct AVVEncodedFrame
         {
             GHoloMeshManager.FreeBlock(textureContent);
         }
+        if (decodedLumaContent != nullptr)
+        {
+            GHoloMeshManager.FreeBlock(decodedLumaContent);
+        }
 
         if (ssdrMatrixData != nullptr)
         {
@@ -194,6 +228,17 @@ struct AVVEncodedSegment
     uint32_t indexDataOffset;
     uint32_t indexDataSize;
 
+    // Coarser geometric LODs from AVV_SEGMENT_TRIS_LODS_32, the first entry is LOD 1. Each one
+    // has its own 32 bit triangles that only reference a prefix of the segment's vertices.
+    struct GeometryLOD
+    {
+        uint32_t vertexCount = 0;
+        uint32_t compactVertexCount = 0;
+        uint32_t indexCount = 0;
+        uint32_t indexDataOffset = 0;
+    };
+    std::vector<GeometryLOD> geometryLODs;
+
     // UV Data
     uint32_t uvCount = 0;
     uint32_t uvDataOffset;
@@ -216,6 +261,27 @@ struct AVVEncodedSegment
     FHoloMeshVec3 GetAABBMin() { return FHoloMeshVec3(aabbMin[0], aabbMin[1], aabbMin[2]); }
     FHoloMeshVec3 GetAABBMax() { return FHoloMeshVec3(aabbMax[0], aabbMax[1], aabbMax[2]); }
 
+    // LOD the segment is decoded at for a mesh LOD, past its coarsest LOD the coarsest is used.
+    int GetGeometryLOD(int lod) { return FMath::Clamp(lod, 0, (int)geometryLODs.size()); }
+
+    uint32_t GetVertexCount(int lod)
+    {
+        lod = GetGeometryLOD(lod);
+        return (lod == 0) ? vertexCount : FMath::Min(geometryLODs[lod - 1].vertexCount, vertexCount);
+    }
+
+    uint32_t GetCompactVertexCount(int lod)
+    {
+        lod = GetGeometryLOD(lod);
+        return (lod == 0) ? compactVertexCount : FMath::Min(geometryLODs[lod - 1].compactVertexCount, compactVertexCount);
+    }
+
+    uint32_t GetIndexCount(int lod)
+    {
+        lod = GetGeometryLOD(lod);
+        return (lod == 0) ? indexCount : geometryLODs[lod - 1].indexCount;
+    }
+
     void Create(int SizeInBytes)
     {
         content = GHoloMeshManager.AllocBlock(SizeInBytes);
@@ -60,6 +60,9 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Playback")
         float CurrentFrame;
 
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Playback")
+        bool FrameInterpolation;
+
     /* Level of Detail Parameters */
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail")
@@ -77,6 +80,15 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail")
         int ForceLOD;
 
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail", meta = (ClampMin = 1, UIMin = 1))
+        int LOD0UpdateDivisor;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail", meta = (ClampMin = 1, UIMin = 1))
+        int LOD1UpdateDivisor;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail", meta = (ClampMin = 1, UIMin = 1))
+        int LOD2UpdateDivisor;
+
     /* Decoder Parameters */
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Decoder")
@@ -88,6 +100,9 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Decoder")
         bool UseCPUDecoder;
 
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Decoder")
+        bool ResidentPlayback;
+
     /* Rendering Parameters */
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Rendering")
@@ -149,11 +164,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Playback")
         void SetPlaybackParameters(bool NewExternalTiming, bool NewPlayOnOpen, bool NewLoop, bool NewPingPong, bool NewReverse, float NewFrameRate, float NewCurrentFrame);
 
+    UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Playback")
+        void SetFrameInterpolation(bool NewFrameInterpolation);
+
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Level of Detail")
         void SetLODParameters(float NewLOD0ScreenSize, float NewLOD1ScreenSize, float NewLOD2ScreenSize, int NewMinimumLOD, int NewForceLOD);
+
+    UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Level of Detail")
+        void SetLODUpdateDivisors(int NewLOD0UpdateDivisor, int NewLOD1UpdateDivisor, int NewLOD2UpdateDivisor);
     
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Decoder")
-        void SetDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder);
+        void SetDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder, bool NewResidentPlayback = false);
 
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Rendering")
         void SetRenderingParameters(bool NewMotionVectors, bool NewResponsiveAA, bool NewReceiveDecals);
@@ -183,6 +204,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Skeleton")
         void AttachActorToSkeleton(AActor* Actor, FName SocketName = NAME_None);
 
+    /* Instancing Functions */
+
+    // Creates a mesh under AttachParent that draws this player's decoded frames without decoding
+    // anything itself. A positive FrameOffset makes the instance trail playback by that many frames.
+    UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Instancing")
+        UHoloMeshComponent* CreateMeshInstance(USceneComponent* AttachParent, int FrameOffset = 0);
+
     /* Event Delegates */
 
     UPROPERTY(BlueprintAssignable, meta = (HideInDetailPanel))
@@ -212,6 +240,7 @@ protected:
 
     USkeletalMeshComponent* PlayerSkeletalMeshComponent;
     TMap<AActor*, FName> ActorsToBeAttached;
+    TArray<TWeakObjectPtr<UHoloMeshComponent>> MeshInstances;
 
     bool bFirstRun;
     bool bShouldPlay;
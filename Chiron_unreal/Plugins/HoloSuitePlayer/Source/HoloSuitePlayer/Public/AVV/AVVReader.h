@@ -53,6 +53,20 @@ inline float decodeFloat20(uint32_t x, float boundsMin, float boundsMax)
     return (zeroOne * (boundsMax - boundsMin)) + boundsMin;
 }
 
+// Optional streams that a request can skip. Distant meshes don't need data that
+// wouldn't be noticeable at their screen size, see UAVVDecoder::GetDecodeFlags().
+// Only luma is skipped when reading, the other streams share containers with data
+// that is always needed so they're read but not decoded.
+enum class EAVVDecodeFlags : uint8
+{
+    None            = 0,
+    Texture         = 1 << 0,   // Luma reads and decodes.
+    Normals         = 1 << 1,   // Frame normals, colors are still decoded.
+    MotionVectors   = 1 << 2,   // Segment motion vectors.
+    All             = 0xff
+};
+ENUM_CLASS_FLAGS(EAVVDecodeFlags)
+
 struct FAVVReaderRequest
 {
     ~FAVVReaderRequest()
@@ -81,6 +95,26 @@ struct FAVVReaderRequest
 };
 typedef TSharedPtr<FAVVReaderRequest, ESPMode::ThreadSafe> FAVVReaderRequestRef;
 
+// Lets reads in flight tell their reader it has work, shared with them since they can finish after it's closed.
+struct FAVVReaderSignal
+{
+    FCriticalSection CriticalSection;
+    TFunction<void()> Callback;
+    std::atomic<bool> bPending = { false };
+
+    void Notify()
+    {
+        bPending = true;
+
+        FScopeLock Lock(&CriticalSection);
+        if (Callback)
+        {
+            Callback();
+        }
+    }
+};
+typedef TSharedRef<FAVVReaderSignal, ESPMode::ThreadSafe> FAVVReaderSignalRef;
+
 class HOLOSUITEPLAYER_API FAVVReader
 {
 public:
@@ -96,15 +130,31 @@ public:
     FAVVReader();
     ~FAVVReader();
 
-    bool Open(UAVVFile* avvFile);
+    // Resident readers share one in-memory copy of the file when it fits r.AVV.Resident.MaxSizeMB
+    // and stream it otherwise.
+    bool Open(UAVVFile* avvFile, bool resident = false);
     void Close();
 
-    // Processes the next available request. This is a thread safe operation and is in intended
-    // to be frequently called from anywhere that wants to tick the reader.
+    // Issues reads and collects the ones that finished, without parsing them. This is a thread safe
+    // operation and is intended to be called from an IO thread in response to the update callback.
     void Update();
 
+    // Parses requests whose reads have finished and makes them available through GetFinishedRequest().
+    // This is a thread safe operation and is intended to be called from a decode thread in response to
+    // the prepare callback, it does the CPU heavy part of a request.
+    void Prepare();
+
+    // Called from any thread whenever Update has work to do: a request was added or a read it's waiting
+    // on can make progress. An idle reader never calls it. Cleared by Close().
+    void SetUpdateCallback(TFunction<void()> callback);
+
+    // Called from an IO thread whenever Prepare has read requests waiting. Cleared by Close().
+    void SetPrepareCallback(TFunction<void()> callback);
+
     // Request for a segment and/or frame. Will be available through GetNextFinishedRequest().
-    bool AddRequest(int requestSegmentIndex = -1, int requestFrameIndex = -1, bool requestTexture = true, bool blockingRequest = false);
+    // Textures missing from decodeFlags aren't read. Segment streams are always prepared since
+    // segments are cached and can be decoded at a finer LOD than the one that requested them.
+    bool AddRequest(int requestSegmentIndex = -1, int requestFrameIndex = -1, EAVVDecodeFlags decodeFlags = EAVVDecodeFlags::All, bool blockingRequest = false);
 
     // Returns the next completed request in a FIFO order.
     FAVVReaderRequestRef GetFinishedRequest();
@@ -114,6 +164,9 @@ public:
     // Returns a segment index for a given frame number.
     int GetSegmentIndex(int frameNumber);
 
+    // Returns the first frame number of a segment.
+    int GetSegmentStartFrame(int segmentIndex);
+
     uint32_t Version;
     FString VersionString;
     int FrameCount;
@@ -125,6 +178,16 @@ public:
 
     static bool DecodeMetaSkeleton(UAVVFile* avvFile, AVVSkeleton* targetSkeleton);
 
+    // Luma blocks of every prepared frame texture are decoded into this format by Prepare().
+    // BC4 leaves them for the GPU.
+    EAVVLumaFormat CPULumaFormat = EAVVLumaFormat::BC4;
+
+    // Fills frame->decodedLumaContent from the frame's BC4 blocks, replacing any previous result.
+    static void DecodeFrameLuma(AVVEncodedFrame* frame, EAVVLumaFormat format);
+
+    // Backend every container of the open file is read through, picked in Open().
+    FHoloSuiteIOBackendRef IOBackend;
+
 protected:
 
     UAVVFile* openFile;
@@ -144,8 +207,20 @@ protected:
     std::atomic<EAVVReaderState> readerState;
     TQueue<FAVVReaderRequestRef> pendingRequests;
     TQueue<FAVVReaderRequestRef> waitingRequests;
-    TQueue<FAVVReaderRequestRef> finishedRequests;
+    TQueue<FAVVReaderRequestRef> readRequests;
+    TQueue<FAVVReaderRequestRef, EQueueMode::Mpsc> finishedRequests;
     TSet<int> activeFrameNumbers;
+    FAVVReaderSignalRef updateSignal;
+
+    // Held while preparing readRequests, separate from CriticalSection so reads keep being issued meanwhile.
+    FCriticalSection PrepareCriticalSection;
+    FAVVReaderSignalRef prepareSignal;
+
+    // Advances the request state machine by one step, returns true if there's more to do. Called with CriticalSection held.
+    bool ProcessRequests();
+
+    // Parses every container a request read.
+    void PrepareRequest(FAVVReaderRequest* request);
 
     // Read the current pending segment. This comes after the IO request has been fufilled. 
     void PrepareSegment(AVVEncodedSegment* segment);
@@ -157,6 +232,8 @@ protected:
     void ReadFrameAnimDeltaPos32(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut);
     void ReadFrameTextureLuma8(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut);
     void ReadFrameTextureLumaBC4(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut);
+    void ReadFrameTextureLumaBC4Delta(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut);
     void ReadFrameColorsRGB565(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut);
     void ReadFrameColorsRGB565NormalsOct16(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut);
+    void ReadFrameBoundsAABB32(uint8_t* frameData, size_t readPos, AVVEncodedFrame& decodedFrameOut);
 };
\ No newline at end of file
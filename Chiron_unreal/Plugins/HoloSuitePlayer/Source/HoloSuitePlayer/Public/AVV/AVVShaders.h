@@ -361,6 +361,7 @@ struct FAVVDecodeFrameColor_RGB_565_Normals_Oct16_CS : public FGlobalShader
         SHADER_PARAMETER_UAV(RWBuffer<uint32>, VertexTangentBuffer)
         SHADER_PARAMETER(uint32, gVertexCount)
         SHADER_PARAMETER(uint32, gColorCount)
+        SHADER_PARAMETER(uint32, gDecodeNormals)
     END_SHADER_PARAMETER_STRUCT()
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -423,6 +424,63 @@ struct FAVVCopyTextureBlock_BC4_CS : public FGlobalShader
         return SupportsComputeShaders(Parameters.Platform);
     }
 
+    static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+    {
+        FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+        OutEnvironment.CompilerFlags.Add(CFLAG_AllowTypedUAVLoads);
+        OutEnvironment.SetDefine(TEXT("HLSL_2021"), HLSL_2021);
+    }
+};
+
+// AVV_SEGMENT_TEXTURE_BLOCKS_32 + AVV_FRAME_TEXTURE_LUMA_BC4_DELTA
+struct FAVVDecodeTextureBlockDelta_BC4_CS : public FGlobalShader
+{
+    DECLARE_GLOBAL_SHADER(FAVVDecodeTextureBlockDelta_BC4_CS)
+    SHADER_USE_PARAMETER_STRUCT(FAVVDecodeTextureBlockDelta_BC4_CS, FGlobalShader)
+
+    BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+        SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, TextureBlockDataBuffer)
+        SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint2>, LumaBlockDataBuffer)
+        SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, LumaBlockIndexBuffer)
+        SHADER_PARAMETER_UAV(RWTexture2D<float>, LumaTextureOut)
+        SHADER_PARAMETER_UAV(RWTexture2D<float>, MaskTextureOut)
+        SHADER_PARAMETER(uint32, gBlockCount)
+        SHADER_PARAMETER(uint32, gBlockOffset)
+    END_SHADER_PARAMETER_STRUCT()
+
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return SupportsComputeShaders(Parameters.Platform);
+    }
+
+    static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+    {
+        FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+        OutEnvironment.CompilerFlags.Add(CFLAG_AllowTypedUAVLoads);
+        OutEnvironment.SetDefine(TEXT("HLSL_2021"), HLSL_2021);
+    }
+};
+
+struct FAVVCopyTextureBlockDelta_BC4_CS : public FGlobalShader
+{
+    DECLARE_GLOBAL_SHADER(FAVVCopyTextureBlockDelta_BC4_CS)
+    SHADER_USE_PARAMETER_STRUCT(FAVVCopyTextureBlockDelta_BC4_CS, FGlobalShader)
+
+    BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+        SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, TextureBlockDataBuffer)
+        SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint2>, LumaBlockDataBuffer)
+        SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, LumaBlockIndexBuffer)
+        SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint2>, BC4StagingTextureOut)
+        SHADER_PARAMETER_UAV(RWTexture2D<float>, MaskTextureOut)
+        SHADER_PARAMETER(uint32, gBlockCount)
+        SHADER_PARAMETER(uint32, gBlockOffset)
+    END_SHADER_PARAMETER_STRUCT()
+
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return SupportsComputeShaders(Parameters.Platform);
+    }
+
     static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
     {
         FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
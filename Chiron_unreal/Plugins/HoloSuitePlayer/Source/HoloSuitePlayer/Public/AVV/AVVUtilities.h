@@ -174,7 +174,9 @@ struct FAVVDataCache
     // Frees stale data that comes before the provided segment and frame indexes.
     // Will also free data which is too far ahead to be useful.
     // If reverse is true the function will evaluate the opposite directions for reverse playback caching.
-    void FreeStaleData(int staleBeforeSegment, int staleBeforeFrame, bool reverse = false)
+    // Data within the ahead window of keepSegment/keepFrame is also kept, this protects
+    // prefetched data for a frame that playback hasn't reached yet.
+    void FreeStaleData(int staleBeforeSegment, int staleBeforeFrame, bool reverse = false, int keepSegment = -1, int keepFrame = -1)
     {
         SCOPE_CYCLE_COUNTER(STAT_AVVDataCache_FreeStaleData);
 
@@ -190,7 +192,8 @@ struct FAVVDataCache
         {
             bool isBehind = reverse ? (int)Segment->segmentIndex > staleBeforeSegment : (int)Segment->segmentIndex < staleBeforeSegment;
             bool isAhead = reverse ? (int)Segment->segmentIndex < (staleBeforeSegment - MaxSegmentsAhead) : (int)Segment->segmentIndex > (staleBeforeSegment + MaxSegmentsAhead);
-            if ((isBehind || isAhead || Segment->processed) && Segment->activeUploadCount.load() == 0)
+            bool isKept = keepSegment > -1 && (int)Segment->segmentIndex >= keepSegment && (int)Segment->segmentIndex <= (keepSegment + MaxSegmentsAhead);
+            if ((isBehind || isAhead || Segment->processed) && !isKept && Segment->activeUploadCount.load() == 0)
             {
                 Segment->Release();
                 delete Segment;
@@ -206,7 +209,8 @@ struct FAVVDataCache
         {
             bool isBehind = reverse ? (int)Frame->frameIndex > staleBeforeFrame : (int)Frame->frameIndex < staleBeforeFrame;
             bool isAhead = reverse ? (int)Frame->frameIndex < (staleBeforeFrame - MaxFramesAhead) : (int)Frame->frameIndex > (staleBeforeFrame + MaxFramesAhead);
-            if ((isBehind || isAhead || Frame->processed) && Frame->activeUploadCount.load() == 0)
+            bool isKept = keepFrame > -1 && (int)Frame->frameIndex >= keepFrame && (int)Frame->frameIndex <= (keepFrame + MaxFramesAhead);
+            if ((isBehind || isAhead || Frame->processed) && !isKept && Frame->activeUploadCount.load() == 0)
             {
                 Frame->Release();
                 delete Frame;
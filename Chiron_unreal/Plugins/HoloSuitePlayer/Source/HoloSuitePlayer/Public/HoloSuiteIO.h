@@ -0,0 +1,98 @@
+// Copyright 2023 Arcturus Studios Holdings, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/AsyncFileHandle.h"
+#include "Serialization/BulkData.h"
+
+// Where the payloads of streamable AVV containers and OMS chunks are read from.
+// The default is picked by r.HoloSuite.IO.Backend when a file is opened.
+enum class EHoloSuiteIOBackend : uint8
+{
+	// FByteBulkData streaming requests. Works on every platform and packaging mode.
+	BulkData,
+	// Reads the payload straight out of the package file it was saved to, memory mapped where
+	// the platform allows it. Payloads in IoStore containers, compressed or not yet saved fall
+	// back to BulkData.
+	File,
+	// Every payload is copied into memory when the file is opened. Reads finish on the calling
+	// thread in the order they're issued, for headless tests and small files.
+	Memory,
+	// Every payload of a file packed into one allocation that's shared by all of its readers,
+	// see HoloSuiteIO::CreateResidentBackend. Not selectable through r.HoloSuite.IO.Backend.
+	Resident
+};
+
+// Controls shared by every read a backend issues.
+struct FHoloSuiteIOSettings
+{
+	// Priority of streaming reads. Blocking reads always use AIOP_CriticalPath.
+	EAsyncIOPriorityAndFlags Priority = AIOP_High;
+
+	// Streaming reads in flight at once, 0 is unlimited. Reads over the limit are issued
+	// when polled after an earlier one completes.
+	int32 MaxQueueDepth = 0;
+};
+
+// Called from any thread once polling a request can make progress: its read finished, successfully or
+// not, or a read held back by MaxQueueDepth can be issued now. It may be called more often than needed.
+// Reads that finish inside ReadAsync don't call it, so requests are polled once after being issued.
+typedef TFunction<void()> FHoloSuiteIOCallback;
+
+// A single outstanding read into a caller owned buffer. The buffer has to stay valid until the
+// request reports completion or is destroyed, destroying an unfinished request waits for it.
+class HOLOSUITEPLAYER_API IHoloSuiteIORequest
+{
+public:
+	virtual ~IHoloSuiteIORequest() {}
+
+	// Returns true once the read is finished, successfully or not. Polled by one thread at a time.
+	virtual bool PollCompletion() = 0;
+	virtual void WaitCompletion() = 0;
+
+	// Only valid after completion.
+	virtual bool Succeeded() const = 0;
+};
+
+class HOLOSUITEPLAYER_API IHoloSuiteIOBackend
+{
+public:
+	virtual ~IHoloSuiteIOBackend() {}
+
+	virtual EHoloSuiteIOBackend GetType() const = 0;
+
+	// Starts reading the whole payload of BulkData into Dest, which has to hold GetBulkDataSize() bytes.
+	// Never returns nullptr, a read that can't be issued completes unsuccessfully. The caller deletes
+	// the request, like IBulkDataIORequest. Callback lets the caller poll only when there's progress.
+	virtual IHoloSuiteIORequest* ReadAsync(const FByteBulkData& BulkData, uint8* Dest, FHoloSuiteIOCallback Callback = nullptr) = 0;
+
+	// Blocks until the payload is in Dest.
+	virtual bool Read(const FByteBulkData& BulkData, uint8* Dest) = 0;
+
+	// Called on the game thread with every payload the owner may read before any reads are
+	// issued. Only the memory backend does anything with it.
+	virtual void Preload(const FByteBulkData& BulkData) {}
+
+	FHoloSuiteIOSettings Settings;
+};
+typedef TSharedPtr<IHoloSuiteIOBackend, ESPMode::ThreadSafe> FHoloSuiteIOBackendRef;
+
+namespace HoloSuiteIO
+{
+	// Creates a backend with its settings taken from the r.HoloSuite.IO.* console variables.
+	HOLOSUITEPLAYER_API FHoloSuiteIOBackendRef CreateBackend(EHoloSuiteIOBackend Type);
+
+	// Creates the backend selected by r.HoloSuite.IO.Backend.
+	HOLOSUITEPLAYER_API FHoloSuiteIOBackendRef CreateDefaultBackend();
+
+	// Reads Payloads into a single allocation in the background and serves every read of them from
+	// it once they're all in, reads are streamed until then. Returns nullptr if they add up to more
+	// than MaxSizeBytes. Call on the game thread.
+	HOLOSUITEPLAYER_API FHoloSuiteIOBackendRef CreateResidentBackend(TArrayView<const FByteBulkData* const> Payloads, int64 MaxSizeBytes);
+
+	// Shared bulk data backend used by reads that aren't given one.
+	HOLOSUITEPLAYER_API IHoloSuiteIOBackend& GetBulkDataBackend();
+
+	HOLOSUITEPLAYER_API const TCHAR* LexToString(EHoloSuiteIOBackend Type);
+}
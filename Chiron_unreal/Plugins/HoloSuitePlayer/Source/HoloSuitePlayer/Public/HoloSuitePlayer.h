@@ -104,6 +104,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Playback", meta = (EditCondition = "PlayerType == EPlayerType::AVV", EditConditionHides, ClampMin = 0, UIMin = 0))
         float CurrentFrame;
 
+    // Blend the mesh towards the next frame on engine frames rendered in between two frames of the volumetric video, for displays refreshing faster than it was captured. AVV blends vertex positions, OMS blends SSDR bone matrices. No extra frames are decoded.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Playback", meta = (EditCondition = "PlayerType != EPlayerType::UNKNOWN", EditConditionHides))
+        bool FrameInterpolation;
+
     // Level of Detail Parameters
 
     // Base LOD.
@@ -126,6 +130,18 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail", meta = (EditCondition = "PlayerType == EPlayerType::AVV", EditConditionHides, ClampMin = -1, UIMin = -1))
         int ForceLOD;
 
+    // Decode every Nth frame at LOD 0 and interpolate the vertices of the frames in between.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail", meta = (DisplayName = "LOD 0 Update Divisor", EditCondition = "PlayerType == EPlayerType::AVV", EditConditionHides, ClampMin = 1, UIMin = 1))
+        int LOD0UpdateDivisor;
+
+    // LOD 1.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail", meta = (DisplayName = "LOD 1 Update Divisor", EditCondition = "PlayerType == EPlayerType::AVV", EditConditionHides, ClampMin = 1, UIMin = 1))
+        int LOD1UpdateDivisor;
+
+    // LOD 2. Textures aren't decoded at this LOD by default so skipped frames don't leave gaps in them.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Level of Detail", meta = (DisplayName = "LOD 2 Update Divisor", EditCondition = "PlayerType == EPlayerType::AVV", EditConditionHides, ClampMin = 1, UIMin = 1))
+        int LOD2UpdateDivisor;
+
     // Decoder Parameters
 
     // Toggle whether the AVV content should be decoded and loaded into the scene while working in the Editor and not playing.
@@ -140,6 +156,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Decoder", meta = (DisplayName = "Use CPU Decoder", EditCondition = "bSupportsCompute", EditConditionHides))
         bool UseCPUDecoder;
 
+    // Toggle whether the whole AVV should be loaded into memory once and shared by every player using it instead of being streamed. Recommended for short looping clips. Files larger than r.AVV.Resident.MaxSizeMB are still streamed.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Decoder", meta = (EditCondition = "PlayerType == EPlayerType::AVV", EditConditionHides))
+        bool ResidentPlayback;
+
     // Specify the maximum number of sequences to buffer / pre-load during playback.
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Decoder", meta = (EditCondition = "PlayerType == EPlayerType::OMS", EditConditionHides, ClampMin = 1, UIMin = 1))
         int MaxBufferedSequences;
@@ -259,17 +279,25 @@ public:
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Playback")
         void SetAVVPlaybackParameters(bool NewExternalTiming, bool NewPlayOnOpen, bool NewLoop, bool NewPingPong, bool NewReverse, float NewFrameRate, float NewCurrentFrame);
 
+    // Toggles blending in between frames of the volumetric video.
+    UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Playback")
+        void SetFrameInterpolation(bool NewFrameInterpolation);
+
     // Configures AVV LOD options.
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Level of Detail")
         void SetAVVLODParameters(float NewLOD0ScreenSize, float NewLOD1ScreenSize, float NewLOD2ScreenSize, int NewMinimumLOD, int NewForceLOD);
 
+    // Configures how often each AVV LOD decodes a frame.
+    UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Level of Detail")
+        void SetAVVLODUpdateDivisors(int NewLOD0UpdateDivisor, int NewLOD1UpdateDivisor, int NewLOD2UpdateDivisor);
+
     // Configures OMS decoder options.
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Decoder")
         void SetOMSDecoderParameters(bool NewUseCPUDecoder, int NewNumBufferedSequences);
 
     // Configures AVV decoder options.
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Decoder")
-        void SetAVVDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder);
+        void SetAVVDecoderParameters(bool NewLoadInEditor, int NewPlaybackDelay, bool NewUseCPUDecoder, bool NewResidentPlayback = false);
 
     // Configures OMS rendering options.
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Rendering")
@@ -36,8 +36,27 @@ public:
     FHoloMesh* holoMesh = nullptr;
     oms_sequence_t* sequence = nullptr;
 
+    // Hull points in Unreal space, only filled in for proxy collision.
+    TArray<FVector> collisionHull;
+
+    // Read issued by the IO work request, released once the decode work request parsed it.
+    IHoloSuiteIORequest* readRequest = nullptr;
+    uint8* readData = nullptr;
+
+    void ReleaseRead()
+    {
+        // Deleting an unfinished request waits for it, so the buffer is only freed afterwards.
+        delete readRequest;
+        readRequest = nullptr;
+
+        FMemory::Free(readData);
+        readData = nullptr;
+    }
+
     ~FDecodedOMSSequence()
     {
+        ReleaseRead();
+
         ENQUEUE_RENDER_COMMAND(DeleteHoloMesh)([HoloMesh = holoMesh]
         (FRHICommandListImmediate& RHICmdList)
         {
@@ -66,13 +85,21 @@ struct FDecodedOMSTextureFrame
     TSharedPtr<FRHIGPUBufferReadback> FrameNumberReadback;
     int FrameNumberReadbackTimeout;
 
+    // Frame number predicted from the media player time, see FOMSFrameSync.
+    int PredictedFrameNumber;
+
+    // When false FrameNumber is the predicted frame and the stamped frame number is not decoded.
+    bool bDecodeFrameNumber;
+
     FDecodedOMSTextureFrame()
         : FrameNumber(-1),
           SourceTexture(nullptr),
           Texture(nullptr),
           TextureSize(0, 0),
           TextureFormat(EPixelFormat::PF_B8G8R8A8), 
-          FrameNumberReadbackTimeout(0)
+          FrameNumberReadbackTimeout(0),
+          PredictedFrameNumber(-1),
+          bDecodeFrameNumber(true)
     {}
 
     ~FDecodedOMSTextureFrame()
@@ -86,6 +113,31 @@ struct FDecodedOMSTextureFrame
     }
 };
 
+/**
+ * Maps media player presentation time to content frame numbers so the frame number stamped into
+ * the video only has to be decoded periodically. Each decoded frame number corrects the offset
+ * between the two, which absorbs decoder latency and drift.
+ */
+struct FOMSFrameSync
+{
+    // Decoded minus predicted frame number from the last verification.
+    int FrameOffset = 0;
+    int LastPrediction = -1;
+    int FramesSinceVerification = 0;
+    bool bVerified = false;
+
+    void Reset();
+
+    // Returns the frame number at the given media time without the offset applied.
+    static int PredictFrame(FTimespan Time, float FrameRate);
+
+    // True when the next frame should be decoded from the video instead of predicted. Interval is
+    // in video frames, however often this is called in between.
+    bool NeedsVerification(int Prediction, int Interval);
+
+    void Verify(int Prediction, int DecodedFrameNumber);
+};
+
 class UOMSPlayerComponent;
 
 UCLASS()
@@ -115,6 +167,9 @@ public:
     // Will return (-1, -1) if the requested frame number is invalid.
     std::pair<int, int> GetFrameFromLookupTable(int contentFrameNumber);
 
+    // Bounds of a frame of a sequence computed on import, false if the asset has none for it.
+    bool GetFrameBounds(int sequenceIndex, int frameIndex, FBox& boundsOut);
+
     // Requests the decoder 
     void RequestSequence(int index);
 
@@ -123,8 +178,9 @@ public:
     FDecodedOMSSequenceRef GetSequence(int index, bool waitForSequence);
 
     // Called by HoloMeshManager when a work request is executed. Executes
-    // on a worker thread, not game or render thread.
-    void DoThreadedWork(int sequenceIndex, int frameIndex) override;
+    // on a worker thread, not game or render thread. Sequences are read on
+    // an IO thread which then queues their decode on a decode thread.
+    void DoThreadedWork(int sequenceIndex, int frameIndex, EHoloMeshWorkType workType) override;
 
     // Determines if compute shaders are supported and, consequently which decoding methods can be used.
     static bool CheckComputeSupport();
@@ -154,6 +210,10 @@ public:
 
     void UpdateMeshMaterial(bool write, bool frameTexture, bool boneTexture, bool retarget, bool ssdr, float ssdrEnabled);
 
+    // Binds the read mesh's SSDR frames blended from fromFrame towards the frame after it. The blend
+    // runs on the GPU, a blend of 0 binds SSDRFrame again. Always 0 without compute support (Game Thread).
+    void SetSSDRBlend(int fromFrame, float blend);
+
 private:
 
     enum class EMeshDecoderState
@@ -178,9 +238,15 @@ private:
     // Header metadata of the OMS source.
     oms_header_t* OMSHeader;
 
+    // Backend sequences are read through, picked by r.HoloSuite.IO.Backend in OpenOMS().
+    FHoloSuiteIOBackendRef IOBackend;
+
     // Table used to look for the sequence index and offset for each frame.
     TArray<std::pair<int, int>> frameLookupTable;
 
+    // Content frame number of the first frame of every sequence.
+    TArray<int> sequenceStartFrames;
+
     // Number of sequences whose static meshes the worker can generate and queue. 
     int MaxBufferedSequences;
 
@@ -197,6 +263,39 @@ private:
     // decoded sequences into the decodedSequences array to be managed.
     TQueue<FDecodedOMSSequenceRef> decodedQueue;
 
+    // Sequences the IO work request started reading, keyed by sequence index until the decode
+    // work request queued by the read's completion takes them. Guarded by readSequencesLock.
+    FCriticalSection readSequencesLock;
+    TMap<int, FDecodedOMSSequenceRef> readSequences;
+
+    // Proxy collision hull points by sequence index, computed the first time a sequence is decoded
+    // and copied into later decodes of it. Guarded by collisionHullsLock.
+    FCriticalSection collisionHullsLock;
+    TMap<int, TArray<FVector>> collisionHulls;
+
+    // SSDR blend waiting for the render thread, set by SetSSDRBlend(). The blend texture's resource
+    // is handed over rather than the render target so recreating it can't race the render thread.
+    struct FSSDRBlendRequest
+    {
+        FTextureResource* FromTexture = nullptr;
+        FTextureResource* ToTexture = nullptr;
+        FTextureRenderTargetResource* BlendTexture = nullptr;
+        uint32 TexelCount = 0;
+        float Blend = 0.0f;
+    };
+    FCriticalSection SSDRBlendLock;
+    FSSDRBlendRequest PendingSSDRBlend;
+    bool bSSDRBlendPending = false;
+
+    // FSSDRBlendCS is only compiled where compute shaders are supported, without it frames aren't blended.
+    bool bSSDRBlendSupported = false;
+
+    // UAV of the blend texture last dispatched to, recreated when the texture changes (Render Thread).
+    FTexture2DRHIRef SSDRBlendUAVTexture;
+    FUnorderedAccessViewRHIRef SSDRBlendUAV;
+
+    void BlendSSDRFrames_RenderThread(FRDGBuilder& GraphBuilder);
+
     // Anything in the free queue will be freed on the worker thread on its next pass.
     // This is a performance optimization so we don't pay anything on game thread.
     TQueue<FDecodedOMSSequenceRef> freeQueue;
@@ -220,6 +319,7 @@ private:
     bool bUseCPUDecoder;
 
     std::atomic<bool> bNewTextureFrameReady{ false };
+    FOMSFrameSync FrameSync;
     TStaticArray<FDecodedOMSTextureFrame, OMS_TEXTURE_FRAME_COUNT> DecodedTextureFrames;
 
     // The index into DecodedTextureFrame which is currently being used by the mesh.
@@ -231,4 +331,7 @@ private:
     void FastScrubbingTextureDecode();
     void ReadbackTextureDecode(UMaterialInterface* sourceMaterial);
     void ComputeTextureDecode(UMaterialInterface* sourceMaterial);
+
+    // Predicts the frame number of the next texture frame, returns true if it must be decoded.
+    bool PredictTextureFrame(FDecodedOMSTextureFrame* WriteFrame);
 };
\ No newline at end of file
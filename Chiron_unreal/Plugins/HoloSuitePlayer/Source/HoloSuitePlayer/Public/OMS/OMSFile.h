@@ -7,6 +7,7 @@
 #include "Serialization/BulkData.h"
 
 #include "HoloSuiteFile.h"
+#include "HoloSuiteIO.h"
 
 #include "OMSFile.generated.h"
 
@@ -20,11 +21,6 @@ struct oms_header_t;
 class HOLOSUITEPLAYER_API FOMSStreamableChunk
 {
 public:
-    FOMSStreamableChunk()
-    {
-        dataBuffer = nullptr;
-    }
-
     // Bulk data if stored in the package.
     FByteBulkData BulkData; // Sequence Data
 
@@ -38,14 +34,14 @@ public:
     /** Serialization. */
     void Serialize(FArchive& Ar, UOMSFile* Owner, int32 ChunkIndex);
 
-    /** Reads from BulkData into sequence. Sequence must be freed with oms_free_sequence to release allocated memory. */
-    void ReadSequenceSync(oms_header_t* header, oms_sequence_t* sequence);
+    /** Reads from BulkData into sequence, backed by a single arena allocation. Sequence must be freed with oms_free_sequence to release allocated memory. Uses the shared bulk data backend when no backend is given. */
+    void ReadSequenceSync(oms_header_t* header, oms_sequence_t* sequence, IHoloSuiteIOBackend* backend = nullptr);
 
-private:
-    /** Critical section to prevent concurrent access when locking the internal bulk data */
-    mutable FCriticalSection CriticalSection;
+    /** Starts reading BulkData into a buffer allocated for it, freed by the caller with FMemory::Free once the request is deleted. Returns nullptr when there's no data. Uses the shared bulk data backend when no backend is given, callback is passed on to IHoloSuiteIOBackend::ReadAsync. */
+    IHoloSuiteIORequest* ReadSequenceAsync(uint8*& outData, IHoloSuiteIOBackend* backend = nullptr, FHoloSuiteIOCallback callback = nullptr);
 
-    uint8* dataBuffer;
+    /** Decodes data read by ReadSequenceAsync into sequence, backed by a single arena allocation. Sequence must be freed with oms_free_sequence to release allocated memory. Returns false if the data couldn't be decoded, sequence is left empty. */
+    bool DecodeSequence(uint8* data, oms_header_t* header, oms_sequence_t* sequence);
 };
 
 /**
@@ -59,6 +55,11 @@ public:
     TArray<int> FrameToSequenceFrameOffset;
     int FrameCount;
 
+    // Bounds of every frame in Unreal space, computed on import so the player doesn't have to skin
+    // the sequence to get them. Invalid for frames of single frame and delta sequences, and empty
+    // for assets imported before FOMSFileVersion::FrameBounds.
+    TArray<FBox> FrameBounds;
+
     void Serialize(FArchive& Ar, class UOMSFile* Owner);
 
     void Reset()
@@ -99,6 +100,8 @@ struct HOLOSUITEPLAYER_API FOMSFileVersion
         FixMissingTail,
         // Keeps a record to the original path to the source file.
         KeepFilePath,
+        // Bounds of every SSDR frame, computed on import.
+        FrameBounds,
         // Add new versions above this line.
         VersionPlusOne,
         LatestVersion = VersionPlusOne - 1
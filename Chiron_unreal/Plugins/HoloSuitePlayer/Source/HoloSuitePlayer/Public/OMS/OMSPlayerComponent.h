@@ -75,6 +75,9 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Playback")
         float FrameRate;
 
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Playback")
+        bool FrameInterpolation;
+
     /* Decoder Parameters */
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Interp, Category = "HoloSuite Player | Decoder", meta = (EditCondition = "bSupportsCompute", EditConditionHides))
@@ -154,6 +157,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Playback")
         void SetPlaybackParameters(bool NewPlayOnOpen, bool NewLoop, bool NewMute, float NewFrameRate);
 
+    UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Playback")
+        void SetFrameInterpolation(bool NewFrameInterpolation);
+
     UFUNCTION(BlueprintCallable, Category = "HoloSuite Player | Playback")
         UMediaPlayer* GetMediaPlayer() { return MediaPlayer; }
     
@@ -259,12 +265,22 @@ protected:
     float frameTimer;
     float sourceFrameRate;
     float currentFrameRate;
+    float ssdrBlendTimer;
     int lastDecodedFrameNumber;
     int lastSkippedFrameNumber;
 
     void UnloadOMS();
     bool LoadSequence(int index, bool waitForSequence = true);
     bool LoadSequenceFrame(int index, bool sequenceUpdated);
+
+    // Uploads the bone matrices of every SSDR frame in the sequence to the mesh.
+    void UploadSSDRFrames(FHoloMesh* holoMesh, oms_sequence_t* sequence);
+
+    // Blends the SSDR frames around the shown one by the time since it was set, see UOMSDecoder::SetSSDRBlend().
+    void BlendSSDRFrames(float DeltaTime);
+
+    // Bounds of an SSDR frame of the current sequence from the asset, false if it has none.
+    bool GetSSDRFrameBounds(int frame, FBox& boundsOut);
     void LoadMediaPlayer();
     void CheckPlayerReady();
     void PrepareSkeletonManager();
@@ -49,3 +49,27 @@ class FDecodeFrameNumberCS : public FGlobalShader
     }
 };
 IMPLEMENT_GLOBAL_SHADER(FDecodeFrameNumberCS, "/HoloSuitePlayer/OMS/DecodeFrameNumberCS.usf", "MainCS", SF_Compute);
+
+class FSSDRBlendCS : public FGlobalShader
+{
+    DECLARE_GLOBAL_SHADER(FSSDRBlendCS)
+    SHADER_USE_PARAMETER_STRUCT(FSSDRBlendCS, FGlobalShader)
+
+    BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+    SHADER_PARAMETER_TEXTURE(Texture2D<float4>, FromTexture)
+    SHADER_PARAMETER_TEXTURE(Texture2D<float4>, ToTexture)
+    SHADER_PARAMETER_UAV(RWTexture2D<float4>, BlendTextureOut)
+    SHADER_PARAMETER(float, gBlend)
+    SHADER_PARAMETER(uint32, gTexelCount)
+    END_SHADER_PARAMETER_STRUCT()
+
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+#if (ENGINE_MAJOR_VERSION >= 5) && (ENGINE_MINOR_VERSION >= 1)
+        return true;
+#else
+        return RHISupportsComputeShaders(Parameters.Platform);
+#endif
+    }
+};
+IMPLEMENT_GLOBAL_SHADER(FSSDRBlendCS, "/HoloSuitePlayer/OMS/SSDRBlendCS.usf", "MainCS", SF_Compute);
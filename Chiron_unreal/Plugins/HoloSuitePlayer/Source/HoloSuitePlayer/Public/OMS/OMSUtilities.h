@@ -26,7 +26,14 @@
 class HOLOSUITEPLAYER_API OMSUtilities
 {
 public:
-	static int DecodeBinaryPixels(unsigned char* pixelBlock);
+	// Decodes the 24 bit frame number from one row of 96 RGBA8 pixels, see DecodeFrameNumber.
+	static int DecodeBinaryPixels(const unsigned char* pixelBlock);
+
+	// Decodes the 24 bit frame number stamped into the bottom right of OMS videos as a row of 4x4 pixel
+	// cells, most significant bit first. Pixels holds cellRows rows of stride pixels starting at the first
+	// cell. By default a cell is set when its first two pixels are white, bRobust instead majority votes
+	// over every pixel of the cell which tolerates compression noise.
+	static int DecodeFrameNumber(const FColor* pixels, int stride, int cellRows, bool bRobust = false);
 
 	// Attempts to find a media player texture inside the supplied material.
 	static UTexture* GetMediaPlayerTexture(UMaterialInterface* sourceMaterial);
@@ -9,7 +9,9 @@
 
 #include "HoloMeshSkeleton.h"
 
-#define OMS_VERSION 10
+#define OMS_VERSION 11
+#define OMS_MIN_VERSION 10
+#define OMS_RETARGET_KEYFRAME_VERSION 11
 #define OMS_BAD_VERSION -1
 #define OMS_READ_ERROR -2
 
@@ -112,12 +114,30 @@ typedef struct oms_header_t {
     bool has_retarget_data;
     uint8_t compression_level;
 
+    // Retarget bone channels are only stored on frames where they change, see oms_compute_retarget_keyframes.
+    bool retarget_keyframe_compression;
+
     uint32_t frame_count;
     sequence_table_entry* sequence_table_entries;
 } oms_header_t;
 
+// Caller supplied allocator for arena read sequences, see oms_read_sequence_arena.
+typedef struct oms_allocator_t {
+    void* (*alloc_func)(size_t size, void* user_data);
+    void (*free_func)(void* ptr, void* user_data);
+    void* user_data;
+} oms_allocator_t;
+
 typedef struct oms_sequence_extras_t {
     int* ssdr_weights_packed;
+
+    // Single block backing every array of the sequence when read with oms_read_sequence_arena, otherwise NULL.
+    void* arena;
+    size_t arena_size;
+    oms_allocator_t arena_allocator;
+
+    // Bounds of every ssdr frame, see oms_compute_frame_aabbs. NULL until computed, never part of the arena.
+    oms_aabb_t* frame_aabbs;
 } oms_sequence_extras_t;
 
 typedef struct oms_sequence_t {
@@ -152,6 +172,8 @@ typedef struct oms_sequence_t {
 
 typedef struct oms_write_sequences_options_t {
     bool use_packed_ssdr_weights;
+
+    // Unused, retarget keyframe compression follows oms_header_t::retarget_keyframe_compression.
     bool anim_keyframe_compression;
 } oms_write_sequences_options_t;
 
@@ -167,7 +189,7 @@ extern "C" {
 #endif // __cplusplus
 
     // Reads an oms_header_t from the buffer and returns number of bytes read.
-    // Returns OMS_BAD_VERSION if the version of the file does not match OMS_VERSION
+    // Returns OMS_BAD_VERSION if the version of the file is not between OMS_MIN_VERSION and OMS_VERSION
     LIB_OMS_DLLFLAGS size_t oms_read_header(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_out);
 
     // Parses the bytes in a buffer until the OMS data is found (this is used for when OMS data is packaged in an mp4)
@@ -178,6 +200,10 @@ extern "C" {
     // Read an oms_sequence_t from the buffer into an oms_sequence_t struct and returns number of bytes read.
     LIB_OMS_DLLFLAGS size_t oms_read_sequence(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in, oms_sequence_t* sequence_out);
 
+    // Same as oms_read_sequence but all of the sequence's arrays are carved out of one allocation made with the given
+    // allocator (malloc if NULL). The block is released by oms_free_sequence. Compressed sequences fall back to oms_read_sequence.
+    LIB_OMS_DLLFLAGS size_t oms_read_sequence_arena(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in, oms_sequence_t* sequence_out, oms_allocator_t* allocator);
+
     // Parses the bytes in a buffer until the OMS data is found (this is used for when OMS data is packaged in an mp4)
     // Read an oms_sequence_t from the buffer into an oms_sequence_t struct and returns number of bytes read.
     LIB_OMS_DLLFLAGS size_t oms_read_sequence_mp4(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in, oms_sequence_t* sequence_out);
@@ -191,6 +217,10 @@ extern "C" {
     // Returns the size in bytes of the sequence that will be output from oms_read_sequence.
     LIB_OMS_DLLFLAGS size_t oms_get_sequence_read_size(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size);
 
+    // Returns the size in bytes of the arena oms_read_sequence_arena allocates for the sequence in the buffer.
+    // Returns 0 for GZIP and ZSTD compressed sequences and OMS_READ_ERROR if the sequence runs past the buffer.
+    LIB_OMS_DLLFLAGS size_t oms_get_sequence_arena_size(uint8_t* buffer_in, size_t buffer_offset, size_t buffer_size, oms_header_t* header_in);
+
     // Returns the size in bytes of the sequence that will be output from oms_write_sequence.
     LIB_OMS_DLLFLAGS size_t oms_get_sequence_write_size(oms_header_t* header_in, oms_sequence_t* sequence_in);
 
@@ -214,6 +244,10 @@ extern "C" {
     // Internal. frees memory for a sequence's retargeting data
     LIB_OMS_DLLFLAGS void oms_free_retarget_data(oms_sequence_t* sequence);
 
+    // Flags the frames where each retarget bone's position or rotation moved more than the given tolerance since its
+    // last key. Rotation tolerance is in 1 - |dot|. Retarget data must have already been allocated.
+    LIB_OMS_DLLFLAGS void oms_compute_retarget_keyframes(oms_sequence_t* sequence, float position_tolerance, float rotation_tolerance);
+
     // Sets the name of the given bone. Retarget data must have already been allocated.
     LIB_OMS_DLLFLAGS void oms_set_retarget_bone_name(oms_sequence_t* sequence, int bone, char* name);
 
@@ -232,6 +266,10 @@ extern "C" {
     // Computes the AABB for the sequence and stores the result in its aabb parameter.
     LIB_OMS_DLLFLAGS void oms_sequence_compute_aabb(oms_sequence_t* sequence);
 
+    // Skins the keyframe by every ssdr frame and stores the bounds of each in extras.frame_aabbs.
+    // Does nothing for sequences with a single frame, their aabb already covers the only frame.
+    LIB_OMS_DLLFLAGS void oms_compute_frame_aabbs(oms_sequence_t* sequence);
+
     // Apply skinning to the keyframe. Required for one frame ssdr sequences as they will have no data written
     // or read, and so the transformation must be applied.
     LIB_OMS_DLLFLAGS void oms_apply_skinning(oms_sequence_t* sequence, oms_ssdr_frame_t ssdr_frame);
@@ -29,6 +29,7 @@ public class HoloSuitePlayerEditor : ModuleRules
 				"Engine",
 				"HoloSuitePlayer",
 				"HoloMesh",
+				"Json",
 				"Projects",
 				"RenderCore",
 				"RHI",
@@ -0,0 +1,527 @@
+// Copyright 2023 Arcturus Studios Holdings, Inc. All Rights Reserved.
+
+#include "HoloSuiteBenchmarkCommandlet.h"
+#include "HoloSuitePlayerEditor.h"
+
+#include "AVV/AVVDecoderCPU.h"
+#include "AVV/AVVFile.h"
+#include "HoloSuiteIO.h"
+#include "OMS/OMSFile.h"
+#include "OMS/OMSUtilities.h"
+#include "OMS/oms.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace HoloSuiteBenchmark
+{
+    void AddStageTime(TMap<FString, double>& StageSeconds, const TCHAR* Stage, double StartSeconds)
+    {
+        StageSeconds.FindOrAdd(Stage) += FPlatformTime::Seconds() - StartSeconds;
+    }
+
+    void FinalizeStages(const TMap<FString, double>& StageSeconds, FHoloSuiteBenchmarkResult& Result)
+    {
+        Result.StageMilliseconds.Reset();
+        for (const TPair<FString, double>& Stage : StageSeconds)
+        {
+            Result.StageMilliseconds.Add(Stage.Key, (Stage.Value * 1000.0) / FMath::Max(Result.FrameCount, 1));
+        }
+    }
+}
+
+UHoloSuiteBenchmarkCommandlet::UHoloSuiteBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UHoloSuiteBenchmarkCommandlet::Main(const FString& Params)
+{
+    FString FilesParam;
+    FString BaselinePath;
+    double Threshold = 0.1;
+    int Iterations = 1;
+
+    FParse::Value(*Params, TEXT("Files="), FilesParam, false);
+    FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+    FParse::Value(*Params, TEXT("Threshold="), Threshold);
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    bool bWriteBaseline = FParse::Param(*Params, TEXT("WriteBaseline"));
+
+    // Readers pick their IO backend from the console variable when a file is opened.
+    FString IOParam;
+    if (FParse::Value(*Params, TEXT("IO="), IOParam))
+    {
+        EHoloSuiteIOBackend IOBackend = EHoloSuiteIOBackend::BulkData;
+        for (EHoloSuiteIOBackend Type : { EHoloSuiteIOBackend::BulkData, EHoloSuiteIOBackend::File, EHoloSuiteIOBackend::Memory })
+        {
+            if (IOParam.Equals(HoloSuiteIO::LexToString(Type), ESearchCase::IgnoreCase))
+            {
+                IOBackend = Type;
+            }
+        }
+
+        IConsoleManager::Get().FindConsoleVariable(TEXT("r.HoloSuite.IO.Backend"))->Set((int32)IOBackend, ECVF_SetByCommandline);
+        UE_LOG(LogHoloSuitePlayerEditor, Display, TEXT("HoloSuiteBenchmark: reading through the %s IO backend"), HoloSuiteIO::LexToString(IOBackend));
+    }
+
+    TArray<FString> AssetPaths;
+    FilesParam.ParseIntoArray(AssetPaths, TEXT(","));
+    if (AssetPaths.Num() == 0)
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: no assets given, use -Files=/Game/Asset.Asset,..."));
+        return 1;
+    }
+
+    Iterations = FMath::Max(Iterations, 1);
+
+    TArray<FHoloSuiteBenchmarkResult> Results;
+    int Failures = 0;
+
+    if (!VerifyFrameNumberDecode())
+    {
+        Failures++;
+    }
+
+    for (const FString& AssetPath : AssetPaths)
+    {
+        UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
+        if (Asset == nullptr)
+        {
+            UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: failed to load %s"), *AssetPath);
+            Failures++;
+            continue;
+        }
+
+        // Keep the fastest run of each stage to reduce noise, decoded output must be identical every run.
+        FHoloSuiteBenchmarkResult Best;
+        bool bSuccess = true;
+        for (int i = 0; i < Iterations && bSuccess; ++i)
+        {
+            FHoloSuiteBenchmarkResult Result;
+            Result.AssetPath = AssetPath;
+
+            if (UAVVFile* AVVFile = Cast<UAVVFile>(Asset))
+            {
+                bSuccess = BenchmarkAVV(AVVFile, Result);
+            }
+            else if (UOMSFile* OMSFile = Cast<UOMSFile>(Asset))
+            {
+                bSuccess = BenchmarkOMS(OMSFile, Result);
+            }
+            else
+            {
+                UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: %s is not an AVV or OMS file."), *AssetPath);
+                bSuccess = false;
+            }
+
+            if (!bSuccess)
+            {
+                break;
+            }
+
+            if (i == 0)
+            {
+                Best = Result;
+                continue;
+            }
+
+            if (Result.Checksum != Best.Checksum)
+            {
+                UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: %s decoded differently between runs (%08x vs %08x)."), *AssetPath, Result.Checksum, Best.Checksum);
+                bSuccess = false;
+                break;
+            }
+
+            for (const TPair<FString, double>& Stage : Result.StageMilliseconds)
+            {
+                double& BestMilliseconds = Best.StageMilliseconds.FindOrAdd(Stage.Key, Stage.Value);
+                BestMilliseconds = FMath::Min(BestMilliseconds, Stage.Value);
+            }
+        }
+
+        if (!bSuccess)
+        {
+            Failures++;
+            continue;
+        }
+
+        UE_LOG(LogHoloSuitePlayerEditor, Display, TEXT("HoloSuiteBenchmark: %s frames: %d checksum: %08x"), *AssetPath, Best.FrameCount, Best.Checksum);
+        for (const TPair<FString, double>& Stage : Best.StageMilliseconds)
+        {
+            UE_LOG(LogHoloSuitePlayerEditor, Display, TEXT("    %s: %.3f ms/frame"), *Stage.Key, Stage.Value);
+        }
+
+        Results.Add(Best);
+    }
+
+    if (BaselinePath.IsEmpty())
+    {
+        return Failures > 0 ? 1 : 0;
+    }
+
+    if (bWriteBaseline)
+    {
+        FString Output;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+        if (!FJsonSerializer::Serialize(ToJson(Results).ToSharedRef(), Writer) || !FFileHelper::SaveStringToFile(Output, *BaselinePath))
+        {
+            UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: failed to write baseline %s"), *BaselinePath);
+            return 1;
+        }
+
+        UE_LOG(LogHoloSuitePlayerEditor, Display, TEXT("HoloSuiteBenchmark: wrote baseline %s"), *BaselinePath);
+        return Failures > 0 ? 1 : 0;
+    }
+
+    FString Input;
+    TSharedPtr<FJsonObject> Baseline;
+    if (!FFileHelper::LoadFileToString(Input, *BaselinePath) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Input), Baseline) || !Baseline.IsValid())
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: failed to read baseline %s"), *BaselinePath);
+        return 1;
+    }
+
+    Failures += CompareToBaseline(Results, Baseline, Threshold);
+    return Failures > 0 ? 1 : 0;
+}
+
+bool UHoloSuiteBenchmarkCommandlet::BenchmarkAVV(UAVVFile* AVVFile, FHoloSuiteBenchmarkResult& Result)
+{
+    // The decoder is never registered with the HoloMesh manager, only its reader
+    // and CPU decoding functions are used so no render resources are created.
+    UAVVDecoderCPU* Decoder = NewObject<UAVVDecoderCPU>(GetTransientPackage());
+    FAVVReader& Reader = Decoder->avvReader;
+
+    if (!Reader.Open(AVVFile))
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: failed to open %s"), *Result.AssetPath);
+        return false;
+    }
+
+    FHoloMesh Mesh;
+    Mesh.VertexBuffers->Create(Reader.Limits.MaxVertexCount, 1, true);
+    Mesh.IndexBuffer->Create(Reader.Limits.MaxIndexCount, false, true);
+    Mesh.bInitialized = true;
+
+    Decoder->DecodedVertexData = new uint8_t[Reader.Limits.MaxVertexCount * 32];
+
+    TMap<FString, double> StageSeconds;
+    uint32 Checksum = 0;
+    int DecodedSegmentIndex = -1;
+    bool bSuccess = true;
+
+    for (int FrameNumber = 0; FrameNumber < Reader.FrameCount; ++FrameNumber)
+    {
+        int SegmentIndex = Reader.GetSegmentIndex(FrameNumber);
+        bool bNewSegment = (SegmentIndex != DecodedSegmentIndex);
+
+        double Start = FPlatformTime::Seconds();
+        Reader.AddRequest(bNewSegment ? SegmentIndex : -1, FrameNumber, EAVVDecodeFlags::All, true);
+        FAVVReaderRequestRef Request = Reader.GetFinishedRequest();
+        HoloSuiteBenchmark::AddStageTime(StageSeconds, TEXT("Read"), Start);
+
+        if (!Request.IsValid() || Request->frame == nullptr || (bNewSegment && Request->segment == nullptr))
+        {
+            UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: failed to read frame %d of %s"), FrameNumber, *Result.AssetPath);
+            bSuccess = false;
+            break;
+        }
+
+        if (bNewSegment)
+        {
+            AVVEncodedSegment* Segment = Request->segment;
+
+            Start = FPlatformTime::Seconds();
+            Decoder->CPUDecodeMesh(&Mesh, Segment);
+            HoloSuiteBenchmark::AddStageTime(StageSeconds, TEXT("DecodeMesh"), Start);
+
+            Decoder->DecodedSegmentVertexCount = Segment->vertexCount;
+            DecodedSegmentIndex = SegmentIndex;
+
+            uint32 IndexStride = Mesh.IndexBuffer->Use32Bit() ? sizeof(uint32) : sizeof(uint16);
+            Checksum = FCrc::MemCrc32(Decoder->DecodedVertexData, Segment->vertexCount * 32, Checksum);
+            Checksum = FCrc::MemCrc32(Mesh.VertexBuffers->GetPositionData()->GetDataPointer(), Segment->vertexCount * sizeof(FPositionVertex), Checksum);
+            Checksum = FCrc::MemCrc32(Mesh.VertexBuffers->GetTangentsData()->GetDataPointer(), Segment->vertexCount * 2 * sizeof(FPackedNormal), Checksum);
+            Checksum = FCrc::MemCrc32(Mesh.VertexBuffers->GetTexCoordData()->GetDataPointer(), Segment->vertexCount * Mesh.VertexBuffers->GetNumTexCoords() * sizeof(FVector2DHalf), Checksum);
+            Checksum = FCrc::MemCrc32(Mesh.IndexBuffer->GetIndexData32(), Segment->indexCount * IndexStride, Checksum);
+        }
+
+        AVVEncodedFrame* Frame = Request->frame;
+        if (Frame->colorCount > 0)
+        {
+            Start = FPlatformTime::Seconds();
+            if (Frame->normalCount > 0)
+            {
+                Decoder->CPUDecodeFrameColorsNormals(&Mesh, Frame);
+            }
+            else
+            {
+                Decoder->CPUDecodeFrameColors(&Mesh, Frame);
+            }
+            HoloSuiteBenchmark::AddStageTime(StageSeconds, TEXT("DecodeColors"), Start);
+
+            Checksum = FCrc::MemCrc32(Mesh.VertexBuffers->GetColorData()->GetDataPointer(), Decoder->DecodedSegmentVertexCount * 4, Checksum);
+        }
+
+        // Both CPU luma outputs, see r.AVV.CPULumaDecode. The reader leaves blocks as BC4 so
+        // only the decode itself is timed.
+        if (Frame->blockDecode && Frame->blockCount > 0)
+        {
+            Start = FPlatformTime::Seconds();
+            FAVVReader::DecodeFrameLuma(Frame, EAVVLumaFormat::R8);
+            HoloSuiteBenchmark::AddStageTime(StageSeconds, TEXT("DecodeLuma"), Start);
+
+            Checksum = FCrc::MemCrc32(Frame->decodedLumaContent->Data, Frame->blockCount * 16, Checksum);
+
+            Start = FPlatformTime::Seconds();
+            FAVVReader::DecodeFrameLuma(Frame, EAVVLumaFormat::EAC);
+            HoloSuiteBenchmark::AddStageTime(StageSeconds, TEXT("TranscodeLuma"), Start);
+
+            Checksum = FCrc::MemCrc32(Frame->decodedLumaContent->Data, Frame->blockCount * 8, Checksum);
+        }
+
+        Result.FrameCount++;
+    }
+
+    Decoder->Close();
+    Reader.Close();
+
+    Result.Checksum = Checksum;
+    HoloSuiteBenchmark::FinalizeStages(StageSeconds, Result);
+    return bSuccess && Result.FrameCount > 0;
+}
+
+bool UHoloSuiteBenchmarkCommandlet::BenchmarkOMS(UOMSFile* OMSFile, FHoloSuiteBenchmarkResult& Result)
+{
+    FStreamableOMSData* OMSStreamableData = &(FStreamableOMSData&)OMSFile->GetStreamableData();
+
+    TMap<FString, double> StageSeconds;
+    uint32 Checksum = 0;
+
+    FHoloSuiteIOBackendRef IOBackend = HoloSuiteIO::CreateDefaultBackend();
+    if (IOBackend->GetType() == EHoloSuiteIOBackend::Memory)
+    {
+        for (const FOMSStreamableChunk& Chunk : OMSStreamableData->Chunks)
+        {
+            IOBackend->Preload(Chunk.BulkData);
+        }
+    }
+
+    oms_header_t Header = {};
+    double Start = FPlatformTime::Seconds();
+    OMSStreamableData->ReadHeaderSync(&Header);
+    HoloSuiteBenchmark::AddStageTime(StageSeconds, TEXT("ReadHeader"), Start);
+
+    if (Header.sequence_count <= 0 || Header.sequence_count > OMSStreamableData->Chunks.Num())
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: invalid OMS header in %s"), *Result.AssetPath);
+        oms_free_header(&Header);
+        return false;
+    }
+
+    for (int SequenceIndex = 0; SequenceIndex < Header.sequence_count; ++SequenceIndex)
+    {
+        oms_sequence_t Sequence = {};
+
+        Start = FPlatformTime::Seconds();
+        OMSStreamableData->Chunks[SequenceIndex].ReadSequenceSync(&Header, &Sequence, IOBackend.Get());
+        HoloSuiteBenchmark::AddStageTime(StageSeconds, TEXT("ReadSequence"), Start);
+
+        Checksum = FCrc::MemCrc32(Sequence.vertices, Sequence.vertex_count * sizeof(oms_vec3_t), Checksum);
+        Checksum = FCrc::MemCrc32(Sequence.normals, Sequence.normal_count * sizeof(oms_vec3_t), Checksum);
+        Checksum = FCrc::MemCrc32(Sequence.uvs, Sequence.uv_count * sizeof(oms_vec2_t), Checksum);
+        Checksum = FCrc::MemCrc32(Sequence.indices, Sequence.index_count * oms_bytes_per_index(Sequence.vertex_count), Checksum);
+
+        for (int i = 0; i < Sequence.ssdr_frame_count; ++i)
+        {
+            Checksum = FCrc::MemCrc32(Sequence.ssdr_frames[i].matrices, Sequence.ssdr_bone_count * sizeof(oms_matrix4x4_t), Checksum);
+        }
+        for (int i = 0; i < Sequence.delta_frame_count; ++i)
+        {
+            Checksum = FCrc::MemCrc32(Sequence.delta_frames[i].vertices, Sequence.vertex_count * sizeof(oms_vec3_t), Checksum);
+        }
+        for (int i = 0; Header.has_retarget_data && i < Sequence.ssdr_frame_count; ++i)
+        {
+            Checksum = FCrc::MemCrc32(Sequence.retarget_data.bone_positions[i], Sequence.retarget_data.bone_count * sizeof(oms_vec3_t), Checksum);
+            Checksum = FCrc::MemCrc32(Sequence.retarget_data.bone_rotations[i], Sequence.retarget_data.bone_count * sizeof(oms_quaternion_t), Checksum);
+        }
+
+        Result.FrameCount += (Header.compression_level == OMS_COMPRESSION_DELTA) ? Sequence.delta_frame_count : Sequence.ssdr_frame_count;
+        oms_free_sequence(&Sequence);
+    }
+
+    oms_free_header(&Header);
+
+    Result.Checksum = Checksum;
+    HoloSuiteBenchmark::FinalizeStages(StageSeconds, Result);
+    return Result.FrameCount > 0;
+}
+
+bool UHoloSuiteBenchmarkCommandlet::VerifyFrameNumberDecode()
+{
+    // Matches the readback in UOMSDecoder, 24 cells of 4x4 pixels followed by padding.
+    const int Stride = 98;
+    const int Rows = 4;
+    const int FrameCount = 10000;
+
+    TArray<FColor> Pixels;
+    TArray<uint8> RowBytes;
+    Pixels.SetNumUninitialized(Stride * Rows);
+    RowBytes.SetNumUninitialized(96 * 4);
+
+    FRandomStream Random(0x4f4d53);
+    double DecodeSeconds = 0.0;
+    int Mismatches = 0;
+
+    for (int i = 0; i < FrameCount; ++i)
+    {
+        int FrameNumber = (i < 2) ? (i == 0 ? 0 : 0xFFFFFF) : Random.RandRange(0, 0xFFFFFF);
+        bool bNoisy = (i & 1) != 0;
+
+        for (int y = 0; y < Rows; ++y)
+        {
+            for (int x = 0; x < Stride; ++x)
+            {
+                int Bit = x / 4;
+                bool bSet = Bit < 24 && ((FrameNumber >> (23 - Bit)) & 1) != 0;
+                uint8 Value = bSet ? 235 : 16;
+
+                // Compression noise, flips a few pixels of a cell but never the majority.
+                if (bNoisy && Bit < 24 && x % 4 == y)
+                {
+                    Value = bSet ? 40 : 220;
+                }
+
+                Pixels[y * Stride + x] = FColor(Value, Value, Value, 255);
+            }
+        }
+
+        double StartSeconds = FPlatformTime::Seconds();
+        int Robust = OMSUtilities::DecodeFrameNumber(Pixels.GetData(), Stride, Rows, true);
+        DecodeSeconds += FPlatformTime::Seconds() - StartSeconds;
+
+        if (Robust != FrameNumber)
+        {
+            Mismatches++;
+        }
+
+        if (bNoisy)
+        {
+            continue;
+        }
+
+        // The fast path and the byte based decode must agree on clean frames.
+        for (int x = 0; x < 96; ++x)
+        {
+            const FColor& Color = Pixels[x];
+            RowBytes[(x * 4) + 0] = Color.R;
+            RowBytes[(x * 4) + 1] = Color.G;
+            RowBytes[(x * 4) + 2] = Color.B;
+            RowBytes[(x * 4) + 3] = Color.A;
+        }
+
+        if (OMSUtilities::DecodeFrameNumber(Pixels.GetData(), Stride, Rows) != FrameNumber || OMSUtilities::DecodeBinaryPixels(RowBytes.GetData()) != FrameNumber)
+        {
+            Mismatches++;
+        }
+    }
+
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: OMS frame number decode failed on %d of %d frames."), Mismatches, FrameCount);
+        return false;
+    }
+
+    UE_LOG(LogHoloSuitePlayerEditor, Display, TEXT("HoloSuiteBenchmark: OMS frame number decode %.3f us/frame (robust)"), (DecodeSeconds * 1000000.0) / FrameCount);
+    return true;
+}
+
+int UHoloSuiteBenchmarkCommandlet::CompareToBaseline(const TArray<FHoloSuiteBenchmarkResult>& Results, const TSharedPtr<FJsonObject>& Baseline, double Threshold)
+{
+    int Regressions = 0;
+
+    const TSharedPtr<FJsonObject>* Assets = nullptr;
+    if (!Baseline->TryGetObjectField(TEXT("Assets"), Assets))
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: baseline has no Assets entry."));
+        return 1;
+    }
+
+    for (const FHoloSuiteBenchmarkResult& Result : Results)
+    {
+        const TSharedPtr<FJsonObject>* Entry = nullptr;
+        if (!(*Assets)->TryGetObjectField(Result.AssetPath, Entry))
+        {
+            UE_LOG(LogHoloSuitePlayerEditor, Warning, TEXT("HoloSuiteBenchmark: %s is missing from the baseline."), *Result.AssetPath);
+            continue;
+        }
+
+        // Checksums are stored as strings since JSON numbers are doubles.
+        FString BaselineChecksum = (*Entry)->GetStringField(TEXT("Checksum"));
+        FString Checksum = FString::Printf(TEXT("%08x"), Result.Checksum);
+        if (BaselineChecksum != Checksum)
+        {
+            UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: %s checksum mismatch, expected %s got %s"), *Result.AssetPath, *BaselineChecksum, *Checksum);
+            Regressions++;
+        }
+
+        const TSharedPtr<FJsonObject>* Stages = nullptr;
+        if (!(*Entry)->TryGetObjectField(TEXT("Stages"), Stages))
+        {
+            continue;
+        }
+
+        for (const TPair<FString, double>& Stage : Result.StageMilliseconds)
+        {
+            double BaselineMilliseconds = 0.0;
+            if (!(*Stages)->TryGetNumberField(Stage.Key, BaselineMilliseconds))
+            {
+                continue;
+            }
+
+            if (Stage.Value > BaselineMilliseconds * (1.0 + Threshold))
+            {
+                UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteBenchmark: %s %s regressed, %.3f ms/frame vs baseline %.3f ms/frame"), *Result.AssetPath, *Stage.Key, Stage.Value, BaselineMilliseconds);
+                Regressions++;
+            }
+        }
+    }
+
+    if (Regressions == 0)
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Display, TEXT("HoloSuiteBenchmark: all assets match the baseline."));
+    }
+
+    return Regressions;
+}
+
+TSharedPtr<FJsonObject> UHoloSuiteBenchmarkCommandlet::ToJson(const TArray<FHoloSuiteBenchmarkResult>& Results)
+{
+    TSharedPtr<FJsonObject> Assets = MakeShared<FJsonObject>();
+    for (const FHoloSuiteBenchmarkResult& Result : Results)
+    {
+        TSharedPtr<FJsonObject> Stages = MakeShared<FJsonObject>();
+        for (const TPair<FString, double>& Stage : Result.StageMilliseconds)
+        {
+            Stages->SetNumberField(Stage.Key, Stage.Value);
+        }
+
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("Checksum"), FString::Printf(TEXT("%08x"), Result.Checksum));
+        Entry->SetNumberField(TEXT("FrameCount"), Result.FrameCount);
+        Entry->SetObjectField(TEXT("Stages"), Stages);
+        Assets->SetObjectField(Result.AssetPath, Entry);
+    }
+
+    TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetObjectField(TEXT("Assets"), Assets);
+    return Root;
+}
@@ -0,0 +1,940 @@
+// Copyright 2023 Arcturus Studios Holdings, Inc. All Rights Reserved.
+
+#include "HoloSuiteSyntheticAssetCommandlet.h"
+#include "HoloSuitePlayerEditor.h"
+
+#include "AVV/AVVFormat.h"
+#include "HoloMeshUtilities.h"
+#include "OMS/oms.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace HoloSuiteSynthetic
+{
+    // Roughly the size of a captured performer, in meters.
+    const float Radius = 0.3f;
+    const float Height = 1.8f;
+    const float FramesPerCycle = 30.0f;
+
+    // Coarser LOD, its triangles only reference the first VertexCount vertices.
+    struct FMeshLOD
+    {
+        uint32 VertexCount = 0;
+        TArray<uint32> Indices;
+    };
+
+    struct FMesh
+    {
+        int Columns = 0;
+        int Rows = 0;
+        TArray<FHoloMeshVec3> Positions;
+        TArray<FHoloMeshVec3> Normals;
+        TArray<FHoloMeshVec2> UVs;
+        TArray<uint32> Indices;
+        TArray<FMeshLOD> LODs;
+        FHoloMeshVec3 AABBMin;
+        FHoloMeshVec3 AABBMax;
+    };
+
+    // Coarsest LOD a row or column is kept at, every LOD drops every other line of the one before
+    // it. The last line is always kept so coarser LODs cover the same surface.
+    int GridLineLOD(int Line, int LineCount, int LODCount)
+    {
+        if (Line == LineCount - 1)
+        {
+            return LODCount;
+        }
+
+        int LOD = 0;
+        while (LOD < LODCount && (Line % (2 << LOD)) == 0)
+        {
+            ++LOD;
+        }
+        return LOD;
+    }
+
+    // Triangles between the rows and columns kept at a LOD.
+    void AddGridTriangles(const FMesh& Mesh, const TArray<uint32>& VertexIndices, int LOD, int LODCount, TArray<uint32>& Indices)
+    {
+        TArray<int> Rows;
+        TArray<int> Columns;
+        for (int r = 0; r < Mesh.Rows; ++r)
+        {
+            if (GridLineLOD(r, Mesh.Rows, LODCount) >= LOD)
+            {
+                Rows.Add(r);
+            }
+        }
+        for (int c = 0; c < Mesh.Columns; ++c)
+        {
+            if (GridLineLOD(c, Mesh.Columns, LODCount) >= LOD)
+            {
+                Columns.Add(c);
+            }
+        }
+
+        for (int r = 0; r < Rows.Num() - 1; ++r)
+        {
+            for (int c = 0; c < Columns.Num() - 1; ++c)
+            {
+                uint32 I0 = VertexIndices[(Rows[r] * Mesh.Columns) + Columns[c]];
+                uint32 I1 = VertexIndices[(Rows[r] * Mesh.Columns) + Columns[c + 1]];
+                uint32 I2 = VertexIndices[(Rows[r + 1] * Mesh.Columns) + Columns[c]];
+                uint32 I3 = VertexIndices[(Rows[r + 1] * Mesh.Columns) + Columns[c + 1]];
+
+                Indices.Append({ I0, I2, I1, I1, I2, I3 });
+            }
+        }
+    }
+
+    // Open cylinder with Y up, the UV seam duplicates the first column. With LODs the vertices
+    // are ordered coarsest first so every LOD's vertices are a prefix of the ones before it.
+    void BuildMesh(int VertexCount, int LODCount, FMesh& Mesh)
+    {
+        // Columns are kept even so the vertex count is too, AVV_SEGMENT_POS_16 stores vertices in pairs.
+        Mesh.Columns = FMath::Max(4, FMath::RoundToInt(FMath::Sqrt((float)VertexCount)) & ~1);
+        Mesh.Rows = FMath::Max(2, VertexCount / Mesh.Columns);
+
+        // Grid vertex to its LOD, stable so without LODs the vertices stay in row order.
+        TArray<int> GridLODs;
+        TArray<uint32> GridOrder;
+        for (int r = 0; r < Mesh.Rows; ++r)
+        {
+            for (int c = 0; c < Mesh.Columns; ++c)
+            {
+                GridLODs.Add(FMath::Min(GridLineLOD(r, Mesh.Rows, LODCount), GridLineLOD(c, Mesh.Columns, LODCount)));
+                GridOrder.Add(GridOrder.Num());
+            }
+        }
+        GridOrder.StableSort([&GridLODs](uint32 A, uint32 B) { return GridLODs[A] > GridLODs[B]; });
+
+        TArray<uint32> VertexIndices;
+        VertexIndices.SetNumUninitialized(GridOrder.Num());
+        for (int v = 0; v < GridOrder.Num(); ++v)
+        {
+            int r = GridOrder[v] / Mesh.Columns;
+            int c = GridOrder[v] % Mesh.Columns;
+            VertexIndices[GridOrder[v]] = v;
+
+            float U = (float)c / (float)(Mesh.Columns - 1);
+            float V = (float)r / (float)(Mesh.Rows - 1);
+            float Angle = U * 2.0f * PI;
+
+            FHoloMeshVec3 Normal(FMath::Cos(Angle), 0.0f, FMath::Sin(Angle));
+            Mesh.Positions.Add(FHoloMeshVec3(Normal.X * Radius, V * Height, Normal.Z * Radius));
+            Mesh.Normals.Add(Normal);
+            Mesh.UVs.Add(FHoloMeshVec2(U, V));
+        }
+
+        AddGridTriangles(Mesh, VertexIndices, 0, LODCount, Mesh.Indices);
+
+        for (int LOD = 1; LOD <= LODCount; ++LOD)
+        {
+            FMeshLOD& MeshLOD = Mesh.LODs.AddDefaulted_GetRef();
+            for (int GridLOD : GridLODs)
+            {
+                MeshLOD.VertexCount += (GridLOD >= LOD) ? 1 : 0;
+            }
+            AddGridTriangles(Mesh, VertexIndices, LOD, LODCount, MeshLOD.Indices);
+        }
+
+        Mesh.AABBMin = FHoloMeshVec3(-Radius, 0.0f, -Radius);
+        Mesh.AABBMax = FHoloMeshVec3(Radius, Height, Radius);
+    }
+
+    float Phase(int Frame)
+    {
+        return 2.0f * PI * (float)Frame / FramesPerCycle;
+    }
+
+    // Bones are stacked along the height of the mesh and twist around the Y axis.
+    float BoneAngle(int Bone, int Frame)
+    {
+        return 0.25f * FMath::Sin(Phase(Frame) + (float)Bone * 0.5f);
+    }
+
+    // Row major rotation around Y. There is no translation, so reading it column major
+    // only flips the direction of the twist.
+    void BoneMatrix(int Bone, int Frame, float Out[16])
+    {
+        float Angle = BoneAngle(Bone, Frame);
+        float C = FMath::Cos(Angle);
+        float S = FMath::Sin(Angle);
+
+        const float Matrix[16] = {
+               C, 0.0f,    S, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+              -S, 0.0f,    C, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
+        FMemory::Memcpy(Out, Matrix, sizeof(Matrix));
+    }
+
+    // Blends between the two nearest bones, heaviest first.
+    void BoneWeights(float V, int BoneCount, uint8 IndicesOut[2], float WeightsOut[2])
+    {
+        float BonePosition = FMath::Clamp(V * BoneCount - 0.5f, 0.0f, (float)(BoneCount - 1));
+        int Bone0 = FMath::FloorToInt(BonePosition);
+        int Bone1 = FMath::Min(Bone0 + 1, BoneCount - 1);
+        float Weight1 = BonePosition - Bone0;
+
+        if (Weight1 > 0.5f)
+        {
+            IndicesOut[0] = Bone1;
+            IndicesOut[1] = Bone0;
+            WeightsOut[0] = Weight1;
+            WeightsOut[1] = 1.0f - Weight1;
+        }
+        else
+        {
+            IndicesOut[0] = Bone0;
+            IndicesOut[1] = Bone1;
+            WeightsOut[0] = 1.0f - Weight1;
+            WeightsOut[1] = Weight1;
+        }
+    }
+
+    // Retarget rig is a chain up the mesh. Only every other joint rotates, which leaves static
+    // channels for keyframe compression to drop.
+    void RetargetBoneTransform(int Bone, int BoneCount, int Frame, oms_vec3_t& PositionOut, oms_quaternion_t& RotationOut)
+    {
+        PositionOut = { { 0.0f, (Bone == 0) ? 0.0f : Height / BoneCount, 0.0f } };
+
+        float HalfAngle = (Bone % 2 == 0) ? 0.5f * BoneAngle(Bone, Frame) : 0.0f;
+        RotationOut = { { 0.0f, FMath::Sin(HalfAngle), 0.0f, FMath::Cos(HalfAngle) } };
+    }
+
+    // Radial ripple travelling up the mesh.
+    FHoloMeshVec3 Delta(const FMesh& Mesh, int Vertex, int Frame)
+    {
+        float Offset = 0.02f * FMath::Sin(Phase(Frame) + Mesh.UVs[Vertex].Y * 4.0f * PI);
+        return FHoloMeshVec3(Mesh.Normals[Vertex].X * Offset, 0.01f * FMath::Sin(Phase(Frame)), Mesh.Normals[Vertex].Z * Offset);
+    }
+
+    FHoloMeshVec3 FrameNormal(const FMesh& Mesh, int Vertex, int Frame, EHoloSuiteSyntheticAnimation Animation, int BoneCount)
+    {
+        FHoloMeshVec3 Normal = Mesh.Normals[Vertex];
+        if (Animation != EHoloSuiteSyntheticAnimation::SSDR)
+        {
+            return Normal;
+        }
+
+        uint8 Bones[2];
+        float Weights[2];
+        BoneWeights(Mesh.UVs[Vertex].Y, BoneCount, Bones, Weights);
+        float Angle = (BoneAngle(Bones[0], Frame) * Weights[0]) + (BoneAngle(Bones[1], Frame) * Weights[1]);
+
+        float C = FMath::Cos(Angle);
+        float S = FMath::Sin(Angle);
+        return FHoloMeshVec3((C * Normal.X) + (S * Normal.Z), Normal.Y, (-S * Normal.X) + (C * Normal.Z));
+    }
+
+    // Animated position, blended the same way as FrameNormal.
+    FHoloMeshVec3 FramePosition(const FMesh& Mesh, int Vertex, int Frame, EHoloSuiteSyntheticAnimation Animation, int BoneCount)
+    {
+        FHoloMeshVec3 Position = Mesh.Positions[Vertex];
+        if (Animation == EHoloSuiteSyntheticAnimation::Delta)
+        {
+            return Position + Delta(Mesh, Vertex, Frame);
+        }
+
+        if (Animation != EHoloSuiteSyntheticAnimation::SSDR)
+        {
+            return Position;
+        }
+
+        uint8 Bones[2];
+        float Weights[2];
+        BoneWeights(Mesh.UVs[Vertex].Y, BoneCount, Bones, Weights);
+
+        FHoloMeshVec3 Result(0.0f);
+        for (int i = 0; i < 2; ++i)
+        {
+            float Angle = BoneAngle(Bones[i], Frame);
+            float C = FMath::Cos(Angle);
+            float S = FMath::Sin(Angle);
+            Result += FHoloMeshVec3((C * Position.X) + (S * Position.Z), Position.Y, (-S * Position.X) + (C * Position.Z)) * Weights[i];
+        }
+        return Result;
+    }
+
+    uint32 Quantize(float Value, float Min, float Max, uint32 MaxValue)
+    {
+        float ZeroOne = (Max > Min) ? (Value - Min) / (Max - Min) : 0.0f;
+        return (uint32)FMath::RoundToInt(FMath::Clamp(ZeroOne, 0.0f, 1.0f) * MaxValue);
+    }
+
+    uint16 Color565(const FHoloMeshVec2& UV, int Frame)
+    {
+        uint32 R = Quantize(UV.X, 0.0f, 1.0f, 31);
+        uint32 G = Quantize(UV.Y, 0.0f, 1.0f, 63);
+        uint32 B = Quantize(FMath::Sin(Phase(Frame)), -1.0f, 1.0f, 31);
+        return (uint16)((R << 11) | (G << 5) | B);
+    }
+
+    uint16 NormalOct16(FHoloMeshVec3 N)
+    {
+        N /= (FMath::Abs(N.X) + FMath::Abs(N.Y) + FMath::Abs(N.Z));
+        float X = N.X;
+        float Y = N.Y;
+        if (N.Z < 0.0f)
+        {
+            X = (1.0f - FMath::Abs(N.Y)) * (N.X >= 0.0f ? 1.0f : -1.0f);
+            Y = (1.0f - FMath::Abs(N.X)) * (N.Y >= 0.0f ? 1.0f : -1.0f);
+        }
+        return (uint16)(Quantize(X, -1.0f, 1.0f, 255) | (Quantize(Y, -1.0f, 1.0f, 255) << 8));
+    }
+
+    // Scrolling gradient, endpoints followed by 16 3 bit selectors.
+    uint64 LumaBlockBC4(uint32 Block, int Frame)
+    {
+        uint64 LumaMin = (uint8)((Block + Frame) & 0xDF);
+        return LumaMin | ((LumaMin + 32) << 8) | ((uint64)0x4688 << 16) | ((uint64)0x7B5A2CF1 << 32);
+    }
+
+    // Largest per pixel luma difference between two BC4 blocks, see decodeBC4Block in AVVCommon.ush.
+    int LumaBlockDifference(uint64 BlockA, uint64 BlockB)
+    {
+        auto Decode = [](uint64 Block, int Out[16])
+        {
+            int Palette[8];
+            Palette[0] = Block & 0xFF;
+            Palette[1] = (Block >> 8) & 0xFF;
+            if (Palette[0] > Palette[1])
+            {
+                for (int i = 1; i < 7; ++i)
+                {
+                    Palette[i + 1] = ((7 - i) * Palette[0] + i * Palette[1]) / 7;
+                }
+            }
+            else
+            {
+                for (int i = 1; i < 5; ++i)
+                {
+                    Palette[i + 1] = ((5 - i) * Palette[0] + i * Palette[1]) / 5;
+                }
+                Palette[6] = 0;
+                Palette[7] = 255;
+            }
+
+            for (int i = 0; i < 16; ++i)
+            {
+                Out[i] = Palette[(Block >> (16 + (i * 3))) & 0x07];
+            }
+        };
+
+        int LumaA[16];
+        int LumaB[16];
+        Decode(BlockA, LumaA);
+        Decode(BlockB, LumaB);
+
+        int Difference = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            Difference = FMath::Max(Difference, FMath::Abs(LumaA[i] - LumaB[i]));
+        }
+        return Difference;
+    }
+
+    // Serializes AVV containers, sizes are patched in once the container is finished.
+    class FAVVWriter
+    {
+    public:
+        TArray<uint8> Data;
+
+        template <typename T>
+        void Write(const T& Value)
+        {
+            Data.Append((const uint8*)&Value, sizeof(T));
+        }
+
+        int32 BeginContainer(uint32 ContainerType)
+        {
+            Write(ContainerType);
+            Write((uint32)0);
+            return Data.Num();
+        }
+
+        void EndContainer(int32 ContainerStart)
+        {
+            uint32 ContainerSize = Data.Num() - ContainerStart;
+            FMemory::Memcpy(&Data[ContainerStart - sizeof(uint32)], &ContainerSize, sizeof(uint32));
+        }
+    };
+}
+
+UHoloSuiteSyntheticAssetCommandlet::UHoloSuiteSyntheticAssetCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UHoloSuiteSyntheticAssetCommandlet::Main(const FString& Params)
+{
+    FString Output;
+    FString AnimationName = TEXT("SSDR");
+    FHoloSuiteSyntheticAssetSettings Settings;
+
+    FParse::Value(*Params, TEXT("Output="), Output);
+    FParse::Value(*Params, TEXT("Vertices="), Settings.VertexCount);
+    FParse::Value(*Params, TEXT("Frames="), Settings.FrameCount);
+    FParse::Value(*Params, TEXT("SegmentLength="), Settings.SegmentLength);
+    FParse::Value(*Params, TEXT("Bones="), Settings.BoneCount);
+    FParse::Value(*Params, TEXT("GeometryLODs="), Settings.GeometryLODs);
+    FParse::Value(*Params, TEXT("TextureSize="), Settings.TextureSize);
+    FParse::Value(*Params, TEXT("TextureRefresh="), Settings.TextureRefreshInterval);
+    FParse::Value(*Params, TEXT("TextureThreshold="), Settings.TextureDeltaThreshold);
+    FParse::Value(*Params, TEXT("Animation="), AnimationName);
+    FParse::Value(*Params, TEXT("RetargetBones="), Settings.RetargetBoneCount);
+    Settings.bRetargetKeyframeCompression = !FParse::Param(*Params, TEXT("NoRetargetKeyframes"));
+
+    if (AnimationName == TEXT("None"))
+    {
+        Settings.Animation = EHoloSuiteSyntheticAnimation::None;
+    }
+    else if (AnimationName == TEXT("Delta"))
+    {
+        Settings.Animation = EHoloSuiteSyntheticAnimation::Delta;
+    }
+    else
+    {
+        Settings.Animation = EHoloSuiteSyntheticAnimation::SSDR;
+    }
+
+    // Bone indices are stored in a byte.
+    Settings.FrameCount = FMath::Max(Settings.FrameCount, 1);
+    Settings.SegmentLength = FMath::Clamp(Settings.SegmentLength, 1, Settings.FrameCount);
+    Settings.BoneCount = FMath::Clamp(Settings.BoneCount, 1, 256);
+    Settings.GeometryLODs = FMath::Clamp(Settings.GeometryLODs, 0, HOLOMESH_MAX_LODS - 1);
+    Settings.RetargetBoneCount = FMath::Max(Settings.RetargetBoneCount, 0);
+
+    FString Extension = FPaths::GetExtension(Output);
+    bool bSuccess = false;
+    if (Extension == TEXT("avv"))
+    {
+        bSuccess = WriteAVV(Output, Settings);
+    }
+    else if (Extension == TEXT("oms"))
+    {
+        bSuccess = WriteOMS(Output, Settings);
+    }
+    else
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteSyntheticAsset: -Output must be an .avv or .oms file."));
+        return 1;
+    }
+
+    if (!bSuccess)
+    {
+        UE_LOG(LogHoloSuitePlayerEditor, Error, TEXT("HoloSuiteSyntheticAsset: failed to write %s"), *Output);
+        return 1;
+    }
+
+    UE_LOG(LogHoloSuitePlayerEditor, Display, TEXT("HoloSuiteSyntheticAsset: wrote %s (%lld bytes)"), *Output, IFileManager::Get().FileSize(*Output));
+    return 0;
+}
+
+bool UHoloSuiteSyntheticAssetCommandlet::WriteAVV(const FString& Filename, const FHoloSuiteSyntheticAssetSettings& Settings)
+{
+    using namespace HoloSuiteSynthetic;
+
+    FMesh Mesh;
+    BuildMesh(Settings.VertexCount, Settings.GeometryLODs, Mesh);
+
+    uint32 VertexCount = Mesh.Positions.Num();
+    uint32 IndexCount = Mesh.Indices.Num();
+    bool bIndex32Bit = VertexCount > (UINT16_MAX + 1);
+    bool bSSDR = (Settings.Animation == EHoloSuiteSyntheticAnimation::SSDR);
+
+    // Textures are made of 4x4 BC4 blocks and every block is present.
+    uint32 TextureSize = (FMath::Max(Settings.TextureSize, 0) / 4) * 4;
+    uint32 TextureBlockCount = (TextureSize / 4) * (TextureSize / 4);
+
+    int SegmentCount = FMath::DivideAndRoundUp(Settings.FrameCount, Settings.SegmentLength);
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+    if (!Writer)
+    {
+        return false;
+    }
+
+    const char HeaderTag[4] = { 'A', 'V', 'V', ' ' };
+    uint32 Version = AVV_VERSION;
+    Writer->Serialize((void*)HeaderTag, sizeof(HeaderTag));
+    Writer->Serialize(&Version, sizeof(uint32));
+
+    // The meta data is only complete once every segment is written. Its size is known
+    // up front so space is reserved here and it's filled in at the end.
+    std::vector<AVVSegmentTableEntry> SegmentTable(SegmentCount);
+    AVVLimits Limits = {};
+    Limits.MaxVertexCount = VertexCount;
+    Limits.MaxIndexCount = IndexCount;
+    Limits.MaxFrameCount = Settings.SegmentLength;
+    Limits.MaxBoneCount = bSSDR ? Settings.BoneCount : 0;
+    Limits.MaxTextureWidth = TextureSize;
+    Limits.MaxTextureHeight = TextureSize;
+    Limits.MaxTextureTriangles = 0;
+    Limits.MaxTextureBlocks = TextureBlockCount;
+    Limits.MaxLumaPixels = TextureSize * TextureSize;
+
+    auto BuildMetaData = [&SegmentTable, &Limits]()
+    {
+        FAVVWriter Meta;
+        Meta.Write((uint32)2);
+
+        int32 ContainerStart = Meta.BeginContainer(AVV_META_SEGMENT_TABLE);
+        Meta.Write((uint32)SegmentTable.size());
+        for (const AVVSegmentTableEntry& Entry : SegmentTable)
+        {
+            Meta.Write(Entry.byteStart);
+            Meta.Write(Entry.byteLength);
+            Meta.Write(Entry.frameCount);
+            Meta.Write(Entry.vertexCount);
+            Meta.Write(Entry.indexCount);
+        }
+        Meta.EndContainer(ContainerStart);
+
+        ContainerStart = Meta.BeginContainer(AVV_META_LIMITS);
+        Meta.Write(Limits.MaxContainerSize);
+        Meta.Write(Limits.MaxVertexCount);
+        Meta.Write(Limits.MaxIndexCount);
+        Meta.Write(Limits.MaxFrameCount);
+        Meta.Write(Limits.MaxBoneCount);
+        Meta.Write(Limits.MaxTextureWidth);
+        Meta.Write(Limits.MaxTextureHeight);
+        Meta.Write(Limits.MaxTextureTriangles);
+        Meta.Write(Limits.MaxTextureBlocks);
+        Meta.Write(Limits.MaxLumaPixels);
+        Meta.EndContainer(ContainerStart);
+
+        return Meta;
+    };
+
+    int64 MetaDataStart = Writer->Tell();
+    FAVVWriter MetaData = BuildMetaData();
+    Writer->Serialize(MetaData.Data.GetData(), MetaData.Data.Num());
+
+    uint32 SegmentContainerCount = SegmentCount;
+    Writer->Serialize(&SegmentContainerCount, sizeof(uint32));
+
+    // Segments are built one at a time so large assets don't have to fit in memory.
+    for (int SegmentIndex = 0; SegmentIndex < SegmentCount; ++SegmentIndex)
+    {
+        int StartFrame = SegmentIndex * Settings.SegmentLength;
+        int SegmentFrameCount = FMath::Min(Settings.SegmentLength, Settings.FrameCount - StartFrame);
+
+        FAVVWriter Segment;
+        int32 SegmentStart = Segment.BeginContainer(AVV_SEGMENT_FRAMES);
+
+        uint32 SegmentDataCount = 4 + (TextureBlockCount > 0 ? 1 : 0) + (Mesh.LODs.Num() > 0 ? 1 : 0);
+        Segment.Write(SegmentDataCount);
+
+        // Vertex positions, SSDR segments also carry bone weights and indices.
+        int32 ContainerStart = Segment.BeginContainer(bSSDR ? AVV_SEGMENT_POS_SKIN_EXPAND_128_V2 : AVV_SEGMENT_POS_16);
+        Segment.Write(Mesh.AABBMin);
+        Segment.Write(Mesh.AABBMax);
+        Segment.Write(VertexCount);
+
+        if (bSSDR)
+        {
+            // Vertices are never shared so each one expands to exactly one output vertex.
+            Segment.Write(VertexCount);
+            for (uint32 v = 0; v < VertexCount; ++v)
+            {
+                Segment.Write((1u << 24) | v);
+            }
+
+            for (uint32 v = 0; v < VertexCount; ++v)
+            {
+                uint8 Bones[2];
+                float Weights[2];
+                BoneWeights(Mesh.UVs[v].Y, Settings.BoneCount, Bones, Weights);
+
+                const FHoloMeshVec3& Position = Mesh.Positions[v];
+                Segment.Write(Quantize(Position.X, Mesh.AABBMin.X, Mesh.AABBMax.X, UINT16_MAX) | (Quantize(Position.Y, Mesh.AABBMin.Y, Mesh.AABBMax.Y, UINT16_MAX) << 16));
+                Segment.Write(Quantize(Position.Z, Mesh.AABBMin.Z, Mesh.AABBMax.Z, UINT16_MAX) | (Quantize(Weights[0], 0.0f, 1.0f, UINT16_MAX) << 16));
+                Segment.Write(Quantize(Weights[1], 0.0f, 1.0f, UINT16_MAX));
+                Segment.Write((uint32)Bones[0] | ((uint32)Bones[1] << 8));
+            }
+        }
+        else
+        {
+            for (uint32 v = 0; v < VertexCount; v += 2)
+            {
+                const FHoloMeshVec3& Position0 = Mesh.Positions[v];
+                const FHoloMeshVec3& Position1 = Mesh.Positions[v + 1];
+                Segment.Write(Quantize(Position0.X, Mesh.AABBMin.X, Mesh.AABBMax.X, UINT16_MAX) | (Quantize(Position0.Y, Mesh.AABBMin.Y, Mesh.AABBMax.Y, UINT16_MAX) << 16));
+                Segment.Write(Quantize(Position0.Z, Mesh.AABBMin.Z, Mesh.AABBMax.Z, UINT16_MAX) | (Quantize(Position1.X, Mesh.AABBMin.X, Mesh.AABBMax.X, UINT16_MAX) << 16));
+                Segment.Write(Quantize(Position1.Y, Mesh.AABBMin.Y, Mesh.AABBMax.Y, UINT16_MAX) | (Quantize(Position1.Z, Mesh.AABBMin.Z, Mesh.AABBMax.Z, UINT16_MAX) << 16));
+            }
+        }
+        Segment.EndContainer(ContainerStart);
+
+        ContainerStart = Segment.BeginContainer(AVV_SEGMENT_UVS_16);
+        Segment.Write(VertexCount);
+        for (uint32 v = 0; v < VertexCount; ++v)
+        {
+            Segment.Write(Quantize(Mesh.UVs[v].X, 0.0f, 1.0f, UINT16_MAX) | (Quantize(Mesh.UVs[v].Y, 0.0f, 1.0f, UINT16_MAX) << 16));
+        }
+        Segment.EndContainer(ContainerStart);
+
+        ContainerStart = Segment.BeginContainer(bIndex32Bit ? AVV_SEGMENT_TRIS_32 : AVV_SEGMENT_TRIS_16);
+        Segment.Write(IndexCount);
+        for (uint32 Index : Mesh.Indices)
+        {
+            if (bIndex32Bit)
+            {
+                Segment.Write(Index);
+            }
+            else
+            {
+                Segment.Write((uint16)Index);
+            }
+        }
+        Segment.EndContainer(ContainerStart);
+
+        if (Mesh.LODs.Num() > 0)
+        {
+            ContainerStart = Segment.BeginContainer(AVV_SEGMENT_TRIS_LODS_32);
+            Segment.Write((uint32)Mesh.LODs.Num());
+            for (const FMeshLOD& MeshLOD : Mesh.LODs)
+            {
+                // No vertices are shared, so the compact count is the vertex count.
+                Segment.Write(MeshLOD.VertexCount);
+                Segment.Write(MeshLOD.VertexCount);
+                Segment.Write((uint32)MeshLOD.Indices.Num());
+                for (uint32 Index : MeshLOD.Indices)
+                {
+                    Segment.Write(Index);
+                }
+            }
+            Segment.EndContainer(ContainerStart);
+        }
+
+        if (TextureBlockCount > 0)
+        {
+            ContainerStart = Segment.BeginContainer(AVV_SEGMENT_TEXTURE_BLOCKS_32);
+            Segment.Write(TextureBlockCount);
+            Segment.Write((TextureSize << 16) | TextureSize);
+            for (uint32 y = 0; y < TextureSize / 4; ++y)
+            {
+                for (uint32 x = 0; x < TextureSize / 4; ++x)
+                {
+                    Segment.Write(x | (y << 16));
+                }
+            }
+            Segment.EndContainer(ContainerStart);
+        }
+
+        // FStreamableAVVData::ImportSegment keeps only the container payload sizes worth of data, dropping
+        // as many bytes as the container count and headers take up. Pad so that only
+        // this container loses data.
+        ContainerStart = Segment.BeginContainer(0);
+        for (uint32 i = 0; i < sizeof(uint32) + (SegmentDataCount * 8); ++i)
+        {
+            Segment.Write((uint8)0);
+        }
+        Segment.EndContainer(ContainerStart);
+
+        Segment.Write((uint32)SegmentFrameCount);
+
+        // Luma blocks as the player will have them after the previous frame. Delta frames are
+        // compared against these rather than the previous source frame so error doesn't accumulate.
+        TArray<uint64> DecodedLumaBlocks;
+        DecodedLumaBlocks.SetNumZeroed(TextureBlockCount);
+
+        TArray<uint32> DeltaData;
+        for (int Frame = StartFrame; Frame < StartFrame + SegmentFrameCount; ++Frame)
+        {
+            uint32 FrameDataCount = 2 + (Settings.Animation != EHoloSuiteSyntheticAnimation::None ? 1 : 0) + (TextureBlockCount > 0 ? 1 : 0);
+            Segment.Write(FrameDataCount);
+
+            FHoloMeshVec3 FrameMin(FLT_MAX);
+            FHoloMeshVec3 FrameMax(-FLT_MAX);
+            for (uint32 v = 0; v < VertexCount; ++v)
+            {
+                FHoloMeshVec3 Position = FramePosition(Mesh, v, Frame, Settings.Animation, Settings.BoneCount);
+                FrameMin = FrameMin.ComponentMin(Position);
+                FrameMax = FrameMax.ComponentMax(Position);
+            }
+
+            ContainerStart = Segment.BeginContainer(AVV_FRAME_BOUNDS_AABB_32);
+            Segment.Write(FrameMin);
+            Segment.Write(FrameMax);
+            Segment.EndContainer(ContainerStart);
+
+            if (bSSDR)
+            {
+                ContainerStart = Segment.BeginContainer(AVV_FRAME_ANIM_MAT4X4_32);
+                Segment.Write((uint32)Settings.BoneCount);
+                for (int Bone = 0; Bone < Settings.BoneCount; ++Bone)
+                {
+                    // Stored column major, see FAVVReader::ReadFrameAnimMat4x4.
+                    float Matrix[16];
+                    BoneMatrix(Bone, Frame, Matrix);
+                    for (int Column = 0; Column < 4; ++Column)
+                    {
+                        for (int Row = 0; Row < 4; ++Row)
+                        {
+                            Segment.Write(Matrix[(Row * 4) + Column]);
+                        }
+                    }
+                }
+                Segment.EndContainer(ContainerStart);
+            }
+
+            if (Settings.Animation == EHoloSuiteSyntheticAnimation::Delta)
+            {
+                FHoloMeshVec3 DeltaMin(FLT_MAX);
+                FHoloMeshVec3 DeltaMax(-FLT_MAX);
+                TArray<FHoloMeshVec3> Deltas;
+                Deltas.SetNumUninitialized(VertexCount);
+                for (uint32 v = 0; v < VertexCount; ++v)
+                {
+                    Deltas[v] = Delta(Mesh, v, Frame);
+                    DeltaMin = DeltaMin.ComponentMin(Deltas[v]);
+                    DeltaMax = DeltaMax.ComponentMax(Deltas[v]);
+                }
+
+                ContainerStart = Segment.BeginContainer(AVV_FRAME_ANIM_DELTA_POS_32);
+                Segment.Write(DeltaMin);
+                Segment.Write(DeltaMax);
+                Segment.Write(VertexCount);
+                for (uint32 v = 0; v < VertexCount; ++v)
+                {
+                    Segment.Write(Quantize(Deltas[v].X, DeltaMin.X, DeltaMax.X, 1023)
+                        | (Quantize(Deltas[v].Y, DeltaMin.Y, DeltaMax.Y, 4095) << 10)
+                        | (Quantize(Deltas[v].Z, DeltaMin.Z, DeltaMax.Z, 1023) << 22));
+                }
+                Segment.EndContainer(ContainerStart);
+            }
+
+            ContainerStart = Segment.BeginContainer(AVV_FRAME_COLORS_RGB_565_NORMALS_OCT_16);
+            Segment.Write(VertexCount);
+            for (uint32 v = 0; v < VertexCount; ++v)
+            {
+                Segment.Write(Color565(Mesh.UVs[v], Frame));
+                Segment.Write(NormalOct16(FrameNormal(Mesh, v, Frame, Settings.Animation, Settings.BoneCount)));
+            }
+            Segment.EndContainer(ContainerStart);
+
+            // Segments start with a full refresh since their block maps differ.
+            bool bLumaRefresh = Settings.TextureRefreshInterval <= 0 || ((Frame - StartFrame) % Settings.TextureRefreshInterval) == 0;
+            if (TextureBlockCount > 0 && bLumaRefresh)
+            {
+                ContainerStart = Segment.BeginContainer(AVV_FRAME_TEXTURE_LUMA_BC4);
+                Segment.Write(TextureBlockCount);
+                for (uint32 Block = 0; Block < TextureBlockCount; ++Block)
+                {
+                    DecodedLumaBlocks[Block] = LumaBlockBC4(Block, Frame);
+                    Segment.Write(DecodedLumaBlocks[Block]);
+                }
+                Segment.EndContainer(ContainerStart);
+            }
+            else if (TextureBlockCount > 0)
+            {
+                TArray<uint32> ChangedBlocks;
+                for (uint32 Block = 0; Block < TextureBlockCount; ++Block)
+                {
+                    uint64 LumaBlock = LumaBlockBC4(Block, Frame);
+                    if (LumaBlockDifference(LumaBlock, DecodedLumaBlocks[Block]) > Settings.TextureDeltaThreshold)
+                    {
+                        DecodedLumaBlocks[Block] = LumaBlock;
+                        ChangedBlocks.Add(Block);
+                    }
+                }
+
+                ContainerStart = Segment.BeginContainer(AVV_FRAME_TEXTURE_LUMA_BC4_DELTA);
+                Segment.Write((uint32)ChangedBlocks.Num());
+                for (uint32 Block : ChangedBlocks)
+                {
+                    Segment.Write(Block);
+                }
+                for (uint32 Block : ChangedBlocks)
+                {
+                    Segment.Write(DecodedLumaBlocks[Block]);
+                }
+                Segment.EndContainer(ContainerStart);
+            }
+        }
+
+        Segment.EndContainer(SegmentStart);
+
+        AVVSegmentTableEntry& Entry = SegmentTable[SegmentIndex];
+        Entry.byteStart = (uint32)Writer->Tell();
+        Entry.byteLength = Segment.Data.Num();
+        Entry.frameCount = SegmentFrameCount;
+        Entry.vertexCount = VertexCount;
+        Entry.indexCount = IndexCount;
+        Limits.MaxContainerSize = FMath::Max(Limits.MaxContainerSize, (uint32)Segment.Data.Num());
+
+        Writer->Serialize(Segment.Data.GetData(), Segment.Data.Num());
+    }
+
+    int64 FileEnd = Writer->Tell();
+    MetaData = BuildMetaData();
+    Writer->Seek(MetaDataStart);
+    Writer->Serialize(MetaData.Data.GetData(), MetaData.Data.Num());
+    Writer->Seek(FileEnd);
+
+    return Writer->Close();
+}
+
+bool UHoloSuiteSyntheticAssetCommandlet::WriteOMS(const FString& Filename, const FHoloSuiteSyntheticAssetSettings& Settings)
+{
+    using namespace HoloSuiteSynthetic;
+
+    FMesh Mesh;
+    BuildMesh(Settings.VertexCount, 0, Mesh);
+
+    int VertexCount = Mesh.Positions.Num();
+    int IndexCount = Mesh.Indices.Num();
+
+    // Without animation every frame is its own keyframe sequence.
+    int SequenceLength = (Settings.Animation == EHoloSuiteSyntheticAnimation::None) ? 1 : Settings.SegmentLength;
+    int SequenceCount = FMath::DivideAndRoundUp(Settings.FrameCount, SequenceLength);
+
+    oms_header_t Header = {};
+    Header.version = OMS_VERSION;
+    Header.sequence_count = SequenceCount;
+    Header.has_retarget_data = Settings.RetargetBoneCount > 0;
+    Header.retarget_keyframe_compression = Header.has_retarget_data && Settings.bRetargetKeyframeCompression;
+    Header.compression_level = (Settings.Animation == EHoloSuiteSyntheticAnimation::Delta) ? OMS_COMPRESSION_DELTA : OMS_COMPRESSION_NONE;
+    Header.frame_count = Settings.FrameCount;
+    Header.sequence_table_entries = (sequence_table_entry*)malloc(sizeof(sequence_table_entry) * SequenceCount);
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+    if (!Writer)
+    {
+        oms_free_header(&Header);
+        return false;
+    }
+
+    // The header is rewritten with the sequence byte ranges at the end, its size doesn't change.
+    TArray<uint8> Buffer;
+    Buffer.SetNumZeroed(oms_get_header_write_size(&Header));
+    Writer->Serialize(Buffer.GetData(), Buffer.Num());
+
+    for (int SequenceIndex = 0; SequenceIndex < SequenceCount; ++SequenceIndex)
+    {
+        int StartFrame = SequenceIndex * SequenceLength;
+        int SequenceFrameCount = FMath::Min(SequenceLength, Settings.FrameCount - StartFrame);
+        bool bSSDR = (Settings.Animation == EHoloSuiteSyntheticAnimation::SSDR) && SequenceFrameCount > 1;
+
+        oms_sequence_t* Sequence = oms_alloc_sequence(VertexCount, VertexCount, VertexCount, IndexCount, bSSDR ? SequenceFrameCount : 1, bSSDR ? Settings.BoneCount : 0, Settings.RetargetBoneCount);
+
+        for (int v = 0; v < VertexCount; ++v)
+        {
+            Sequence->vertices[v] = { { Mesh.Positions[v].X, Mesh.Positions[v].Y, Mesh.Positions[v].Z } };
+            Sequence->normals[v] = { { Mesh.Normals[v].X, Mesh.Normals[v].Y, Mesh.Normals[v].Z } };
+            Sequence->uvs[v] = { { Mesh.UVs[v].X, Mesh.UVs[v].Y } };
+        }
+
+        for (int i = 0; i < IndexCount; ++i)
+        {
+            if (oms_bytes_per_index(VertexCount) == sizeof(uint16_t))
+            {
+                ((uint16_t*)Sequence->indices)[i] = (uint16_t)Mesh.Indices[i];
+            }
+            else
+            {
+                ((uint32_t*)Sequence->indices)[i] = Mesh.Indices[i];
+            }
+        }
+
+        if (bSSDR)
+        {
+            for (int v = 0; v < VertexCount; ++v)
+            {
+                uint8 Bones[2];
+                float Weights[2];
+                BoneWeights(Mesh.UVs[v].Y, Settings.BoneCount, Bones, Weights);
+
+                Sequence->ssdr_bone_indices[v] = { { (float)Bones[0], (float)Bones[1], 0.0f, 0.0f } };
+                Sequence->ssdr_bone_weights[v] = { { Weights[0], Weights[1], 0.0f, 0.0f } };
+            }
+
+            for (int f = 0; f < SequenceFrameCount; ++f)
+            {
+                for (int Bone = 0; Bone < Settings.BoneCount; ++Bone)
+                {
+                    BoneMatrix(Bone, StartFrame + f, Sequence->ssdr_frames[f].matrices[Bone].m);
+                }
+            }
+        }
+
+        if (Settings.Animation == EHoloSuiteSyntheticAnimation::Delta)
+        {
+            // Freed by oms_free_sequence.
+            Sequence->delta_frame_count = SequenceFrameCount;
+            Sequence->delta_frames = (oms_delta_frame_t*)malloc(sizeof(oms_delta_frame_t) * SequenceFrameCount);
+            for (int f = 0; f < SequenceFrameCount; ++f)
+            {
+                Sequence->delta_frames[f].vertices = (oms_vec3_t*)malloc(sizeof(oms_vec3_t) * VertexCount);
+                for (int v = 0; v < VertexCount; ++v)
+                {
+                    FHoloMeshVec3 D = Delta(Mesh, v, StartFrame + f);
+                    Sequence->delta_frames[f].vertices[v] = { { D.X, D.Y, D.Z } };
+                }
+            }
+        }
+
+        // Retarget data has one frame per SSDR frame.
+        if (Header.has_retarget_data)
+        {
+            // Retarget vertex bone indices are stored in 4 bits.
+            int WeightedBoneCount = FMath::Min(Settings.RetargetBoneCount, 16);
+            for (int v = 0; v < VertexCount; ++v)
+            {
+                uint8 Bones[2];
+                float Weights[2];
+                BoneWeights(Mesh.UVs[v].Y, WeightedBoneCount, Bones, Weights);
+
+                Sequence->retarget_data.indices[v] = { { (float)Bones[0], (float)Bones[1], 0.0f, 0.0f } };
+                Sequence->retarget_data.weights[v] = { { Weights[0], Weights[1], 0.0f, 0.0f } };
+            }
+
+            for (int Bone = 0; Bone < Settings.RetargetBoneCount; ++Bone)
+            {
+                oms_set_retarget_bone_name(Sequence, Bone, (char*)TCHAR_TO_ANSI(*FString::Printf(TEXT("Bone%d"), Bone)));
+                Sequence->retarget_data.bone_parents[Bone] = Bone - 1;
+
+                for (int f = 0; f < Sequence->ssdr_frame_count; ++f)
+                {
+                    RetargetBoneTransform(Bone, Settings.RetargetBoneCount, StartFrame + f, Sequence->retarget_data.bone_positions[f][Bone], Sequence->retarget_data.bone_rotations[f][Bone]);
+                }
+            }
+
+            oms_compute_retarget_keyframes(Sequence, 1e-5f, 1e-7f);
+        }
+
+        // Written size includes the leading sequence size integer.
+        Buffer.SetNumUninitialized(oms_get_sequence_write_size(&Header, Sequence) + sizeof(int));
+        size_t SequenceSizeBytes = oms_write_sequence(Buffer.GetData(), 0, Buffer.Num(), &Header, Sequence, nullptr);
+
+        sequence_table_entry& Entry = Header.sequence_table_entries[SequenceIndex];
+        Entry.frame_count = SequenceFrameCount;
+        Entry.start_frame = StartFrame;
+        Entry.end_frame = StartFrame + SequenceFrameCount - 1;
+        Entry.start_byte = Writer->Tell();
+        Entry.end_byte = Entry.start_byte + SequenceSizeBytes;
+
+        Writer->Serialize(Buffer.GetData(), SequenceSizeBytes);
+
+        oms_free_sequence(Sequence);
+        free(Sequence);
+    }
+
+    int64 FileEnd = Writer->Tell();
+    Buffer.SetNumUninitialized(oms_get_header_write_size(&Header));
+    oms_write_header(Buffer.GetData(), 0, Buffer.Num(), &Header);
+    Writer->Seek(0);
+    Writer->Serialize(Buffer.GetData(), Buffer.Num());
+    Writer->Seek(FileEnd);
+
+    oms_free_header(&Header);
+    return Writer->Close();
+}
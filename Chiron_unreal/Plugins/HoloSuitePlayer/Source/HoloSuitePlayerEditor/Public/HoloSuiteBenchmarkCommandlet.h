@@ -0,0 +1,61 @@
+// Copyright 2023 Arcturus Studios Holdings, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Dom/JsonObject.h"
+
+#include "HoloSuiteBenchmarkCommandlet.generated.h"
+
+class UAVVFile;
+class UOMSFile;
+
+// Checksum and per stage timings gathered from decoding a single asset.
+struct FHoloSuiteBenchmarkResult
+{
+    FString AssetPath;
+    uint32 Checksum = 0;
+    int FrameCount = 0;
+
+    // Average milliseconds per frame for each decode stage.
+    TMap<FString, double> StageMilliseconds;
+};
+
+/**
+ * Headless decode regression and performance check. Decodes every frame of the given
+ * AVV and OMS assets on the CPU path, checksums the decoded output and records per stage
+ * timings. Results are compared against (or written to) a JSON baseline.
+ *
+ * UnrealEditor-Cmd.exe <Project> -run=HoloSuiteBenchmark -Files=/Game/A.A,/Game/B.B
+ *     -Baseline=<path.json> [-Threshold=0.1] [-Iterations=3] [-WriteBaseline]
+ *     [-IO=BulkData|File|Memory]
+ *
+ * -IO=Memory copies every payload into memory when a file is opened so read timings and
+ * completion order don't depend on the disk.
+ *
+ * Returns non-zero if a checksum differs from the baseline, a stage is slower than the
+ * baseline by more than the threshold or the OMS frame number decode check fails.
+ */
+UCLASS()
+class HOLOSUITEPLAYEREDITOR_API UHoloSuiteBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UHoloSuiteBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+protected:
+    bool BenchmarkAVV(UAVVFile* AVVFile, FHoloSuiteBenchmarkResult& Result);
+    bool BenchmarkOMS(UOMSFile* OMSFile, FHoloSuiteBenchmarkResult& Result);
+
+    // Decodes synthetic OMS frame number stamps, with and without noise, and checks the results.
+    bool VerifyFrameNumberDecode();
+
+    // Returns the number of regressions found.
+    int CompareToBaseline(const TArray<FHoloSuiteBenchmarkResult>& Results, const TSharedPtr<FJsonObject>& Baseline, double Threshold);
+
+    TSharedPtr<FJsonObject> ToJson(const TArray<FHoloSuiteBenchmarkResult>& Results);
+};
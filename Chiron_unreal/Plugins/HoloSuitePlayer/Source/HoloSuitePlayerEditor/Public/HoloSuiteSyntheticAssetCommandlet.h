@@ -0,0 +1,69 @@
+// Copyright 2023 Arcturus Studios Holdings, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "HoloSuiteSyntheticAssetCommandlet.generated.h"
+
+enum class EHoloSuiteSyntheticAnimation : uint8
+{
+    None,
+    SSDR,
+    Delta
+};
+
+// Parameters of a generated asset.
+struct FHoloSuiteSyntheticAssetSettings
+{
+    int VertexCount = 20000;
+    int FrameCount = 300;
+    int SegmentLength = 30;
+    int BoneCount = 16;
+
+    // Coarser geometry LODs written to AVV_SEGMENT_TRIS_LODS_32, each one keeps every other
+    // row and column of the one before it. AVV only.
+    int GeometryLODs = 0;
+
+    // Luma texture width and height in pixels, 0 disables the texture. AVV only.
+    int TextureSize = 0;
+
+    // Frames between full luma refreshes, in between only blocks that changed by more than
+    // TextureDeltaThreshold luma levels are written. 0 writes every frame in full. AVV only.
+    int TextureRefreshInterval = 0;
+    int TextureDeltaThreshold = 4;
+
+    // Retarget skeleton bone count, 0 disables retarget data. OMS only.
+    int RetargetBoneCount = 0;
+    bool bRetargetKeyframeCompression = true;
+
+    EHoloSuiteSyntheticAnimation Animation = EHoloSuiteSyntheticAnimation::SSDR;
+};
+
+/**
+ * Writes synthetic .avv and .oms files of a given size for scale testing. The mesh is a
+ * vertex colored cylinder that is animated per frame, every stream the player decodes is
+ * populated so the generated files exercise the same paths as captured ones.
+ *
+ * UnrealEditor-Cmd.exe <Project> -run=HoloSuiteSyntheticAsset -Output=<path.avv|path.oms>
+ *     [-Vertices=20000] [-Frames=300] [-SegmentLength=30] [-Bones=16] [-TextureSize=0]
+ *     [-TextureRefresh=0] [-TextureThreshold=4] [-GeometryLODs=0]
+ *     [-Animation=None|SSDR|Delta] [-RetargetBones=0] [-NoRetargetKeyframes]
+ *
+ * The output format is picked from the file extension. Generated files are imported like any
+ * other capture.
+ */
+UCLASS()
+class HOLOSUITEPLAYEREDITOR_API UHoloSuiteSyntheticAssetCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UHoloSuiteSyntheticAssetCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+    static bool WriteAVV(const FString& Filename, const FHoloSuiteSyntheticAssetSettings& Settings);
+    static bool WriteOMS(const FString& Filename, const FHoloSuiteSyntheticAssetSettings& Settings);
+};